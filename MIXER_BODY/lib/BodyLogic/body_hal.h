@@ -0,0 +1,26 @@
+#pragma once
+
+/*
+ * Body hardware hooks used by body_logic.cpp
+ *
+ * Implemented in src/main.cpp for the ESP32 (Wire, GPIO, ESP32-A2DP,
+ * MixerLinkUart) and by MixerSim on the host, which records every call.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+enum BodyRelay : uint8_t {
+    BODY_RELAY_MUSIC = 0,   // HIGH = Line-In (NO), LOW = Bluetooth (NC)
+    BODY_RELAY_MIC,         // HIGH = Wireless, LOW = Wired
+};
+
+bool hal_pt2258_write(const uint8_t *data, size_t len);   // One I2C transaction, false if not acknowledged
+void hal_relay_write(BodyRelay relay, bool high);
+void hal_bt_start();
+void hal_bt_end();
+bool hal_bt_connected();
+void hal_link_write(const uint8_t *data, size_t len);   // RS485, body -> controller
+int64_t hal_now_us();
+uint32_t hal_millis();
+void hal_log(const char *fmt, ...);         // USB serial debug output
@@ -0,0 +1,519 @@
+#include "body_logic.h"
+#include "body_hal.h"
+#include <string.h>
+#include <algorithm>
+
+// ------------------- STATE -------------------
+// (see body_logic.h)
+int currentMusicVol = 0; // 0-100 from Controller
+int currentMicVol = 0;   // 0-100 from Controller
+bool relayMusicState = false; // logic from Controller
+bool relayMicState = false;   // logic from Controller
+
+// Bluetooth State
+bool isBluetoothActive = false;
+bool systemSleeping = false;  // Set true when pwr:0 received
+
+// MixerLink sequence tracking (DELTA / ACK / NAK)
+uint8_t rxLastSeq = 0;                          // Newest controller frame seen
+bool rxSeqValid = false;
+uint8_t fieldSeq[MIXER_LINK_FIELD_COUNT];       // Frame that last set each field
+bool fieldSeqValid = false;
+uint32_t acksSent = 0;
+uint32_t naksSent = 0;
+uint32_t staleFields = 0;                       // Older than the value already applied
+uint8_t lastAppliedSeq = 0;
+
+// Half-duplex reply slot: the body only talks right after a controller frame
+int64_t replyDeadlineUs = 0;                    // Latest start of a reply, 0 = no open slot
+uint32_t repliesMissed = 0;                     // Reply dropped, slot already over
+
+// Telemetry (body -> controller)
+#define TELEMETRY_PERIOD_MS 1000                // Also sent at once when the state changes
+uint8_t txSeq = 0;
+uint32_t lastTelemetryMs = 0;
+static bool telemetryDue = false;               // Full STATE (heartbeat) or GET received: reply with telemetry
+static bool getSent = false;                    // Our own GET, may come back as bus echo
+static uint8_t getSeq = 0;
+MixerLinkTelemetry lastTelemetry = {};
+uint32_t telemetrySent = 0;
+uint16_t i2cErrors = 0;
+uint32_t loopMaxUs = 0;
+uint32_t loopSumUs = 0;
+uint32_t loopCount = 0;
+
+// Volume ramp (see VOLUME RAMP below)
+#define PT2258_MUTE_DB    79
+enum RampGroup : uint8_t { RAMP_MUSIC = 0, RAMP_MIC, RAMP_GROUPS };
+uint32_t rampStepUs = BODY_RAMP_STEP_US;
+static uint8_t rampAtt[RAMP_GROUPS] = {PT2258_MUTE_DB, PT2258_MUTE_DB};   // As written to the PT2258
+static int64_t rampLastStepUs = 0;
+static bool drivenMusicRelay = false;   // Pins as set in setup(): Line-In
+static bool drivenMicRelay = false;     // Wired
+static bool switchSettling = false;
+static int64_t switchAtUs = 0;
+static bool shutdownPending = false;    // Bluetooth / relays reset once both pairs are muted
+uint32_t relaySwitches = 0;
+
+// ------------------- PT2258 DRIVER -------------------
+#define PT2258_CLEAR      0xC0
+#define PT2258_MAX_BATCH  8      // 4 channels x (10 dB, 1 dB) in one transaction
+#define PT2258_UNKNOWN    0xFF
+
+// Last value latched in each register, indexed by register address >> 4.
+// Unknown after reset or a failed write, so the next update rewrites it.
+static uint8_t pt2258Shadow[16] = {
+    PT2258_UNKNOWN, PT2258_UNKNOWN, PT2258_UNKNOWN, PT2258_UNKNOWN,
+    PT2258_UNKNOWN, PT2258_UNKNOWN, PT2258_UNKNOWN, PT2258_UNKNOWN,
+    PT2258_UNKNOWN, PT2258_UNKNOWN, PT2258_UNKNOWN, PT2258_UNKNOWN,
+    PT2258_UNKNOWN, PT2258_UNKNOWN, PT2258_UNKNOWN, PT2258_UNKNOWN,
+};
+uint32_t i2cWrites = 0;          // I2C transactions
+uint32_t i2cSkipped = 0;         // Register writes saved by the shadow
+
+struct Pt2258Batch {
+    uint8_t data[PT2258_MAX_BATCH];
+    size_t len = 0;
+};
+
+// Queues a register write unless the chip already holds that value
+static void pt2258_queue(Pt2258Batch& batch, uint8_t reg, uint8_t value) {
+    if (pt2258Shadow[reg >> 4] == value) {
+        i2cSkipped++;
+        return;
+    }
+    batch.data[batch.len++] = reg | value;
+}
+
+// One transaction for the whole batch, errors counted (telemetry)
+static void pt2258_flush(const Pt2258Batch& batch) {
+    if (batch.len == 0) return;
+    i2cWrites++;
+    bool ok = hal_pt2258_write(batch.data, batch.len);
+    if (!ok && i2cErrors < UINT16_MAX) i2cErrors++;
+    for (size_t i = 0; i < batch.len; i++) {
+        pt2258Shadow[batch.data[i] >> 4] = ok ? (batch.data[i] & 0x0F) : PT2258_UNKNOWN;
+    }
+}
+
+void pt2258Reset() {
+    uint8_t clear = PT2258_CLEAR;
+    i2cWrites++;
+    if (!hal_pt2258_write(&clear, 1) && i2cErrors < UINT16_MAX) i2cErrors++;
+    memset(pt2258Shadow, PT2258_UNKNOWN, sizeof(pt2258Shadow));
+}
+
+// 0-100 input -> 79-0 dB attenuation
+static uint8_t volumeToAttenuation(int volume0to100) {
+    // 100 -> 0 dB (Loudest)
+    // 0   -> 79 dB (Quiet)
+    int attenuation = 79 - (volume0to100 * 79) / 100;
+    if (attenuation < 0) attenuation = 0;
+    if (attenuation > PT2258_MUTE_DB) attenuation = PT2258_MUTE_DB;
+    return (uint8_t)attenuation;
+}
+
+// Helper to set volume for specific channel pair
+// PT2258: -10dB step = High Nibble (X), -1dB step = Low Nibble (Y)
+// Code structure from datasheet: 
+//   1-Channel: 10dB (1<ch><ch>1 <att>), 1dB (1<ch><ch>0 <att>) - THIS VARIES BY DATASHEET VERSION
+//   Let's use the Master Volume for now if easiest, OR specific channels as verified.
+//   Standard PT2258 Channel addressing (based on commonlibs):
+//   Ch1 (Vol1): 0x80 / 0x90
+//   Ch2 (Vol2): 0x40 / 0x50
+//   Ch3 (Vol3): 0x00 / 0x10
+//   Ch4 (Vol4): 0x20 / 0x30
+//   Ch5 (Vol5): 0x60 / 0x70
+//   Ch6 (Vol6): 0xA0 / 0xB0
+//   Master:     0xD0 / 0xE0
+//
+//   Mapping from "Pins.txt":
+//   Ch1, Ch2 -> Music
+//   Ch3, Ch4 -> Mic
+
+void setChannelVolume(Pt2258Batch& batch, int ch_10db_base, int ch_1db_base, int attenuation) {
+    int tens = attenuation / 10;
+    int ones = attenuation % 10;
+
+    pt2258_queue(batch, ch_10db_base, tens);
+    pt2258_queue(batch, ch_1db_base, ones);
+}
+
+// Current ramp positions, changed registers only, all in one I2C transaction
+// (the PT2258 takes any number of data bytes after its address)
+void updateVolume() {
+    Pt2258Batch batch;
+
+    // Music (Channels 1 & 2)
+    // Ch1 (L): 0x80/0x90
+    setChannelVolume(batch, 0x80, 0x90, rampAtt[RAMP_MUSIC]);
+    // Ch2 (R): 0x40/0x50
+    setChannelVolume(batch, 0x40, 0x50, rampAtt[RAMP_MUSIC]);
+
+    // Mic (Channels 3 & 4)
+    // Ch3 (L): 0x00/0x10
+    setChannelVolume(batch, 0x00, 0x10, rampAtt[RAMP_MIC]);
+    // Ch4 (R): 0x20/0x30
+    setChannelVolume(batch, 0x20, 0x30, rampAtt[RAMP_MIC]);
+
+    pt2258_flush(batch);
+}
+
+// ------------------- VOLUME RAMP -------------------
+// Volume never jumps: each channel pair moves toward its target in 1 dB
+// steps, one step per rampStepUs (no zipper noise). A relay change fades its
+// pair out, keeps it muted for BODY_RELAY_SETTLE_MS, switches, and fades
+// back in.
+
+static bool relayPending(RampGroup g) {
+    return g == RAMP_MUSIC ? relayMusicState != drivenMusicRelay : relayMicState != drivenMicRelay;
+}
+
+static uint8_t rampTarget(RampGroup g) {
+    if (relayPending(g)) return PT2258_MUTE_DB;   // Fade out before the relay switches
+    return volumeToAttenuation(g == RAMP_MUSIC ? currentMusicVol : currentMicVol);
+}
+
+static bool rampMoving() {
+    return rampAtt[RAMP_MUSIC] != rampTarget(RAMP_MUSIC) || rampAtt[RAMP_MIC] != rampTarget(RAMP_MIC);
+}
+
+bool rampActive() {
+    return rampMoving() || relayPending(RAMP_MUSIC) || relayPending(RAMP_MIC) || shutdownPending;
+}
+
+// Shutdown, second half: every pair faded out, so Bluetooth stops and the
+// relays go back to their defaults without a pop
+static void finishShutdown() {
+    shutdownPending = false;
+    if (isBluetoothActive) {
+        hal_log("Stopping Bluetooth (shutdown)...\n");
+        hal_bt_end();
+        isBluetoothActive = false;
+    }
+
+    // Reset relays to default (Line-In, Wired Mic), after the settle time below
+    relayMusicState = false;
+    relayMicState = false;
+}
+
+void serviceRamp() {
+    int64_t now = hal_now_us();
+
+    // One 1 dB step for every pair not at its target
+    if (now - rampLastStepUs >= (int64_t)rampStepUs) {
+        bool stepped = false;
+        for (int g = 0; g < RAMP_GROUPS; g++) {
+            uint8_t target = rampTarget((RampGroup)g);
+            if (rampAtt[g] == target) continue;
+            rampAtt[g] = target > rampAtt[g] ? rampAtt[g] + 1 : rampAtt[g] - 1;
+            stepped = true;
+        }
+        if (stepped) {
+            rampLastStepUs = now;
+            updateVolume();
+        }
+    }
+
+    if (shutdownPending && rampAtt[RAMP_MUSIC] == PT2258_MUTE_DB && rampAtt[RAMP_MIC] == PT2258_MUTE_DB) {
+        finishShutdown();
+    }
+
+    // Relays switch once every pair they carry has been muted for the settle time
+    bool pending = false;
+    bool muted = true;
+    for (int g = 0; g < RAMP_GROUPS; g++) {
+        if (!relayPending((RampGroup)g)) continue;
+        pending = true;
+        if (rampAtt[g] != PT2258_MUTE_DB) muted = false;
+    }
+    if (!pending || !muted) {
+        switchSettling = false;
+    } else if (!switchSettling) {
+        switchSettling = true;
+        switchAtUs = now + BODY_RELAY_SETTLE_MS * 1000LL;
+    } else if (now >= switchAtUs) {
+        switchSettling = false;
+        updateRelays();
+        relaySwitches++;
+    }
+}
+
+uint32_t rampWaitUs(uint32_t max_us) {
+    int64_t now = hal_now_us();
+    int64_t wait = max_us;
+    if (rampMoving()) wait = std::min(wait, rampLastStepUs + rampStepUs - now);
+    if (switchSettling) wait = std::min(wait, switchAtUs - now);
+    return wait > 0 ? (uint32_t)wait : 0;
+}
+
+// ------------------- LOGIC -------------------
+
+void updateRelays() {
+    // Logic:
+    // Music Relay (33): LOW = Bluetooth (NC), HIGH = Line-In (NO).
+    // relayMusicState == 1 (from Controller) => Bluetooth Mode.
+    if (relayMusicState) {
+        // Bluetooth
+        hal_relay_write(BODY_RELAY_MUSIC, false); // LOW
+        if (!isBluetoothActive) {
+            hal_log("Starting Bluetooth...\n");
+            hal_bt_start();
+            isBluetoothActive = true;
+        }
+    } else {
+        // Line-In
+        hal_relay_write(BODY_RELAY_MUSIC, true);  // HIGH
+        if (isBluetoothActive) {
+            hal_log("Stopping Bluetooth...\n");
+            hal_bt_end();
+            isBluetoothActive = false;
+        }
+    }
+
+    // Mic Relay (14)
+    // relayMicState == 1 => Wireless (High), 0 => Wired (Low) [Assumption based on previous code]
+    hal_relay_write(BODY_RELAY_MIC, relayMicState);
+
+    drivenMusicRelay = relayMusicState;
+    drivenMicRelay = relayMicState;
+}
+
+void applyShutdown() {
+    hal_log(">>> SHUTDOWN command received <<<\n");
+    
+    // 1. Fade all volume channels out
+    currentMusicVol = 0;
+    currentMicVol = 0;
+    
+    // 2. Stop Bluetooth and reset the relays once faded (finishShutdown())
+    shutdownPending = true;
+    serviceRamp();
+    
+    systemSleeping = true;
+    hal_log("System sleeping. Waiting for heartbeat to wake up.\n");
+}
+
+void wakeIfSleeping() {
+    if (systemSleeping) {
+        hal_log(">>> WAKE UP: Heartbeat received <<<\n");
+        systemSleeping = false;
+        shutdownPending = false;   // Still fading: the new state applies instead
+    }
+}
+
+void applyState() {
+    hal_log("Upd: MusV=%d MicV=%d MusR=%d MicR=%d\n", 
+                  currentMusicVol, currentMicVol, relayMusicState, relayMicState);
+
+    serviceRamp();    // First step now, the rest from loop()
+    updateVolume();   // Registers a failed write left unknown
+}
+
+// ------------------- MIXERLINK ACK / NAK -------------------
+#define NAK_MAX_COUNT 8   // Missing frames reported per NAK
+
+// Only inside the reply slot of the last controller frame, so the body never
+// talks over the controller. False if the frame was not written.
+bool sendLinkFrame(const MixerLinkFrame& frame) {
+    if (replyDeadlineUs == 0 || hal_now_us() > replyDeadlineUs) {
+        repliesMissed++;
+        return false;
+    }
+
+    uint8_t buf[MIXER_LINK_MAX_FRAME];
+    size_t len = mixer_link_encode(frame, buf, sizeof(buf));
+    if (len == 0) return false;
+    hal_link_write(buf, len);
+    return true;
+}
+
+// Reports a gap in the controller's sequence numbers (lost frames)
+void trackSequence(uint8_t seq) {
+    if (rxSeqValid && mixer_link_seq_newer(seq, rxLastSeq)) {
+        uint8_t missing = (uint8_t)(seq - rxLastSeq - 1);
+        if (missing > 0) {
+            MixerLinkFrame nak;
+            mixer_link_make_nak(nak, (uint8_t)(rxLastSeq + 1), missing < NAK_MAX_COUNT ? missing : NAK_MAX_COUNT);
+            sendLinkFrame(nak);
+            naksSent++;
+        }
+    }
+    if (!rxSeqValid || mixer_link_seq_newer(seq, rxLastSeq)) {
+        rxLastSeq = seq;
+        rxSeqValid = true;
+    }
+}
+
+void sendAck(uint8_t seq) {
+    MixerLinkFrame ack;
+    mixer_link_make_ack(ack, seq);
+    sendLinkFrame(ack);
+    acksSent++;
+}
+
+// True if `seq` is newer than the frame that last set field `i`
+bool takeField(int i, uint8_t seq) {
+    if (fieldSeqValid && !mixer_link_seq_newer(seq, fieldSeq[i])) {
+        staleFields++;
+        return false;
+    }
+    fieldSeq[i] = seq;
+    return true;
+}
+
+// MixerLink binary format (see MixerLink/src/mixer_link.h)
+void processFrame(const MixerLinkFrame& frame) {
+    switch (frame.type) {
+        case MIXER_LINK_TYPE_STATE: {
+            MixerLinkState state;
+            if (!mixer_link_parse_state(frame, state)) break;
+            sendAck(frame.seq);
+            trackSequence(frame.seq);
+            lastAppliedSeq = frame.seq;
+
+            getSent = false;   // Answered
+
+            // Full state is the resync point: every field takes this sequence number
+            for (int i = 0; i < MIXER_LINK_FIELD_COUNT; i++) fieldSeq[i] = frame.seq;
+            fieldSeqValid = true;
+            rxLastSeq = frame.seq;
+
+            // The controller's heartbeat: telemetry follows it, whatever the period
+            telemetryDue = true;
+
+            wakeIfSleeping();
+            currentMusicVol = state.music_volume;
+            currentMicVol = state.mic_volume;
+            relayMusicState = state.music_relay;
+            relayMicState = state.mic_relay;
+            applyState();
+            return;
+        }
+        case MIXER_LINK_TYPE_DELTA: {
+            uint8_t mask = 0;
+            MixerLinkState state;
+            if (!mixer_link_parse_delta(frame, mask, state)) break;
+
+            // No full state yet (boot, or it was lost): changed fields on top of
+            // our defaults are not a state, ask for one instead
+            if (!fieldSeqValid) {
+                MixerLinkFrame get;
+                mixer_link_make_get(get, txSeq++);
+                getSent = sendLinkFrame(get);
+                getSeq = get.seq;
+                trackSequence(frame.seq);
+                return;
+            }
+
+            sendAck(frame.seq);
+            trackSequence(frame.seq);
+            lastAppliedSeq = frame.seq;
+
+            // Retransmitted frames arrive late: only fields not set by a newer frame apply
+            bool changed = false;
+            if ((mask & MIXER_LINK_FIELD_MUSIC_VOL) && takeField(0, frame.seq)) {
+                currentMusicVol = state.music_volume;
+                changed = true;
+            }
+            if ((mask & MIXER_LINK_FIELD_MIC_VOL) && takeField(1, frame.seq)) {
+                currentMicVol = state.mic_volume;
+                changed = true;
+            }
+            if ((mask & MIXER_LINK_FIELD_RELAYS) && takeField(2, frame.seq)) {
+                relayMusicState = state.music_relay;
+                relayMicState = state.mic_relay;
+                changed = true;
+            }
+            if (changed) {
+                wakeIfSleeping();
+                applyState();
+            }
+            return;
+        }
+        case MIXER_LINK_TYPE_POWER: {
+            bool on = true;
+            if (!mixer_link_parse_power(frame, on)) break;
+            sendAck(frame.seq);
+            trackSequence(frame.seq);
+            lastAppliedSeq = frame.seq;
+            if (!on) {
+                applyShutdown();
+            } else {
+                wakeIfSleeping();
+            }
+            return;
+        }
+        case MIXER_LINK_TYPE_GET:
+            if (getSent && frame.seq == getSeq) {
+                getSent = false;
+                return;   // Our own GET (bus echo)
+            }
+            // Telemetry poll on a quiet bus: nothing to apply, the reply is the TELEMETRY
+            trackSequence(frame.seq);
+            lastAppliedSeq = frame.seq;
+            telemetryDue = true;
+            return;
+        case MIXER_LINK_TYPE_ACK:
+        case MIXER_LINK_TYPE_NAK:
+            return;   // Our own replies (bus echo)
+        default:
+            break;
+    }
+    hal_log("[RS485 RX] Ignored frame type 0x%02X len %d\n", frame.type, frame.len);
+}
+
+// Controller frame from the RS485 RX task, `rx_time_us` = its UART event
+void handleLinkFrame(const MixerLinkFrame& frame, int64_t rx_time_us) {
+    // Reply slot opens when the frame came off the wire
+    replyDeadlineUs = rx_time_us + MIXER_LINK_REPLY_START_US;
+    processFrame(frame);
+}
+
+MixerLinkTelemetry readTelemetry() {
+    MixerLinkTelemetry tlm = {};
+    tlm.applied_seq = lastAppliedSeq;
+    tlm.state.music_volume = currentMusicVol;
+    tlm.state.mic_volume = currentMicVol;
+    tlm.state.music_relay = drivenMusicRelay;   // As last driven by updateRelays()
+    tlm.state.mic_relay = drivenMicRelay;
+    tlm.flags = (isBluetoothActive ? MIXER_LINK_TLM_BT_ACTIVE : 0) |
+                (hal_bt_connected() ? MIXER_LINK_TLM_BT_CONNECTED : 0) |
+                (systemSleeping ? MIXER_LINK_TLM_SLEEPING : 0) |
+                (rampActive() ? MIXER_LINK_TLM_RAMPING : 0) |
+                MIXER_LINK_TLM_RELAY_FADE;
+    tlm.i2c_errors = i2cErrors;
+    uint32_t avg = loopCount ? loopSumUs / loopCount : 0;
+    tlm.loop_max_us = loopMaxUs < UINT16_MAX ? loopMaxUs : UINT16_MAX;
+    tlm.loop_avg_us = avg < UINT16_MAX ? avg : UINT16_MAX;
+    return tlm;
+}
+
+// Sent in the reply slot when the hardware state changed, after a full
+// STATE or a GET, or once per period
+void sendTelemetry() {
+    if (replyDeadlineUs == 0) return;
+
+    MixerLinkTelemetry tlm = readTelemetry();
+    bool changed = memcmp(&tlm.state, &lastTelemetry.state, sizeof(tlm.state)) != 0 ||
+                   tlm.flags != lastTelemetry.flags || tlm.i2c_errors != lastTelemetry.i2c_errors;
+    if (changed || telemetryDue || hal_millis() - lastTelemetryMs >= TELEMETRY_PERIOD_MS) {
+        MixerLinkFrame frame;
+        mixer_link_make_telemetry(frame, txSeq++, tlm);
+        if (sendLinkFrame(frame)) {     // A missed slot leaves it due for the next one
+            lastTelemetry = tlm;
+            lastTelemetryMs = hal_millis();
+            telemetrySent++;
+            telemetryDue = false;
+            loopMaxUs = loopSumUs = loopCount = 0;
+        }
+    }
+    replyDeadlineUs = 0;   // One reply burst per controller frame
+}
+
+// Work time of one loop() pass, without the wait for RS485 (telemetry)
+void recordLoopTime(uint32_t us) {
+    if (us > loopMaxUs) loopMaxUs = us;
+    loopSumUs += us;
+    loopCount++;
+}
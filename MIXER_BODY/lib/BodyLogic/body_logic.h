@@ -0,0 +1,61 @@
+#pragma once
+
+/*
+ * Body logic - volume, relays, Bluetooth and the MixerLink protocol side
+ *
+ * Plain C++ on top of body_hal.h, so the same code runs on the ESP32 and in
+ * MixerSim on the host. The JSON fallback parser stays in main.cpp
+ * (ArduinoJson) and calls applyState() / applyShutdown() from here.
+ */
+
+#include <stdint.h>
+#include <mixer_link.h>
+
+#define BODY_RAMP_STEP_US     (2000)   // 1 dB per step: 500 dB/s, full scale (79 dB) in 158 ms
+#define BODY_RELAY_SETTLE_MS  (50)     // Pair muted this long before its relay switches
+
+// ------------------- STATE -------------------
+extern int currentMusicVol;     // 0-100 from Controller
+extern int currentMicVol;       // 0-100 from Controller
+extern bool relayMusicState;    // logic from Controller
+extern bool relayMicState;      // logic from Controller
+extern bool isBluetoothActive;
+extern bool systemSleeping;     // Set true when pwr:0 received
+
+// Counters (debug 'r')
+extern uint8_t rxLastSeq;
+extern uint32_t acksSent;
+extern uint32_t naksSent;
+extern uint32_t staleFields;
+extern uint32_t repliesMissed;
+extern uint32_t telemetrySent;
+extern uint16_t i2cErrors;
+extern uint32_t i2cWrites;
+extern uint32_t i2cSkipped;
+extern uint32_t relaySwitches;
+
+// Volume slew rate, us per 1 dB step (BODY_RAMP_STEP_US)
+extern uint32_t rampStepUs;
+
+// ------------------- LOGIC -------------------
+void pt2258Reset();             // Clear, then every register is rewritten on the next update
+void updateVolume();            // Ramp positions, changed registers only
+void updateRelays();            // Drives the pins at once, see serviceRamp()
+void applyState();
+void applyShutdown();            // Fades out, then stops Bluetooth and resets the relays
+void wakeIfSleeping();
+
+// loop(): next 1 dB step toward the targets; a relay change fades its
+// channels out, switches after BODY_RELAY_SETTLE_MS, and fades them back in
+void serviceRamp();
+bool rampActive();
+uint32_t rampWaitUs(uint32_t max_us);   // Until serviceRamp() has work, at most max_us
+
+// MixerLink frame from the controller, `rx_time_us` = its UART RX event
+void handleLinkFrame(const MixerLinkFrame& frame, int64_t rx_time_us);
+
+// Reply slot of the last controller frame: telemetry if due
+void sendTelemetry();
+
+// Work time of one loop() pass (telemetry)
+void recordLoopTime(uint32_t us);
@@ -2,6 +2,13 @@
 #include <ArduinoJson.h>
 #include <Wire.h>
 #include "BluetoothA2DPSink.h"
+#include <mixer_link.h>
+#include <mixer_link_rx.h>
+#include <mixer_link_uart.h>
+#include <esp_timer.h>
+#include <stdarg.h>
+#include "body_logic.h"
+#include "body_hal.h"
 
 // ------------------- PIN DEFINITIONS (V2) -------------------
 // RS485
@@ -25,105 +32,39 @@
 
 // ------------------- OBJECTS -------------------
 BluetoothA2DPSink a2dp_sink;
+MixerLinkUart rs485;    // Event-driven RS485 receiver (RX task + message queue)
 
-// ------------------- STATE -------------------
-int currentMusicVol = 0; // 0-100 from Controller
-int currentMicVol = 0;   // 0-100 from Controller
-bool relayMusicState = false; // logic from Controller
-bool relayMicState = false;   // logic from Controller
-
-// Bluetooth State
-bool isBluetoothActive = false;
-bool systemSleeping = false;  // Set true when pwr:0 received
-
-// ------------------- PT2258 DRIVER -------------------
-void pt2258_write(byte data) {
+// ------------------- HARDWARE (body_hal.h) -------------------
+bool hal_pt2258_write(const uint8_t *data, size_t len) {
     Wire.beginTransmission(PT2258_ADDR);
-    Wire.write(data);
-    byte error = Wire.endTransmission();
-    if (error) {
-        // Serial.printf("[I2C ERROR] %d\n", error); // Optional: checking error
-    }
+    Wire.write(data, len);
+    return Wire.endTransmission() == 0;   // Counted by body_logic (i2cErrors)
 }
 
-// Helper to set volume for specific channel pair
-// 0-100 input -> 79-0 dB attenuation
-// PT2258: -10dB step = High Nibble (X), -1dB step = Low Nibble (Y)
-// Code structure from datasheet: 
-//   1-Channel: 10dB (1<ch><ch>1 <att>), 1dB (1<ch><ch>0 <att>) - THIS VARIES BY DATASHEET VERSION
-//   Let's use the Master Volume for now if easiest, OR specific channels as verified.
-//   Standard PT2258 Channel addressing (based on commonlibs):
-//   Ch1 (Vol1): 0x80 / 0x90
-//   Ch2 (Vol2): 0x40 / 0x50
-//   Ch3 (Vol3): 0x00 / 0x10
-//   Ch4 (Vol4): 0x20 / 0x30
-//   Ch5 (Vol5): 0x60 / 0x70
-//   Ch6 (Vol6): 0xA0 / 0xB0
-//   Master:     0xD0 / 0xE0
-//
-//   Mapping from "Pins.txt":
-//   Ch1, Ch2 -> Music
-//   Ch3, Ch4 -> Mic
-
-void setChannelVolume(int ch_10db_base, int ch_1db_base, int volume0to100) {
-    // Map 0-100 to 79-0 attenuation
-    // 100 -> 0 dB (Loudest)
-    // 0   -> 79 dB (Quiet)
-    int attenuation = map(volume0to100, 0, 100, 79, 0);
-    if (attenuation < 0) attenuation = 0;
-    if (attenuation > 79) attenuation = 79;
-    
-    int tens = attenuation / 10;
-    int ones = attenuation % 10;
-
-    pt2258_write(ch_10db_base | tens);
-    pt2258_write(ch_1db_base  | ones);
+void hal_relay_write(BodyRelay relay, bool high) {
+    digitalWrite(relay == BODY_RELAY_MUSIC ? PIN_RELAY_MUSIC : PIN_RELAY_MIC, high ? HIGH : LOW);
 }
 
-void updateVolume() {
-    // Music (Channels 1 & 2)
-    // Ch1 (L): 0x80/0x90
-    setChannelVolume(0x80, 0x90, currentMusicVol);
-    // Ch2 (R): 0x40/0x50
-    setChannelVolume(0x40, 0x50, currentMusicVol);
-
-    // Mic (Channels 3 & 4)
-    // Ch3 (L): 0x00/0x10
-    setChannelVolume(0x00, 0x10, currentMicVol);
-    // Ch4 (R): 0x20/0x30
-    setChannelVolume(0x20, 0x30, currentMicVol);
-}
+void hal_bt_start() { a2dp_sink.start("Mixer Audio"); }
+void hal_bt_end() { a2dp_sink.end(); }
+bool hal_bt_connected() { return a2dp_sink.is_connected(); }
 
-// ------------------- LOGIC -------------------
+void hal_link_write(const uint8_t *data, size_t len) { rs485.write(data, len); }
 
-void updateRelays() {
-    // Logic:
-    // Music Relay (33): LOW = Bluetooth (NC), HIGH = Line-In (NO).
-    // relayMusicState == 1 (from Controller) => Bluetooth Mode.
-    if (relayMusicState) {
-        // Bluetooth
-        digitalWrite(PIN_RELAY_MUSIC, LOW); 
-        if (!isBluetoothActive) {
-            Serial.println("Starting Bluetooth...");
-            a2dp_sink.start("Mixer Audio");
-            isBluetoothActive = true;
-        }
-    } else {
-        // Line-In
-        digitalWrite(PIN_RELAY_MUSIC, HIGH);
-        if (isBluetoothActive) {
-            Serial.println("Stopping Bluetooth...");
-            a2dp_sink.end(); 
-            isBluetoothActive = false;
-        }
-    }
+int64_t hal_now_us() { return esp_timer_get_time(); }
+uint32_t hal_millis() { return millis(); }
 
-    // Mic Relay (14)
-    // relayMicState == 1 => Wireless (High), 0 => Wired (Low) [Assumption based on previous code]
-    digitalWrite(PIN_RELAY_MIC, relayMicState ? HIGH : LOW);
+void hal_log(const char *fmt, ...) {
+    char buf[160];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    Serial.print(buf);
 }
 
-void processPacket(String& input) {
+// JSON fallback format: {"mv":80,"cv":50,"mr":1,"cr":1} or {"pwr":0}
+void processPacket(const char* input) {
     StaticJsonDocument<200> doc;
     DeserializationError error = deserializeJson(doc, input);
 
@@ -135,46 +76,56 @@ void processPacket(String& input) {
     
     // --- SHUTDOWN COMMAND ---
     if (doc.containsKey("pwr") && doc["pwr"] == 0) {
-        Serial.println(">>> SHUTDOWN command received <<<");
-        
-        // 1. Mute all volume channels
-        currentMusicVol = 0;
-        currentMicVol = 0;
-        updateVolume();
-        
-        // 2. Stop Bluetooth
-        if (isBluetoothActive) {
-            Serial.println("Stopping Bluetooth (shutdown)...");
-            a2dp_sink.end();
-            isBluetoothActive = false;
-        }
-        
-        // 3. Reset relays to default (Line-In, Wired Mic)
-        relayMusicState = false;
-        relayMicState = false;
-        updateRelays();
-        
-        systemSleeping = true;
-        Serial.println("System sleeping. Waiting for heartbeat to wake up.");
+        applyShutdown();
         return;
     }
     
     // --- NORMAL COMMAND (heartbeat / manual) ---
-    if (systemSleeping) {
-        Serial.println(">>> WAKE UP: Heartbeat received <<<");
-        systemSleeping = false;
-    }
+    wakeIfSleeping();
     
     if (doc.containsKey("mv")) currentMusicVol = doc["mv"];
     if (doc.containsKey("cv")) currentMicVol = doc["cv"];
     if (doc.containsKey("mr")) relayMusicState = doc["mr"] == 1;
     if (doc.containsKey("cr")) relayMicState = doc["cr"] == 1;
 
-    Serial.printf("Upd: MusV=%d MicV=%d MusR=%d MicR=%d\n", 
-                  currentMusicVol, currentMicVol, relayMusicState, relayMicState);
+    applyState();
+}
 
-    updateRelays();
-    updateVolume();
+void handleRS485(const MixerLinkRxItem& item) {
+    if (item.msg.kind == MIXER_LINK_MSG_FRAME) {
+        handleLinkFrame(item.msg.frame, item.rx_time_us);
+    } else {
+        Serial.print("[RS485 RX]: ");
+        Serial.println(item.msg.line);
+        processPacket(item.msg.line);
+    }
+    rs485.markHandled(item);
+}
+
+void printRxStats() {
+    const MixerLinkRxStats &st = rs485.parserStats();
+    const MixerLinkUartStats &us = rs485.stats();
+    Serial.printf("RS485 RX: frames=%u lines=%u crc=%u hdr=%u drop=%u long=%u overrun=%u worst_feed=%uus\n",
+                  st.frames, st.lines, st.crc_errors, st.header_errors, st.dropped_bytes,
+                  st.line_overflows, st.ring_overruns, us.worst_feed_us);
+    Serial.printf("RS485 UART: events=%u fifo_ovf=%u queue_drop=%u\n",
+                  us.events, us.fifo_overflows, us.queue_drops);
+    Serial.printf("RS485 seq: last=%u ack=%u nak=%u stale=%u\n",
+                  rxLastSeq, acksSent, naksSent, staleFields);
+    Serial.printf("RS485 TX: telemetry=%u missed_slot=%u\n", telemetrySent, repliesMissed);
+    Serial.printf("PT2258: i2c_writes=%u skipped=%u i2c_err=%u\n", i2cWrites, i2cSkipped, i2cErrors);
+    Serial.printf("Ramp: step=%uus active=%d relay_switches=%u\n", rampStepUs, rampActive(), relaySwitches);
+
+    // Wire-to-action latency: UART event -> message applied
+    const MixerLinkHistogram &h = rs485.latency();
+    Serial.printf("RS485 latency: n=%u avg=%uus max=%uus\n", h.total, h.avg_us(), h.max_us);
+    for (uint32_t i = 0; i < MIXER_LINK_HIST_BUCKETS; i++) {
+        if (i < MIXER_LINK_HIST_BUCKETS - 1) {
+            Serial.printf("  <%6uus: %u\n", MixerLinkHistogram::bound(i), h.counts[i]);
+        } else {
+            Serial.printf("  >=%5uus: %u\n", MixerLinkHistogram::bound(i - 1), h.counts[i]);
+        }
+    }
 }
 
 // ------------------- SETUP -------------------
@@ -188,15 +139,16 @@ void setup() {
     digitalWrite(PIN_RELAY_MUSIC, HIGH); // Default to Line-In (HIGH)
     digitalWrite(PIN_RELAY_MIC, LOW);
 
-    // RS485
-    Serial2.begin(115200, SERIAL_8N1, RS485_RX, RS485_TX);
-    pinMode(RS485_DE, OUTPUT);
-    digitalWrite(RS485_DE, LOW); 
+    // RS485 (ESP-IDF UART driver, RX task on core 0 next to the BT stack)
+    // DE is driven by the driver: high only while an ACK/NAK is on the wire
+    if (!rs485.begin(UART_NUM_2, 115200, RS485_RX, RS485_TX, 0, RS485_DE)) {
+        Serial.println("RS485 init failed!");
+    }
 
     // I2C Volume
     Wire.begin(I2C_SDA, I2C_SCL);
     delay(100);
-    pt2258_write(0xC0); // Clear / Reset
+    pt2258Reset(); // Clear / Reset
     delay(200);
     updateVolume(); // Apply initial 0-0 volume
 
@@ -253,34 +205,55 @@ void handleSerialDebug() {
                 changed = true;
                 Serial.printf("cmd: Music Vol %d\n", currentMusicVol);
                 break;
+            case '<': // Slower volume ramp
+                if (rampStepUs < 20000) rampStepUs *= 2;
+                Serial.printf("cmd: Ramp %uus/dB\n", rampStepUs);
+                break;
+            case '>': // Faster volume ramp
+                if (rampStepUs > 500) rampStepUs /= 2;
+                Serial.printf("cmd: Ramp %uus/dB\n", rampStepUs);
+                break;
+            case 'r': // RS485 receiver statistics
+            case 'R':
+                printRxStats();
+                break;
+            case 'z': // Reset RS485 latency histogram
+            case 'Z':
+                rs485.resetLatency();
+                Serial.println("cmd: RS485 latency reset");
+                break;
         }
 
         if (changed) {
-            updateRelays();
-            updateVolume();
+            serviceRamp();   // Fades like a controller update
         }
     }
 }
 
 // ------------------- LOOP -------------------
 void loop() {
-    // RS485 Listener
-    if (Serial2.available()) {
-        // Debug: Read raw character to see if anything arrives
-        char c = Serial2.peek();
-        // Serial.printf("[DEBUG RS485 RAW] 0x%02X (%c)\n", c, c); // Optional: very verbose
-
-        String input = Serial2.readStringUntil('\n');
-        input.trim();
-        if (input.length() > 0) {
-            Serial.print("[RS485 RX]: ");
-            Serial.println(input);
-            processPacket(input);
+    // RS485 Listener: blocks on the RX queue instead of a fixed delay,
+    // so a command is applied as soon as the RX task posts it.
+    // Wakes earlier for the next volume ramp step.
+    MixerLinkRxItem item;
+    uint32_t wait_ms = (rampWaitUs(10000) + 999) / 1000;
+    bool received = rs485.receive(item, pdMS_TO_TICKS(wait_ms));
+    uint32_t t0 = micros();   // Loop timing excludes the wait
+    if (received) {
+        handleRS485(item);
+        while (rs485.receive(item, 0)) {
+            handleRS485(item);
         }
     }
+
+    // Volume ramp / relay fade
+    serviceRamp();
+    
+    // Telemetry back to the controller (reply slot only)
+    sendTelemetry();
     
     // USB Serial Debug Listener
     handleSerialDebug();
 
-    delay(10);
+    recordLoopTime(micros() - t0);
 }
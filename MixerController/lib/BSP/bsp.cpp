@@ -5,7 +5,22 @@
  * Key architecture:
  * - Board object handles LCD, Touch, IO Expander, Backlight
  * - LVGL runs in its own FreeRTOS task with mutex protection
- * - Anti-tearing mode 3: double buffer + direct mode
+ * - Render mode picked at boot (BspRenderMode), default direct mode:
+ *   double buffer + direct mode (anti-tearing mode 3)
+ * - Direct mode writes only dirty areas to either frame buffer: LVGL (8.4)
+ *   renders them into the back buffer and copies the previous frame's dirty
+ *   areas over from the front buffer first (refr_sync_areas), minus what it
+ *   is about to redraw
+ * - Tiles mode renders into internal SRAM and leaves the PSRAM writes to
+ *   GDMA (async memcpy), so the CPU is off the PSRAM bus while it renders
+ * - Bytes, render and flush time per frame are measured for every mode,
+ *   stage times (handler, render, flush, VSync wait, lock wait) go into
+ *   fixed-bucket histograms, optionally shown in an on-screen overlay
+ * - The LVGL task sleeps until something needs it (a due LVGL timer, touch
+ *   interrupt, another task unlocking LVGL); while frames are due it runs
+ *   once per VSync instead of polling, and not at all while the display is off
+ * - Touch is read from the GT911 on its INT only (touch task), LVGL reads the
+ *   queued samples; touch to LVGL and touch to frame latency are measured
  * - Bounce buffer for PSRAM bandwidth optimization
  */
 
@@ -13,31 +28,121 @@
 #include <esp_display_panel.hpp>
 #include <lvgl.h>
 #include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_async_memcpy.h"
+#include "esp_cache.h"
+#include "esp_idf_version.h"
+#include <atomic>
 
 using namespace esp_panel::drivers;
 using namespace esp_panel::board;
 
 // ---- Constants ----
 #define LVGL_PORT_TICK_PERIOD_MS        (2)
-#define LVGL_PORT_TASK_MAX_DELAY_MS     (500)
-#define LVGL_PORT_TASK_MIN_DELAY_MS     (2)
+#define LVGL_PORT_VSYNC_TIMEOUT_MS      (100)   // Waiting for a VSync wakeup (panel stalled: run anyway)
+#define TOUCH_TASK_STACK_SIZE           (4 * 1024)
+#define TOUCH_TASK_PRIORITY             (LVGL_PORT_TASK_PRIORITY + 1)
+#define TOUCH_QUEUE_LEN                 (8)     // Samples between two LVGL reads (a quick tap is press + release)
+#define TOUCH_RELEASE_TIMEOUT_MS        (50)    // Pressed and no GT911 report for this long: read the release
+#define TOUCH_LATENCY_MAX_US            (250000)  // Touch to frame: longer is a touch that redrew nothing
 #define LVGL_PORT_TASK_STACK_SIZE       (6 * 1024)
 #define LVGL_PORT_TASK_PRIORITY         (2)
 #define LVGL_PORT_BUFFER_NUM_MAX        (2)
+#define LVGL_PORT_TILE_ALIGN_PX         (32)    // Tiles mode: 64-byte rows, the GDMA / PSRAM cache line
 
 // ---- Static globals ----
 static Board *board = nullptr;
 static SemaphoreHandle_t lvgl_mux = nullptr;
 static TaskHandle_t lvgl_task_handle = nullptr;
+static SemaphoreHandle_t lvgl_wake = nullptr;  // Given by every wakeup source, the LVGL task sleeps on it
 static void *lvgl_buf[LVGL_PORT_BUFFER_NUM_MAX] = {};
+static BspRenderMode render_mode = BSP_RENDER_DIRECT;
+
+// Triple buffering: buffer on screen, buffer queued for the next VSync, and
+// the free one LVGL renders the frame after into (swapped by the VSync ISR)
+static void *volatile lcd_last_buf = nullptr;
+static void *volatile lcd_next_buf = nullptr;
+static void *volatile flush_next_buf = nullptr;
+
+// Tiles mode: GDMA copies of the band in flight (one per row, or one for a
+// full-width band), LVGL gets the band back when the last one is done
+static async_memcpy_handle_t tile_dma = nullptr;
+static std::atomic<uint32_t> tile_copies_left{0};
+static void *tile_sync_start = nullptr;    // Frame buffer rows of the band, whole cache lines
+static size_t tile_sync_bytes = 0;
+
+// Frame statistics (LVGL task, read under the LVGL lock)
+static BspFlushStats flush_stats = {};
+static uint32_t frame_bytes = 0;            // Refresh in progress: sync copy + render
+static uint32_t frame_flush_us = 0;         // Refresh in progress: time in flush callbacks
+static uint32_t frame_vsync_us = 0;         // Refresh in progress: waiting for VSync
+static BspFrameTiming frame_timing;         // Recorded under the LVGL lock
+static void (*lvgl_buffer_copy)(lv_draw_ctx_t *draw_ctx, void *dest_buf, lv_coord_t dest_stride,
+                                const lv_area_t *dest_area, void *src_buf, lv_coord_t src_stride,
+                                const lv_area_t *src_area) = nullptr;
+static lv_timer_cb_t lvgl_refr_timer_cb = nullptr;
+static lv_timer_cb_t lvgl_indev_timer_cb = nullptr;
+
+// LVGL task wakeups: why the task woke up (bits), set by the ISRs and other
+// tasks, taken by the LVGL task
+enum : uint32_t {
+    WAKE_VSYNC = 1 << 0,
+    WAKE_TOUCH = 1 << 1,
+    WAKE_UI    = 1 << 2,
+    WAKE_TIMER = 1 << 3,    // Wait timed out: an LVGL timer is due
+};
+static std::atomic<uint32_t> wake_reasons{0};
+static std::atomic<bool> vsync_wake_armed{false};   // Next VSync wakes the LVGL task
+static std::atomic<bool> display_active{true};      // false: no rendering, no touch polling
+static volatile uint32_t vsync_period_us = 0;       // Measured by the VSync ISR
+static int64_t vsync_last_us = 0;
+// Interrupt-driven touch: the touch task reads the GT911 on INT and queues
+// the samples, the LVGL indev reads the queue (no I2C in the LVGL task)
+struct TouchSample {
+    int16_t x, y;
+    bool pressed;
+    int64_t irq_us;                 // INT that led to this read
+};
+static QueueHandle_t touch_queue = nullptr;
+static SemaphoreHandle_t touch_irq_sem = nullptr;
+static std::atomic<int64_t> touch_irq_us{0};        // First INT since the last read
+static std::atomic<uint32_t> touch_reads{0};        // GT911 I2C reads
+static int64_t touch_frame_us = 0;                  // Oldest touch sample LVGL read that no frame showed yet
+
+static const char *const render_mode_names[BSP_RENDER_MODE_COUNT] = {
+    "direct", "full-double", "full-triple", "partial", "tiles",
+};
+
+// LCD frame buffers each mode needs (configured before the panel starts)
+static const uint8_t render_mode_fbs[BSP_RENDER_MODE_COUNT] = { 2, 2, 3, 1, 1 };
 
 // ======================================================================
-// LVGL Flush Callback (Anti-tearing Mode 3: Direct Mode + Double Buffer)
+// LVGL Flush Callbacks (one per render mode)
 // ======================================================================
 
-static void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+// Bytes one flush wrote to the frame buffer, closes the frame on its last area
+static void flush_account(lv_disp_drv_t *drv, const lv_area_t *area)
 {
+    uint32_t area_pixels = lv_area_get_size(area);
+    flush_stats.render_bytes += area_pixels * sizeof(lv_color_t);
+    frame_bytes += area_pixels * sizeof(lv_color_t);
+    if (area_pixels == (uint32_t)drv->hor_res * drv->ver_res) flush_stats.full_frames++;
+
+    if (lv_disp_flush_is_last(drv)) {
+        flush_stats.frames++;
+        flush_stats.last_frame_bytes = frame_bytes;
+        if (frame_bytes > flush_stats.max_frame_bytes) flush_stats.max_frame_bytes = frame_bytes;
+        frame_bytes = 0;
+    }
+}
+
+// Direct mode and double-buffered full refresh: LVGL rendered straight into
+// a frame buffer, show it and wait until the other one is off screen
+static void flush_switch_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    int64_t t0 = esp_timer_get_time();
     LCD *lcd = (LCD *)drv->user_data;
+    flush_account(drv, area);
 
     /* Action after last area refresh */
     if (lv_disp_flush_is_last(drv)) {
@@ -45,13 +150,270 @@ static void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
         lcd->switchFrameBufferTo(color_map);
 
         /* Waiting for the last frame buffer to complete transmission */
+        int64_t wait_t0 = esp_timer_get_time();
         ulTaskNotifyValueClear(NULL, ULONG_MAX);
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        frame_vsync_us += (uint32_t)(esp_timer_get_time() - wait_t0);
     }
 
+    frame_flush_us += (uint32_t)(esp_timer_get_time() - t0);
+    lv_disp_flush_ready(drv);
+}
+
+// Triple-buffered full refresh: queue `color_map` for the next VSync and
+// render on into the free buffer, no waiting
+static void flush_triple_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    int64_t t0 = esp_timer_get_time();
+    LCD *lcd = (LCD *)drv->user_data;
+    flush_account(drv, area);
+
+    drv->draw_buf->buf1 = color_map;
+    drv->draw_buf->buf2 = flush_next_buf;
+    flush_next_buf = color_map;
+
+    /* Switch the current LCD frame buffer to `color_map` */
+    lcd->switchFrameBufferTo(color_map);
+    lcd_next_buf = color_map;
+
+    frame_flush_us += (uint32_t)(esp_timer_get_time() - t0);
+    lv_disp_flush_ready(drv);
+}
+
+// Partial: copy the rendered SRAM band into the frame buffer
+static void flush_band_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    int64_t t0 = esp_timer_get_time();
+    LCD *lcd = (LCD *)drv->user_data;
+    flush_account(drv, area);
+
+    lcd->drawBitmap(area->x1, area->y1, area->x2 - area->x1 + 1, area->y2 - area->y1 + 1,
+                    (const uint8_t *)color_map);
+
+    /* RGB LCD: the band is copied when drawBitmap() returns */
+    frame_flush_us += (uint32_t)(esp_timer_get_time() - t0);
     lv_disp_flush_ready(drv);
 }
 
+// Tiles: queue the band to GDMA and return, LVGL renders the next band
+// into the other SRAM buffer meanwhile (lv_disp_flush_ready from the ISR)
+
+// Band copied: GDMA wrote its rows behind the cache, drop any lines the CPU
+// still holds for them so the bounce buffer copy reads the new pixels
+static IRAM_ATTR void tile_band_done(lv_disp_drv_t *drv)
+{
+    esp_cache_msync(tile_sync_start, tile_sync_bytes, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+    lv_disp_flush_ready(drv);
+}
+
+static IRAM_ATTR bool tile_copy_done(async_memcpy_handle_t mcp, async_memcpy_event_t *event, void *cb_args)
+{
+    if (tile_copies_left.fetch_sub(1) == 1) {
+        tile_band_done((lv_disp_drv_t *)cb_args);
+    }
+    return false;
+}
+
+static void flush_tile_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    int64_t t0 = esp_timer_get_time();
+    LCD *lcd = (LCD *)drv->user_data;
+    flush_account(drv, area);
+
+    uint32_t w = lv_area_get_width(area);
+    uint32_t rows = lv_area_get_height(area);
+    uint16_t *fb = (uint16_t *)lcd->getFrameBufferByIndex(0);
+    uint16_t *dst = fb + area->y1 * drv->hor_res + area->x1;
+    uint16_t *src = (uint16_t *)color_map;
+
+    // Full-width band is contiguous in the frame buffer: one copy
+    uint32_t copies = (w == drv->hor_res) ? 1 : rows;
+    uint32_t copy_bytes = (copies == 1) ? w * rows * sizeof(lv_color_t) : w * sizeof(lv_color_t);
+
+    // Rows the band covers, out to whole cache lines (the rounder keeps tiles
+    // on line boundaries, this only guards the edges)
+    const uintptr_t line = LVGL_PORT_TILE_ALIGN_PX * sizeof(lv_color_t);
+    uintptr_t sync_start = (uintptr_t)dst & ~(line - 1);
+    uintptr_t sync_end = ((uintptr_t)(dst + (rows - 1) * drv->hor_res + w) + line - 1) & ~(line - 1);
+    tile_sync_start = (void *)sync_start;
+    tile_sync_bytes = sync_end - sync_start;
+
+    // +1 holds the band until every copy is queued
+    tile_copies_left.store(copies + 1);
+    for (uint32_t i = 0; i < copies; i++) {
+        uint32_t row = (copies == 1) ? 0 : i;
+        if (esp_async_memcpy(tile_dma, dst + row * drv->hor_res, src + row * w, copy_bytes,
+                             tile_copy_done, drv) != ESP_OK) {
+            // Queue refused: the CPU copies the rest (drawBitmap keeps the cache coherent)
+            lcd->drawBitmap(area->x1, area->y1 + row, w, rows - row, (const uint8_t *)(src + row * w));
+            flush_stats.dma_fallbacks++;
+            tile_copies_left.fetch_sub(copies - i);
+            break;
+        }
+    }
+
+    frame_flush_us += (uint32_t)(esp_timer_get_time() - t0);
+    if (tile_copies_left.fetch_sub(1) == 1) {
+        tile_band_done(drv);
+    }
+}
+
+// ======================================================================
+// Back buffer sync (LVGL copies the previous frame's dirty areas)
+// ======================================================================
+
+static void counting_buffer_copy(lv_draw_ctx_t *draw_ctx, void *dest_buf, lv_coord_t dest_stride,
+                                 const lv_area_t *dest_area, void *src_buf, lv_coord_t src_stride,
+                                 const lv_area_t *src_area)
+{
+    uint32_t bytes = lv_area_get_size(dest_area) * sizeof(lv_color_t);
+    flush_stats.sync_bytes += bytes;
+    frame_bytes += bytes;
+    lvgl_buffer_copy(draw_ctx, dest_buf, dest_stride, dest_area, src_buf, src_stride, src_area);
+}
+
+// ======================================================================
+// Refresh timing (wraps LVGL's display refresh timer)
+// ======================================================================
+
+static void timed_refr_timer(lv_timer_t *timer)
+{
+    uint32_t frames = flush_stats.frames;
+    frame_flush_us = 0;
+    frame_vsync_us = 0;
+    int64_t t0 = esp_timer_get_time();
+
+    lvgl_refr_timer_cb(timer);
+
+    /* Nothing was invalid: no frame */
+    if (flush_stats.frames == frames) return;
+    uint32_t frame_us = (uint32_t)(esp_timer_get_time() - t0);
+    flush_stats.flush_us += frame_flush_us;
+    flush_stats.render_us += frame_us - frame_flush_us;
+    if (frame_us > flush_stats.max_frame_us) flush_stats.max_frame_us = frame_us;
+
+    frame_timing.render.record(frame_us - frame_flush_us);
+    frame_timing.flush.record(frame_flush_us);
+    if (frame_vsync_us) frame_timing.vsync.record(frame_vsync_us);
+
+    /* First frame after a touch sample was read: touch to pixel */
+    if (touch_frame_us) {
+        uint32_t touch_us = (uint32_t)(esp_timer_get_time() - touch_frame_us);
+        if (touch_us < TOUCH_LATENCY_MAX_US) frame_timing.touch_frame.record(touch_us);
+        touch_frame_us = 0;
+    }
+}
+
+// ======================================================================
+// Touch input (GT911 INT, touch task, sample queue)
+// ======================================================================
+
+// GT911 INT: a new report is ready, wake the touch task
+static IRAM_ATTR bool onTouchInterruptCallback(void *user_data)
+{
+    BaseType_t need_yield = pdFALSE;
+    if (display_active.load()) {
+        int64_t none = 0;
+        touch_irq_us.compare_exchange_strong(none, esp_timer_get_time());
+        xSemaphoreGiveFromISR(touch_irq_sem, &need_yield);
+    }
+    return (need_yield == pdTRUE);
+}
+
+// Reads the GT911 once per report and queues the sample for LVGL
+static void touch_task(void *arg)
+{
+    Touch *tp = (Touch *)arg;
+    TouchSample sample = {};        // Released at the last pressed point
+
+    while (1) {
+        // While pressed GT911 reports every scan; no report for a while means
+        // the release report was missed, read once to get it
+        if (xSemaphoreTake(touch_irq_sem, sample.pressed ? pdMS_TO_TICKS(TOUCH_RELEASE_TIMEOUT_MS) : portMAX_DELAY) != pdTRUE
+            && !sample.pressed) {
+            continue;
+        }
+
+        if (display_active.load()) {
+            TouchPoint point;
+            int read_result = tp->readPoints(&point, 1, 0);
+            touch_reads.fetch_add(1);
+            sample.pressed = (read_result > 0);
+            if (sample.pressed) {
+                sample.x = point.x;
+                sample.y = point.y;
+            }
+        } else {
+            sample.pressed = false;     // Suspended: no reads, a press in progress ends here
+        }
+        sample.irq_us = touch_irq_us.exchange(0);
+        if (!sample.irq_us) sample.irq_us = esp_timer_get_time();
+
+        // Full: LVGL is behind, drop the oldest sample
+        if (xQueueSend(touch_queue, &sample, 0) != pdTRUE) {
+            TouchSample oldest;
+            xQueueReceive(touch_queue, &oldest, 0);
+            xQueueSend(touch_queue, &sample, 0);
+        }
+        wake_reasons.fetch_or(WAKE_TOUCH);
+        xSemaphoreGive(lvgl_wake);
+    }
+}
+
+// Wraps LVGL's read timer: stop reading once released, no scroll throw left
+// and nothing queued (the touch task wakes the LVGL task on the next sample)
+static void idle_indev_timer(lv_timer_t *timer)
+{
+    lvgl_indev_timer_cb(timer);
+
+    lv_indev_t *indev = (lv_indev_t *)timer->user_data;
+    if (indev->proc.state == LV_INDEV_STATE_RELEASED && !indev->proc.types.pointer.scroll_obj &&
+        !uxQueueMessagesWaiting(touch_queue)) {
+        lv_timer_pause(timer);
+    }
+}
+
+// ======================================================================
+// Timing overlay (top layer, refreshed every 500 ms)
+// ======================================================================
+
+#define TIMING_OVERLAY_PERIOD_MS    (500)
+
+static lv_obj_t *timing_label = nullptr;
+static lv_timer_t *timing_timer = nullptr;
+
+// Totals at the last overlay update: the overlay shows the last period
+static uint32_t last_frames = 0, last_vsync_n = 0, last_lock_n = 0;
+static uint64_t last_render_us = 0, last_flush_us = 0, last_vsync_us = 0;
+
+static void timing_overlay_rebase()
+{
+    last_frames = frame_timing.render.total;
+    last_render_us = frame_timing.render.sum_us;
+    last_flush_us = frame_timing.flush.sum_us;
+    last_vsync_n = frame_timing.vsync.total;
+    last_vsync_us = frame_timing.vsync.sum_us;
+    last_lock_n = frame_timing.lock.total;
+}
+
+static void timing_overlay_update(lv_timer_t *timer)
+{
+    uint32_t frames = frame_timing.render.total - last_frames;
+    uint32_t div = frames ? frames : 1;
+    uint32_t render_us = (uint32_t)((frame_timing.render.sum_us - last_render_us) / div);
+    uint32_t flush_us = (uint32_t)((frame_timing.flush.sum_us - last_flush_us) / div);
+    uint32_t vsync_n = frame_timing.vsync.total - last_vsync_n;
+    uint32_t vsync_us = (uint32_t)((frame_timing.vsync.sum_us - last_vsync_us) / (vsync_n ? vsync_n : 1));
+
+    lv_label_set_text_fmt(timing_label, "%u fps  render %u.%ums  flush %u.%ums  vsync %u.%ums  lock waits %u",
+                          (unsigned)(frames * 1000 / TIMING_OVERLAY_PERIOD_MS),
+                          (unsigned)(render_us / 1000), (unsigned)(render_us / 100 % 10),
+                          (unsigned)(flush_us / 1000), (unsigned)(flush_us / 100 % 10),
+                          (unsigned)(vsync_us / 1000), (unsigned)(vsync_us / 100 % 10),
+                          (unsigned)(frame_timing.lock.total - last_lock_n));
+    timing_overlay_rebase();
+}
+
 // ======================================================================
 // VSync Callback (notifies LVGL task that frame transmission is done)
 // ======================================================================
@@ -59,8 +421,24 @@ static void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
 IRAM_ATTR bool onLcdVsyncCallback(void *user_data)
 {
     BaseType_t need_yield = pdFALSE;
-    TaskHandle_t task_handle = (TaskHandle_t)user_data;
-    xTaskNotifyFromISR(task_handle, ULONG_MAX, eNoAction, &need_yield);
+    int64_t now = esp_timer_get_time();
+    if (vsync_last_us) vsync_period_us = (uint32_t)(now - vsync_last_us);
+    vsync_last_us = now;
+    if (vsync_wake_armed.exchange(false)) {
+        wake_reasons.fetch_or(WAKE_VSYNC);
+        xSemaphoreGiveFromISR(lvgl_wake, &need_yield);
+    }
+
+    if (render_mode == BSP_RENDER_FULL_TRIPLE) {
+        /* The queued buffer is on screen now, the previous one is free for LVGL */
+        if (lcd_next_buf != lcd_last_buf) {
+            flush_next_buf = lcd_last_buf;
+            lcd_last_buf = lcd_next_buf;
+        }
+    } else {
+        TaskHandle_t task_handle = (TaskHandle_t)user_data;
+        xTaskNotifyFromISR(task_handle, ULONG_MAX, eNoAction, &need_yield);
+    }
     return (need_yield == pdTRUE);
 }
 
@@ -73,6 +451,9 @@ static void rounder_callback(lv_disp_drv_t *drv, lv_area_t *area)
     LCD *lcd = (LCD *)drv->user_data;
     uint8_t x_align = lcd->getBasicAttributes().basic_bus_spec.x_coord_align;
     uint8_t y_align = lcd->getBasicAttributes().basic_bus_spec.y_coord_align;
+    if (render_mode == BSP_RENDER_TILES && x_align < LVGL_PORT_TILE_ALIGN_PX) {
+        x_align = LVGL_PORT_TILE_ALIGN_PX;  // Whole cache lines per row for the GDMA copy
+    }
 
     if (x_align > 1) {
         area->x1 &= ~(x_align - 1);
@@ -100,30 +481,118 @@ static lv_disp_t *display_init(LCD *lcd)
 
     auto lcd_width = lcd->getFrameWidth();
     auto lcd_height = lcd->getFrameHeight();
-
-    // Anti-tearing: use LCD frame buffers directly (in PSRAM, managed by driver)
     int buffer_size = lcd_width * lcd_height;
-    for (int i = 0; i < LVGL_PORT_DISP_BUFFER_NUM && i < LVGL_PORT_BUFFER_NUM_MAX; i++) {
-        lvgl_buf[i] = lcd->getFrameBufferByIndex(i);
+
+    lv_disp_drv_init(&disp_drv);
+
+    switch (render_mode) {
+    case BSP_RENDER_PARTIAL:
+        // One band in internal SRAM: flush_band_callback() copies it before
+        // returning, so a second band would never be rendered into meanwhile
+        buffer_size = lcd_width * LVGL_PORT_PARTIAL_LINES;
+        lvgl_buf[0] = heap_caps_malloc(buffer_size * sizeof(lv_color_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+        if (!lvgl_buf[0]) {
+            Serial.println("BSP: No internal RAM for the draw band, using PSRAM");
+            lvgl_buf[0] = heap_caps_malloc(buffer_size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+        }
+        if (!lvgl_buf[0]) {
+            Serial.println("BSP: ERROR - draw band allocation failed!");
+            return nullptr;
+        }
+        disp_drv.flush_cb = flush_band_callback;
+        break;
+
+    case BSP_RENDER_TILES: {
+        // Bands in internal SRAM (GDMA source), rows aligned like the frame buffer
+        buffer_size = lcd_width * LVGL_PORT_PARTIAL_LINES;
+        for (int i = 0; i < LVGL_PORT_BUFFER_NUM_MAX; i++) {
+            lvgl_buf[i] = heap_caps_aligned_alloc(LVGL_PORT_TILE_ALIGN_PX * sizeof(lv_color_t),
+                                                  buffer_size * sizeof(lv_color_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+        }
+        if (!lvgl_buf[0] || !lvgl_buf[1]) {
+            Serial.println("BSP: ERROR - no internal RAM for the draw tiles!");
+            return nullptr;
+        }
+
+        async_memcpy_config_t dma_config = ASYNC_MEMCPY_DEFAULT_CONFIG();
+        dma_config.backlog = LVGL_PORT_PARTIAL_LINES;   // One band in flight, one copy per row at most
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+        dma_config.dma_burst_size = LVGL_PORT_TILE_ALIGN_PX * sizeof(lv_color_t);
+#else
+        dma_config.psram_trans_align = LVGL_PORT_TILE_ALIGN_PX * sizeof(lv_color_t);
+        dma_config.sram_trans_align = 4;
+#endif
+        if (esp_async_memcpy_install(&dma_config, &tile_dma) != ESP_OK) {
+            Serial.println("BSP: ERROR - async memcpy (GDMA) install failed, copying with the CPU");
+            disp_drv.flush_cb = flush_band_callback;
+            break;
+        }
+
+        // Drop anything the CPU left in the cache for the frame buffer, GDMA writes
+        // behind it (each band's rows again in tile_band_done())
+        void *fb = lcd->getFrameBufferByIndex(0);
+        esp_cache_msync(fb, lcd_width * lcd_height * sizeof(lv_color_t),
+                        ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_INVALIDATE | ESP_CACHE_MSYNC_FLAG_UNALIGNED);
+        disp_drv.flush_cb = flush_tile_callback;
+        break;
+    }
+
+    case BSP_RENDER_FULL_TRIPLE:
+        // LCD starts on buffer 0, LVGL renders into 1, 2 is free
+        lcd_last_buf = lcd->getFrameBufferByIndex(0);
+        lvgl_buf[0] = lcd->getFrameBufferByIndex(1);
+        lvgl_buf[1] = lcd->getFrameBufferByIndex(2);
+        lcd_next_buf = lcd_last_buf;
+        flush_next_buf = lvgl_buf[1];
+        disp_drv.flush_cb = flush_triple_callback;
+        disp_drv.full_refresh = 1;
+        break;
+
+    case BSP_RENDER_FULL_DOUBLE:
+    case BSP_RENDER_DIRECT:
+    default:
+        // Anti-tearing: use LCD frame buffers directly (in PSRAM, managed by driver)
+        for (int i = 0; i < LVGL_PORT_BUFFER_NUM_MAX; i++) {
+            lvgl_buf[i] = lcd->getFrameBufferByIndex(i);
+        }
+        disp_drv.flush_cb = flush_switch_callback;
+        if (render_mode == BSP_RENDER_FULL_DOUBLE) {
+            disp_drv.full_refresh = 1;  // Anti-tearing mode 1
+        } else {
+            disp_drv.direct_mode = 1;   // Anti-tearing mode 3
+        }
+        break;
     }
 
     lv_disp_draw_buf_init(&disp_buf, lvgl_buf[0], lvgl_buf[1], buffer_size);
 
-    lv_disp_drv_init(&disp_drv);
-    disp_drv.flush_cb = flush_callback;
     disp_drv.hor_res = lcd_width;
     disp_drv.ver_res = lcd_height;
-    disp_drv.direct_mode = 1;      // Anti-tearing mode 3
     disp_drv.draw_buf = &disp_buf;
     disp_drv.user_data = (void *)lcd;
 
     // Rounder callback for coordinate alignment
     if ((lcd->getBasicAttributes().basic_bus_spec.x_coord_align > 1) ||
-        (lcd->getBasicAttributes().basic_bus_spec.y_coord_align > 1)) {
+        (lcd->getBasicAttributes().basic_bus_spec.y_coord_align > 1) ||
+        (render_mode == BSP_RENDER_TILES)) {
         disp_drv.rounder_cb = rounder_callback;
     }
 
-    return lv_disp_drv_register(&disp_drv);
+    lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+    if (!disp) return nullptr;
+
+    // Count the back buffer sync (only user of buffer_copy in LVGL 8.4)
+    if (disp_drv.draw_ctx && disp_drv.draw_ctx->buffer_copy) {
+        lvgl_buffer_copy = disp_drv.draw_ctx->buffer_copy;
+        disp_drv.draw_ctx->buffer_copy = counting_buffer_copy;
+    }
+
+    // Time every refresh (render + flush)
+    if (disp->refr_timer) {
+        lvgl_refr_timer_cb = disp->refr_timer->timer_cb;
+        disp->refr_timer->timer_cb = timed_refr_timer;
+    }
+    return disp;
 }
 
 // ======================================================================
@@ -145,6 +614,23 @@ static void touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
     }
 }
 
+// Interrupt-driven: the next queued sample, or the last one again
+static void touchpad_read_queued(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
+{
+    static TouchSample last = {};
+    TouchSample sample;
+
+    if (xQueueReceive(touch_queue, &sample, 0) == pdTRUE) {
+        last = sample;
+        frame_timing.touch_read.record((uint32_t)(esp_timer_get_time() - sample.irq_us));
+        if (!touch_frame_us) touch_frame_us = sample.irq_us;
+        data->continue_reading = (uxQueueMessagesWaiting(touch_queue) > 0);
+    }
+    data->point.x = last.x;
+    data->point.y = last.y;
+    data->state = last.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
 static lv_indev_t *indev_init(Touch *tp)
 {
     if (!tp || !tp->getPanelHandle()) {
@@ -158,29 +644,87 @@ static lv_indev_t *indev_init(Touch *tp)
     indev_drv_tp.read_cb = touchpad_read;
     indev_drv_tp.user_data = (void *)tp;
 
-    return lv_indev_drv_register(&indev_drv_tp);
+    lv_indev_t *indev = lv_indev_drv_register(&indev_drv_tp);
+    if (!indev) return nullptr;
+
+    // Touch interrupt: the touch task reads the GT911 on INT only, LVGL reads
+    // its queue from the first sample until release
+    touch_queue = xQueueCreate(TOUCH_QUEUE_LEN, sizeof(TouchSample));
+    touch_irq_sem = xSemaphoreCreateBinary();
+    if (touch_queue && touch_irq_sem && tp->isInterruptEnabled() &&
+        tp->attachInterruptCallback(onTouchInterruptCallback, nullptr) &&
+        xTaskCreatePinnedToCore(touch_task, "touch", TOUCH_TASK_STACK_SIZE, tp,
+                                TOUCH_TASK_PRIORITY, NULL, 1) == pdPASS) {
+        indev_drv_tp.read_cb = touchpad_read_queued;
+        lvgl_indev_timer_cb = indev_drv_tp.read_timer->timer_cb;
+        indev_drv_tp.read_timer->timer_cb = idle_indev_timer;
+        lv_timer_pause(indev_drv_tp.read_timer);
+    } else {
+        Serial.println("BSP: No touch interrupt, polling touch");
+    }
+    return indev;
 }
 
 // ======================================================================
 // LVGL Task (runs on Core 1)
 // ======================================================================
 
+// VSync wakeup: run every timer that would come due before the next VSync now,
+// so a frame is rendered right after a VSync instead of at an arbitrary tick
+static void vsync_pull_timers(uint32_t period_ms)
+{
+    for (lv_timer_t *timer = lv_timer_get_next(nullptr); timer; timer = lv_timer_get_next(timer)) {
+        if (!timer->paused && lv_tick_elaps(timer->last_run) + period_ms >= timer->period) {
+            lv_timer_ready(timer);
+        }
+    }
+}
+
 static void lvgl_port_task(void *arg)
 {
     Serial.println("BSP: LVGL task started");
-    uint32_t task_delay_ms = LVGL_PORT_TASK_MAX_DELAY_MS;
 
     while (1) {
+        uint32_t task_delay_ms = LV_NO_TIMER_READY;
         if (bsp_lvgl_lock(-1)) {
-            task_delay_ms = lv_timer_handler();
+            uint32_t reasons = wake_reasons.exchange(0);
+            if (reasons & WAKE_VSYNC) frame_timing.wake_vsync++;
+            if (reasons & WAKE_TOUCH) frame_timing.wake_touch++;
+            if (reasons & WAKE_UI) frame_timing.wake_ui++;
+            if (reasons & WAKE_TIMER) frame_timing.wake_timer++;
+
+            if (display_active.load()) {
+                lv_indev_t *indev = lv_indev_get_next(nullptr);
+                if ((reasons & WAKE_TOUCH) && indev && indev->driver->read_timer) {
+                    lv_timer_resume(indev->driver->read_timer);
+                    lv_timer_ready(indev->driver->read_timer);
+                }
+                if (reasons & WAKE_VSYNC) vsync_pull_timers(vsync_period_us / 1000);
+
+                int64_t t0 = esp_timer_get_time();
+                task_delay_ms = lv_timer_handler();
+                frame_timing.handler.record((uint32_t)(esp_timer_get_time() - t0));
+            }
             bsp_lvgl_unlock();
         }
-        if (task_delay_ms > LVGL_PORT_TASK_MAX_DELAY_MS) {
-            task_delay_ms = LVGL_PORT_TASK_MAX_DELAY_MS;
-        } else if (task_delay_ms < LVGL_PORT_TASK_MIN_DELAY_MS) {
-            task_delay_ms = LVGL_PORT_TASK_MIN_DELAY_MS;
+
+        // Nothing due (display off, or no animation, no touch, nothing invalid): sleep
+        // until woken. A frame due before the next VSync: wake up on the VSync.
+        TickType_t wait_ticks;
+        if (!display_active.load() || task_delay_ms == LV_NO_TIMER_READY) {
+            wait_ticks = portMAX_DELAY;
+        } else if (task_delay_ms == 0) {
+            continue;
+        } else if (task_delay_ms * 1000 < vsync_period_us) {
+            vsync_wake_armed.store(true);
+            wait_ticks = pdMS_TO_TICKS(LVGL_PORT_VSYNC_TIMEOUT_MS);
+        } else {
+            wait_ticks = pdMS_TO_TICKS(task_delay_ms);
+        }
+        if (xSemaphoreTake(lvgl_wake, wait_ticks ? wait_ticks : 1) != pdTRUE) {
+            wake_reasons.fetch_or(WAKE_TIMER);
         }
-        vTaskDelay(pdMS_TO_TICKS(task_delay_ms));
+        vsync_wake_armed.store(false);
     }
 }
 
@@ -188,17 +732,25 @@ static void lvgl_port_task(void *arg)
 // Public API
 // ======================================================================
 
-void bsp_init()
+const char *bsp_render_mode_name(BspRenderMode mode)
+{
+    return (mode < BSP_RENDER_MODE_COUNT) ? render_mode_names[mode] : "?";
+}
+
+void bsp_init(BspRenderMode mode)
 {
     Serial.println("BSP: Initializing board...");
+    render_mode = (mode < BSP_RENDER_MODE_COUNT) ? mode : BSP_RENDER_DIRECT;
 
     // 1. Create and init Board (handles IO Expander, LCD, Touch, Backlight)
     board = new Board();
     board->init();
 
-    // 2. Configure LCD for anti-tearing
+    // 2. Configure LCD frame buffers for the render mode
     auto lcd = board->getLCD();
-    lcd->configFrameBufferNumber(LVGL_PORT_DISP_BUFFER_NUM);
+    lcd->configFrameBufferNumber(render_mode_fbs[render_mode]);
+    Serial.printf("BSP: Render mode %s (%d frame buffers)\n",
+                  bsp_render_mode_name(render_mode), render_mode_fbs[render_mode]);
 
     // 3. Configure bounce buffer (critical for ESP32-S3 + PSRAM)
     auto lcd_bus = lcd->getBus();
@@ -225,21 +777,24 @@ void bsp_init()
         return;
     }
     lv_disp_set_rotation(disp, LV_DISP_ROT_NONE);
+    flush_stats.mode = render_mode;
+    flush_stats.since_ms = millis();
 
-    // 7. Setup touch input
+    // 7. Create LVGL mutex and the LVGL task wakeup
+    lvgl_mux = xSemaphoreCreateRecursiveMutex();
+    lvgl_wake = xSemaphoreCreateBinary();
+    if (!lvgl_mux || !lvgl_wake) {
+        Serial.println("BSP: ERROR - failed to create LVGL mutex!");
+        return;
+    }
+
+    // 8. Setup touch input
     Touch *tp = board->getTouch();
     if (tp) {
         indev_init(tp);
         Serial.println("BSP: Touch initialized");
     }
 
-    // 8. Create LVGL mutex
-    lvgl_mux = xSemaphoreCreateRecursiveMutex();
-    if (!lvgl_mux) {
-        Serial.println("BSP: ERROR - failed to create LVGL mutex!");
-        return;
-    }
-
     // 9. Create LVGL task on Core 1
     BaseType_t ret = xTaskCreatePinnedToCore(
         lvgl_port_task, "lvgl", LVGL_PORT_TASK_STACK_SIZE, NULL,
@@ -259,14 +814,30 @@ void bsp_init()
 bool bsp_lvgl_lock(int timeout_ms)
 {
     if (!lvgl_mux) return false;
+    // Uncontended: no timing
+    if (xSemaphoreTakeRecursive(lvgl_mux, 0) == pdTRUE) {
+        frame_timing.lock_takes++;
+        return true;
+    }
+    if (timeout_ms == 0) return false;
+
     const TickType_t timeout_ticks = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
-    return (xSemaphoreTakeRecursive(lvgl_mux, timeout_ticks) == pdTRUE);
+    int64_t t0 = esp_timer_get_time();
+    if (xSemaphoreTakeRecursive(lvgl_mux, timeout_ticks) != pdTRUE) return false;
+    frame_timing.lock_takes++;
+    frame_timing.lock.record((uint32_t)(esp_timer_get_time() - t0));
+    return true;
 }
 
 void bsp_lvgl_unlock()
 {
     if (lvgl_mux) {
         xSemaphoreGiveRecursive(lvgl_mux);
+        // Another task may have changed the UI: let the LVGL task look
+        if (xTaskGetCurrentTaskHandle() != lvgl_task_handle && lvgl_wake && display_active.load()) {
+            wake_reasons.fetch_or(WAKE_UI);
+            xSemaphoreGive(lvgl_wake);
+        }
     }
 }
 
@@ -285,6 +856,78 @@ void bsp_set_backlight(bool on)
     }
 }
 
+void bsp_set_display_active(bool on)
+{
+    if (!on) bsp_set_backlight(false);
+    if (bsp_lvgl_lock(-1)) {
+        display_active.store(on);
+        if (on) lv_indev_reset(nullptr, nullptr);  // No press left over from before
+        bsp_lvgl_unlock();                        // Wakes the LVGL task
+    }
+    if (on) bsp_set_backlight(true);
+    Serial.printf("BSP: Display %s\n", on ? "active" : "suspended");
+}
+
+void bsp_get_flush_stats(BspFlushStats &stats)
+{
+    if (bsp_lvgl_lock(-1)) {
+        stats = flush_stats;
+        bsp_lvgl_unlock();
+    }
+}
+
+void bsp_reset_flush_stats()
+{
+    if (bsp_lvgl_lock(-1)) {
+        flush_stats = {};
+        flush_stats.mode = render_mode;
+        flush_stats.since_ms = millis();
+        bsp_lvgl_unlock();
+    }
+}
+
+void bsp_get_frame_timing(BspFrameTiming &timing)
+{
+    if (bsp_lvgl_lock(-1)) {
+        timing = frame_timing;
+        timing.touch_reads = touch_reads.load();
+        bsp_lvgl_unlock();
+    }
+}
+
+void bsp_reset_frame_timing()
+{
+    if (bsp_lvgl_lock(-1)) {
+        frame_timing = BspFrameTiming();
+        touch_reads.store(0);
+        timing_overlay_rebase();
+        bsp_lvgl_unlock();
+    }
+}
+
+void bsp_show_timing_overlay(bool on)
+{
+    if (!bsp_lvgl_lock(-1)) return;
+    if (on && !timing_label) {
+        timing_label = lv_label_create(lv_layer_top());
+        lv_obj_set_style_bg_color(timing_label, lv_color_black(), 0);
+        lv_obj_set_style_bg_opa(timing_label, LV_OPA_70, 0);
+        lv_obj_set_style_text_color(timing_label, lv_color_white(), 0);
+        lv_obj_set_style_text_font(timing_label, &lv_font_montserrat_12, 0);
+        lv_obj_set_style_pad_all(timing_label, 4, 0);
+        lv_obj_align(timing_label, LV_ALIGN_BOTTOM_LEFT, 0, 0);
+        lv_label_set_text(timing_label, "");
+        timing_overlay_rebase();
+        timing_timer = lv_timer_create(timing_overlay_update, TIMING_OVERLAY_PERIOD_MS, nullptr);
+    } else if (!on && timing_label) {
+        lv_timer_del(timing_timer);
+        lv_obj_del(timing_label);
+        timing_timer = nullptr;
+        timing_label = nullptr;
+    }
+    bsp_lvgl_unlock();
+}
+
 int bsp_get_input_state()
 {
     if (!board) return -1;
@@ -1,24 +1,86 @@
 #pragma once
 
 #include <Arduino.h>
+#include <mixer_link_histogram.h>
 
 // Board dimensions (also used by app code)
 #define TOUCH_WIDTH  800
 #define TOUCH_HEIGHT 480
 
-// ---- LVGL Anti-Tearing Configuration ----
-// Mode 3: Double buffer + Direct mode (recommended by Waveshare)
-#define LVGL_PORT_AVOID_TEARING_MODE (3)
+// ---- LVGL Render Modes ----
+// Picked at boot (bsp_init), the number of LCD frame buffers is fixed once
+// the panel has started. Direct mode is the default (recommended by Waveshare).
+enum BspRenderMode : uint8_t {
+    BSP_RENDER_DIRECT = 0,      // 2 PSRAM frame buffers, LVGL draws dirty areas in place (anti-tearing mode 3)
+    BSP_RENDER_FULL_DOUBLE,     // 2 PSRAM frame buffers, whole screen every frame (anti-tearing mode 1)
+    BSP_RENDER_FULL_TRIPLE,     // 3 PSRAM frame buffers, whole screen, no wait for VSync (anti-tearing mode 2)
+    BSP_RENDER_PARTIAL,         // 1 internal SRAM band, copied into 1 PSRAM frame buffer (may tear)
+    BSP_RENDER_TILES,           // As partial, bands copied by GDMA while LVGL renders the next one (may tear)
+    BSP_RENDER_MODE_COUNT,
+};
 
-// Derived from mode (do not change)
-#define LVGL_PORT_AVOID_TEAR       (1)
-#define LVGL_PORT_DISP_BUFFER_NUM  (2)
-#define LVGL_PORT_DIRECT_MODE      (1)
-#define LVGL_PORT_ROTATION_DEGREE  (0)
+#define LVGL_PORT_PARTIAL_LINES    (40)     // Band height in BSP_RENDER_PARTIAL: 800 x 40 x 2 B = 64 KB
+
+// ---- Frame statistics ----
+// Bytes: pixels written to the PSRAM frame buffers, rendered (or copied from
+// the SRAM bands) plus, in direct mode, the dirty areas LVGL copied from the
+// front buffer to keep both in sync. Overdraw while rendering is not
+// included, so this is a lower bound of the PSRAM write traffic.
+// Time: one LVGL refresh = render + flush; flush is the time in the flush
+// callback (band copy, buffer switch, wait for VSync). In tiles mode the
+// copy runs in the background, waiting for it shows up as render time.
+struct BspFlushStats {
+    uint8_t mode;                   // BspRenderMode
+    uint32_t since_ms;              // Start of the measurement (FPS)
+    uint32_t frames;
+    uint32_t full_frames;           // Whole screen written
+    uint64_t render_bytes;
+    uint64_t sync_bytes;
+    uint32_t last_frame_bytes;
+    uint32_t max_frame_bytes;
+    uint64_t render_us;
+    uint64_t flush_us;
+    uint32_t max_frame_us;          // Longest refresh, render + flush
+    uint32_t dma_fallbacks;         // Tiles mode: bands the CPU copied (GDMA queue refused)
+};
+
+// ---- Frame timing ----
+// Always on, one histogram per stage (microseconds):
+// handler: one lv_timer_handler() call (includes the refresh, if any)
+// render / flush: per refreshed frame, flush includes the VSync wait
+// vsync: waiting for the previous frame buffer to leave the screen
+// lock: bsp_lvgl_lock() calls that had to wait for another task
+// touch_read: GT911 INT to LVGL reading the sample (includes the I2C read)
+// touch_frame: GT911 INT to the end of the first frame after LVGL read it
+// (touch to pixel; frames more than 250 ms later are not counted)
+// The LVGL task sleeps between handler calls, the wake counters say why it
+// woke up (a handler call without any of them was back to back).
+struct BspFrameTiming {
+    MixerLinkHistogram handler;
+    MixerLinkHistogram render;
+    MixerLinkHistogram flush;
+    MixerLinkHistogram vsync;
+    MixerLinkHistogram lock;
+    MixerLinkHistogram touch_read;
+    MixerLinkHistogram touch_frame;
+    uint32_t lock_takes;            // All bsp_lvgl_lock() calls that got the lock
+    uint32_t wake_timer;            // An LVGL timer came due
+    uint32_t wake_vsync;            // VSync with a frame due before the next one
+    uint32_t wake_touch;            // Touch sample queued (LVGL reads touch only while pressed)
+    uint32_t wake_ui;               // Another task unlocked LVGL
+    uint32_t touch_reads;           // GT911 I2C reads (one per INT while touched)
+};
 
 // ---- Function Prototypes ----
-void bsp_init();           // Initialize board: IO Expander, LCD, Touch, LVGL
+void bsp_init(BspRenderMode mode = BSP_RENDER_DIRECT);   // Initialize board: IO Expander, LCD, Touch, LVGL
+const char *bsp_render_mode_name(BspRenderMode mode);
 bool bsp_lvgl_lock(int timeout_ms = -1);
 void bsp_lvgl_unlock();
 void bsp_set_backlight(bool on);
+void bsp_set_display_active(bool on);  // Off: backlight off, no rendering, no touch polling
 int  bsp_get_input_state();
+void bsp_get_flush_stats(BspFlushStats &stats);
+void bsp_reset_flush_stats();
+void bsp_get_frame_timing(BspFrameTiming &timing);
+void bsp_reset_frame_timing();
+void bsp_show_timing_overlay(bool on);  // FPS and stage times on the top layer
@@ -0,0 +1,435 @@
+#include "controller_link.h"
+#include <mixer_link_rx.h>
+#include <stdio.h>
+
+// ----------------------------------------------------------------------
+// TX scheduler - the caller (loop()) owns the link, the UI only posts
+// ----------------------------------------------------------------------
+
+void ControllerLink::requestUpdate() {
+    tx_pending = true;
+}
+
+void ControllerLink::requestFlush() {
+    tx_flush = true;
+    tx_pending = true;
+}
+
+void ControllerLink::requestState() {
+    tx_full = true;
+}
+
+void ControllerLink::requestShutdown() {
+    tx_shutdown = true;
+}
+
+void ControllerLink::requestRelaySwitch(bool music_relay, bool mic_relay) {
+    // The body fades its own relay switches: the new relays go out as a normal update
+    if (tx_switch == TX_SWITCH_NONE && bodyFadesRelays()) {
+        requestFlush();
+        return;
+    }
+    // A switch already in progress: the body still has the relays from its start
+    if (tx_switch == TX_SWITCH_NONE) {
+        tx_hold_music_relay = music_relay;
+        tx_hold_mic_relay = mic_relay;
+    }
+    tx_switch = TX_SWITCH_MUTE;   // (Re)start the settle time
+}
+
+void ControllerLink::reset() {
+    for (TxSlot &slot : tx_window) slot.active = false;
+    tx_body_valid = false;
+}
+
+// At most one frame per call, never blocks
+void ControllerLink::service(const MixerLinkState &current) {
+    uint32_t now = io.nowMs();
+
+    // Half duplex: the body may be answering our last frame
+    if (replySlotOpen()) return;
+
+    switch (tx_switch) {
+        case TX_SWITCH_MUTE:
+            // Volume already dropped by the UI, relays still as before
+            tx_pending = false;
+            tx_flush = false;
+            transmitSwitch(current, true);
+            tx_switch_at_ms = now + LINK_RELAY_SETTLE_MS;
+            tx_switch = TX_SWITCH_SETTLE;
+            return;
+        case TX_SWITCH_SETTLE:
+        case TX_SWITCH_CONFIRM:
+            // Retransmissions of the mute / switch frame go out meanwhile
+            if (serviceRetransmit()) return;
+            if ((int32_t)(now - tx_switch_at_ms) < 0) return;
+            // Each step waits for the body's ACK, and for every older frame (an
+            // earlier mute may still be on its way)
+            if (!windowEmpty()) return;
+            if (!tx_switch_acked) {
+                // Lost, or a full STATE without retransmission: send the step again,
+                // as a full STATE since the body state is unknown now
+                if (now - tx_switch_at_ms >= LINK_ACK_TIMEOUT_MS) {
+                    tx_body_valid = false;
+                    if (tx_switch == TX_SWITCH_SETTLE) {
+                        tx_switch = TX_SWITCH_MUTE;
+                    } else {
+                        transmitSwitch(current, false);
+                        tx_switch_at_ms = now;
+                    }
+                }
+                return;
+            }
+            if (tx_switch == TX_SWITCH_SETTLE) {
+                tx_pending = false;
+                tx_flush = false;
+                transmitSwitch(current, false);
+                tx_switch_at_ms = now;
+                tx_switch = TX_SWITCH_CONFIRM;
+                return;
+            }
+            // Switched: the channels may come back up
+            tx_switch = TX_SWITCH_NONE;
+            requestFlush();
+            break;
+        default:
+            break;
+    }
+
+    if (tx_full) {
+        tx_full = false;
+        tx_pending = false;
+        tx_flush = false;
+        transmit(current, true);
+        return;
+    }
+
+    if (tx_shutdown) {
+        tx_shutdown = false;
+        sendShutdown();
+        return;
+    }
+
+    if (serviceRetransmit()) return;
+
+    if (tx_pending && (tx_flush || now - tx_last_ms >= tx_interval_ms)) {
+        tx_pending = false;
+        tx_flush = false;
+        transmit(current);
+        return;
+    }
+
+    // Quiet bus: the body only talks in a reply slot, give it one for TELEMETRY
+    if (binary && now - tx_frame_ms >= LINK_POLL_MS) sendPoll();
+}
+
+uint32_t ControllerLink::waitMs(uint32_t max_ms) const {
+    uint32_t now = io.nowMs();
+    uint32_t now_us = io.nowUs();
+    uint32_t wait = max_ms;
+
+    if (replySlotOpen()) {
+        uint32_t left_ms = (tx_quiet_until_us - now_us) / 1000 + 1;
+        return left_ms < wait ? left_ms : wait;
+    }
+
+    if (tx_full || tx_shutdown || tx_switch == TX_SWITCH_MUTE) return 0;
+
+    // Next retransmission timeout
+    for (const TxSlot &slot : tx_window) {
+        if (!slot.active) continue;
+        uint32_t elapsed_ms = (now_us - slot.retry_us) / 1000;
+        if (elapsed_ms >= LINK_ACK_TIMEOUT_MS) return 0;
+        if (LINK_ACK_TIMEOUT_MS - elapsed_ms < wait) wait = LINK_ACK_TIMEOUT_MS - elapsed_ms;
+    }
+
+    if (tx_switch != TX_SWITCH_NONE) {
+        int32_t left = (int32_t)(tx_switch_at_ms - now);
+        if (!windowEmpty()) return wait;   // Retransmit timeout above
+        if (!tx_switch_acked) left += LINK_ACK_TIMEOUT_MS;   // Then the step is sent again
+        if (left <= 0) return 0;
+        return (uint32_t)left < wait ? (uint32_t)left : wait;
+    }
+
+    if (tx_pending) {
+        uint32_t elapsed = now - tx_last_ms;
+        if (tx_flush || elapsed >= tx_interval_ms) return 0;
+        if (tx_interval_ms - elapsed < wait) wait = tx_interval_ms - elapsed;
+    }
+
+    if (binary) {
+        uint32_t elapsed = now - tx_frame_ms;
+        if (elapsed >= LINK_POLL_MS) return 0;
+        if (LINK_POLL_MS - elapsed < wait) wait = LINK_POLL_MS - elapsed;
+    }
+    return wait;
+}
+
+// Relay switch step: `hold` = mute frame with the relays the body has, else
+// the switch frame. Channels whose relay switches stay at 0 in both, so a
+// retransmitted switch can never land after a newer volume for them.
+void ControllerLink::transmitSwitch(const MixerLinkState &current, bool hold) {
+    MixerLinkState state = current;
+    if (current.music_relay != tx_hold_music_relay) state.music_volume = 0;
+    if (current.mic_relay != tx_hold_mic_relay) state.mic_volume = 0;
+    if (hold) {
+        state.music_relay = tx_hold_music_relay;
+        state.mic_relay = tx_hold_mic_relay;
+    }
+    tx_switch_seq = tx_seq;
+    transmit(state);
+    tx_switch_acked = tx_seq == tx_switch_seq;   // Nothing sent (or JSON): no ACK to wait for
+}
+
+// `full`: heartbeat / resync, always the complete state
+void ControllerLink::transmit(const MixerLinkState &state, bool full) {
+    tx_last_ms = io.nowMs();
+
+    if (!binary) {
+        sendJSON(state);
+    } else if (full || !delta || !tx_body_valid) {
+        sendState(state);
+    } else {
+        uint8_t mask = mixer_link_state_diff(tx_body_state, state);
+        if (mask) sendDelta(state, mask);
+    }
+}
+
+// ----------------------------------------------------------------------
+// DELTA frames: sequence numbers, ACK / NAK, selective retransmission
+// ----------------------------------------------------------------------
+
+void ControllerLink::sendDelta(const MixerLinkState &state, uint8_t mask) {
+    TxSlot *slot = nullptr;
+    for (TxSlot &s : tx_window) {
+        if (!s.active) {
+            slot = &s;
+            break;
+        }
+    }
+    if (!slot) {
+        // Body not answering: stop queueing deltas, one full state replaces them all
+        stats.window_full++;
+        reset();
+        sendState(state);
+        return;
+    }
+
+    mixer_link_make_delta(slot->frame, tx_seq++, mask, state);
+    slot->sent_us = slot->retry_us = io.nowUs();
+    slot->tries = 1;
+    slot->active = true;
+    sendFrame(slot->frame);
+    tx_body_state = state;
+    stats.deltas++;
+
+    // Debug: Echo to Serial Monitor
+    io.log("RS485 TX: [delta #%u] mask=0x%02X mv=%u cv=%u mr=%d cr=%d\n", slot->frame.seq, mask,
+           state.music_volume, state.mic_volume, state.music_relay, state.mic_relay);
+}
+
+// Drops lost frames, sends the first timed out one. True if a frame went out.
+bool ControllerLink::serviceRetransmit() {
+    uint32_t now_us = io.nowUs();
+    for (TxSlot &slot : tx_window) {
+        if (!slot.active || (now_us - slot.retry_us) / 1000 < LINK_ACK_TIMEOUT_MS) continue;
+
+        if (slot.tries >= LINK_MAX_RETRIES) {
+            slot.active = false;
+            stats.lost++;
+            tx_body_valid = false;   // Resync with a full state on the next send
+            requestFlush();
+            if (tx_switch != TX_SWITCH_NONE) tx_switch_acked = false;   // Step sent again
+            continue;
+        }
+        if (retransmit(slot)) return true;
+    }
+    return false;
+}
+
+// False if every field was superseded and nothing was sent
+bool ControllerLink::retransmit(TxSlot &slot) {
+    // Same sequence number: the body skips fields a newer frame already set
+    uint8_t mask = slot.frame.payload[0];
+    for (int i = 0; i < MIXER_LINK_FIELD_COUNT; i++) {
+        if ((mask & field_acked_mask & (1 << i)) && mixer_link_seq_newer(field_acked_seq[i], slot.frame.seq)) {
+            mask &= ~(1 << i);
+        }
+    }
+    if (!mask) {
+        slot.active = false;
+        stats.superseded++;
+        return false;
+    }
+
+    slot.retry_us = io.nowUs();
+    slot.tries++;
+    sendFrame(slot.frame);
+    stats.retransmits++;
+
+    // The body may mute only now: the relay settle time starts again
+    if (tx_switch == TX_SWITCH_SETTLE) tx_switch_at_ms = io.nowMs() + LINK_RELAY_SETTLE_MS;
+    return true;
+}
+
+void ControllerLink::handleFrame(const MixerLinkFrame &frame) {
+    uint8_t first, count;
+    switch (frame.type) {
+        case MIXER_LINK_TYPE_ACK:
+            handleAck(frame.seq);
+            break;
+        case MIXER_LINK_TYPE_NAK:
+            if (mixer_link_parse_nak(frame, first, count)) handleNak(first, count);
+            break;
+        case MIXER_LINK_TYPE_TELEMETRY: {
+            MixerLinkTelemetry tlm;
+            if (mixer_link_parse_telemetry(frame, tlm)) handleTelemetry(tlm);
+            break;
+        }
+        case MIXER_LINK_TYPE_GET:
+            if (tx_poll_sent && frame.seq == tx_poll_seq) {
+                tx_poll_sent = false;   // Our own poll (bus echo)
+                break;
+            }
+            requestState();   // The body has no full state (boot, or it was lost)
+            break;
+        default:
+            break;
+    }
+}
+
+void ControllerLink::handleAck(uint8_t seq) {
+    stats.acks++;
+    if (tx_switch != TX_SWITCH_NONE && seq == tx_switch_seq) tx_switch_acked = true;
+
+    if (seq == tx_state_seq) {
+        for (int i = 0; i < MIXER_LINK_FIELD_COUNT; i++) field_acked_seq[i] = seq;
+        field_acked_mask = MIXER_LINK_FIELD_ALL;
+        return;
+    }
+
+    for (TxSlot &slot : tx_window) {
+        if (!slot.active || slot.frame.seq != seq) continue;
+        slot.active = false;
+        ack_rtt.record(io.nowUs() - slot.sent_us);
+
+        uint8_t mask = slot.frame.payload[0];
+        for (int i = 0; i < MIXER_LINK_FIELD_COUNT; i++) {
+            if (!(mask & (1 << i))) continue;
+            if (!(field_acked_mask & (1 << i)) || mixer_link_seq_newer(seq, field_acked_seq[i])) {
+                field_acked_seq[i] = seq;
+                field_acked_mask |= (1 << i);
+            }
+        }
+        return;
+    }
+}
+
+void ControllerLink::handleNak(uint8_t first, uint8_t count) {
+    stats.naks++;
+    uint32_t due_us = io.nowUs() - LINK_ACK_TIMEOUT_MS * 1000;
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t seq = first + i;
+        for (TxSlot &slot : tx_window) {
+            // Due now, sent by service() once the body's reply slot is over
+            if (slot.active && slot.frame.seq == seq) slot.retry_us = due_us;
+        }
+    }
+}
+
+void ControllerLink::handleTelemetry(const MixerLinkTelemetry &tlm) {
+    body = tlm;
+    body_valid = true;
+    body_seen_ms = io.nowMs();
+    stats.telemetry++;
+
+    // Settled (body applied our newest frame, nothing in flight) but the
+    // hardware differs from what we think it has: resync with a full state
+    bool settled = tlm.applied_seq == (uint8_t)(tx_seq - 1) && tx_switch == TX_SWITCH_NONE &&
+                   !(tlm.flags & (MIXER_LINK_TLM_SLEEPING | MIXER_LINK_TLM_RAMPING)) && windowEmpty();
+    if (settled && tx_body_valid && mixer_link_state_diff(tlm.state, tx_body_state)) {
+        stats.mismatches++;
+        tx_body_valid = false;
+        requestFlush();
+    }
+}
+
+bool ControllerLink::windowEmpty() const {
+    for (const TxSlot &slot : tx_window) {
+        if (slot.active) return false;
+    }
+    return true;
+}
+
+bool ControllerLink::replySlotOpen() const {
+    return (int32_t)(io.nowUs() - tx_quiet_until_us) < 0;
+}
+
+// ----------------------------------------------------------------------
+// Senders
+// ----------------------------------------------------------------------
+
+void ControllerLink::sendState(const MixerLinkState &state) {
+    MixerLinkFrame frame;
+    mixer_link_make_state(frame, tx_seq++, state);
+    sendFrame(frame);
+
+    // Full state is the resync point for DELTA frames
+    tx_state_seq = frame.seq;
+    tx_body_state = state;
+    tx_body_valid = true;
+    stats.states++;
+
+    // Debug: Echo to Serial Monitor
+    io.log("RS485 TX: [bin #%u] mv=%u cv=%u mr=%d cr=%d\n", frame.seq,
+           state.music_volume, state.mic_volume, state.music_relay, state.mic_relay);
+}
+
+void ControllerLink::sendShutdown() {
+    if (binary) {
+        MixerLinkFrame frame;
+        mixer_link_make_power(frame, tx_seq++, false);
+        sendFrame(frame);
+        io.log("RS485 TX: [bin] pwr=0\n");
+        return;
+    }
+
+    static const char line[] = "{\"pwr\":0}\n";
+    io.write((const uint8_t *)line, sizeof(line) - 1);
+    io.log("RS485 TX: {\"pwr\":0}\n");
+}
+
+// GET: nothing to apply, the body answers with TELEMETRY
+void ControllerLink::sendPoll() {
+    MixerLinkFrame frame;
+    mixer_link_make_get(frame, tx_seq++);
+    sendFrame(frame);
+    tx_poll_seq = frame.seq;
+    tx_poll_sent = true;
+    stats.polls++;
+}
+
+void ControllerLink::sendFrame(const MixerLinkFrame &frame) {
+    uint8_t buf[MIXER_LINK_MAX_FRAME];
+    size_t len = mixer_link_encode(frame, buf, sizeof(buf));
+    if (len > 0) {
+        io.write(buf, len);
+        tx_quiet_until_us = io.nowUs() + MIXER_LINK_REPLY_SLOT_US;
+        tx_frame_ms = io.nowMs();
+    }
+}
+
+void ControllerLink::sendJSON(const MixerLinkState &state) {
+    // Volumes already scaled by the Main Fader, c for Channel (Microphone)
+    char line[MIXER_LINK_MAX_LINE + 1];
+    int len = snprintf(line, sizeof(line) - 1, "{\"mv\":%u,\"cv\":%u,\"mr\":%d,\"cr\":%d}",
+                       state.music_volume, state.mic_volume, state.music_relay ? 1 : 0, state.mic_relay ? 1 : 0);
+    if (len <= 0 || len >= (int)sizeof(line) - 1) return;
+    line[len] = '\0';
+
+    // Debug: Echo to Serial Monitor
+    io.log("RS485 TX: %s\n", line);
+
+    line[len++] = '\n'; // Send newline
+    io.write((const uint8_t *)line, len);
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+/*
+ * ControllerLink - controller side of the MixerLink protocol
+ *
+ * TX scheduler (coalesced, rate-limited state frames), relay anti-pop
+ * sequence, DELTA window with ACK / NAK and selective retransmission,
+ * half-duplex reply slots and body telemetry.
+ *
+ * Plain C++: the bus, clock and debug output come through ControllerLinkIo,
+ * so the same code runs in AppDataManager on the ESP32 and in MixerSim on
+ * the host. Not thread safe, call everything from one task (loop()).
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <mixer_link.h>
+#include <mixer_link_histogram.h>
+
+#define LINK_TX_INTERVAL_MS     (40)   // Default minimum spacing of coalesced state frames (25 Hz)
+#define LINK_RELAY_SETTLE_MS    (50)   // Muted frame -> relay switch frame
+#define LINK_TX_WINDOW          (8)    // Unacknowledged DELTA frames kept for retransmission
+#define LINK_ACK_TIMEOUT_MS     (50)   // Retransmit a DELTA frame not acknowledged by then
+#define LINK_MAX_RETRIES        (3)    // Then the frame counts as lost and a full state is sent
+#define LINK_POLL_MS            (1000) // Binary: a GET after this long without a frame, the body replies with TELEMETRY
+
+class ControllerLinkIo {
+public:
+    virtual ~ControllerLinkIo() {}
+    virtual void write(const uint8_t *data, size_t len) = 0;   // RS485, controller -> body
+    virtual uint32_t nowMs() = 0;
+    virtual uint32_t nowUs() = 0;
+    virtual void log(const char *fmt, ...) = 0;               // Debug echo
+};
+
+// Delivery counters (USB "lat")
+struct LinkStats {
+    uint32_t deltas;        // DELTA frames sent (first transmission)
+    uint32_t states;        // Full STATE frames sent (heartbeat / resync)
+    uint32_t acks;
+    uint32_t naks;
+    uint32_t retransmits;
+    uint32_t superseded;    // Retransmit skipped, every field already acknowledged newer
+    uint32_t lost;          // Gave up after LINK_MAX_RETRIES
+    uint32_t window_full;   // No free slot, fell back to a full STATE
+    uint32_t telemetry;     // TELEMETRY frames from the body
+    uint32_t mismatches;    // Body hardware differed from the acknowledged state, resynced
+    uint32_t polls;         // GET frames sent for telemetry on a quiet bus
+};
+
+class ControllerLink {
+public:
+    explicit ControllerLink(ControllerLinkIo &io) : io(io) {}
+
+    bool binary = true;      // MixerLink frames, false = JSON fallback lines
+    bool delta = true;       // Binary only: UI changes as acknowledged DELTA frames
+    uint16_t tx_interval_ms = LINK_TX_INTERVAL_MS;   // Max state frame rate for UI changes
+
+    // Requests, sent by service() when the bus is free
+    void requestUpdate();        // Coalesced into the next frame, rate limited
+    void requestFlush();         // Final frame (slider released), sent without waiting
+    void requestState();         // Full STATE: heartbeat, GET, resync
+    void requestShutdown();      // POWER off
+    // Call before toggling a relay, with the relays as the body has them now:
+    // muted frame, settle, then the switch. Just an update if the body fades
+    // relay switches itself (MIXER_LINK_TLM_RELAY_FADE).
+    void requestRelaySwitch(bool music_relay, bool mic_relay);
+    void reset();                // Format change: drop the window, next frame is a full STATE
+
+    void service(const MixerLinkState &current);
+    uint32_t waitMs(uint32_t max_ms) const;   // How long the caller may sleep before service() is due
+
+    // ACK / NAK / TELEMETRY / GET from the body
+    void handleFrame(const MixerLinkFrame &frame);
+
+    LinkStats stats = {};
+    MixerLinkHistogram ack_rtt;     // DELTA sent -> ACK received (microseconds)
+
+    // Real body hardware state from TELEMETRY
+    MixerLinkTelemetry body = {};
+    bool body_valid = false;
+    uint32_t body_seen_ms = 0;
+    bool bodyFadesRelays() const { return body_valid && (body.flags & MIXER_LINK_TLM_RELAY_FADE); }
+
+private:
+    ControllerLinkIo &io;
+    uint8_t tx_seq = 0;
+
+    // Relay anti-pop: mute, settle, switch, then the volume comes back once the switch is acknowledged
+    enum TxSwitch : uint8_t { TX_SWITCH_NONE = 0, TX_SWITCH_MUTE, TX_SWITCH_SETTLE, TX_SWITCH_CONFIRM };
+
+    bool tx_pending = false;
+    bool tx_flush = false;
+    bool tx_full = false;
+    bool tx_shutdown = false;
+    TxSwitch tx_switch = TX_SWITCH_NONE;
+    bool tx_hold_music_relay = false;   // Relays as the body has them before the switch
+    bool tx_hold_mic_relay = false;
+    uint32_t tx_last_ms = 0;
+    uint32_t tx_frame_ms = 0;           // Last binary frame of any kind (telemetry poll)
+    uint8_t tx_poll_seq = 0;            // Last GET poll, may come back as bus echo
+    bool tx_poll_sent = false;
+    uint32_t tx_switch_at_ms = 0;
+    uint8_t tx_switch_seq = 0;          // Mute (SETTLE) or switch (CONFIRM) frame
+    bool tx_switch_acked = false;       // Body confirmed it, the next step may follow
+
+    // DELTA retransmission window
+    struct TxSlot {
+        MixerLinkFrame frame;
+        uint32_t sent_us;       // First transmission (RTT)
+        uint32_t retry_us;      // Last transmission (timeout)
+        uint8_t tries;
+        bool active;
+    };
+    TxSlot tx_window[LINK_TX_WINDOW] = {};
+    MixerLinkState tx_body_state = {};  // Last state handed to the link, deltas are against it
+    bool tx_body_valid = false;         // False: next frame is a full STATE
+    uint8_t tx_state_seq = 0;           // Last full STATE frame
+    uint8_t field_acked_seq[MIXER_LINK_FIELD_COUNT] = {};  // Newest acknowledged frame per field
+    uint8_t field_acked_mask = 0;       // Fields with a valid field_acked_seq
+    uint32_t tx_quiet_until_us = 0;     // Body reply slot after our last frame
+
+    void transmit(const MixerLinkState &state, bool full = false);
+    void transmitSwitch(const MixerLinkState &current, bool hold);
+    void sendDelta(const MixerLinkState &state, uint8_t mask);
+    void sendState(const MixerLinkState &state);
+    void sendShutdown();
+    void sendPoll();
+    void sendJSON(const MixerLinkState &state);
+    void sendFrame(const MixerLinkFrame &frame);
+    bool serviceRetransmit();
+    bool retransmit(TxSlot &slot);
+    void handleAck(uint8_t seq);
+    void handleNak(uint8_t first, uint8_t count);
+    void handleTelemetry(const MixerLinkTelemetry &tlm);
+    bool windowEmpty() const;
+    bool replySlotOpen() const;
+};
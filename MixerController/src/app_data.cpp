@@ -1,16 +1,31 @@
 #include "app_data.h"
 #include <Preferences.h>
+#include "bsp.h"
 #include "ui/ui.h"
+#include "ui_corner_cache.h"
+#include "ui_style_cache.h"
+#include "ui_mem.h"
+#include "ui_screens.h"
+#include <esp_heap_caps.h>
 
 AppDataManager AppData;
 Preferences preferences;
 
+// Defined in ui_events_impl.cpp
+extern lv_obj_t *ui_power_switch;
+
 void AppDataManager::begin() {
     preferences.begin("mixer-app", false);
     loadState();
     
-    // Initialize RS485
-    Serial1.begin(115200, SERIAL_8N1, 43, 44); // RX=43, TX=44
+    // Initialize RS485 (RX task on core 0, LVGL runs on core 1)
+    if (!link.begin(UART_NUM_1, 115200, 43, 44, 0)) { // RX=43, TX=44
+        Serial.println("RS485 init failed!");
+    }
+
+    // Called from setup(): loop() is the I/O task that owns RS485 and NVS
+    io_task = xTaskGetCurrentTaskHandle();
+    link.setNotifyTask(io_task);
 }
 
 void AppDataManager::saveState() {
@@ -20,6 +35,9 @@ void AppDataManager::saveState() {
     preferences.putBool("mus_r", music_relay_state);
     preferences.putBool("mic_r", mic_relay_state);
     preferences.putBool("pwr_en", power_sensing_enabled);
+    preferences.putBool("link_bin", session.binary);
+    preferences.putBool("link_delta", session.delta);
+    preferences.putUChar("render", render_mode);
 }
 
 void AppDataManager::loadState() {
@@ -29,43 +47,105 @@ void AppDataManager::loadState() {
     music_relay_state = preferences.getBool("mus_r", true);
     mic_relay_state = preferences.getBool("mic_r", true);
     power_sensing_enabled = preferences.getBool("pwr_en", true);
+    session.binary = preferences.getBool("link_bin", true);
+    session.delta = preferences.getBool("link_delta", true);
+    render_mode = preferences.getUChar("render", BSP_RENDER_DIRECT);
+    if (render_mode >= BSP_RENDER_MODE_COUNT) render_mode = BSP_RENDER_DIRECT;
 }
 
 void AppDataManager::sendUpdate() {
-    sendJSON();
-    dirty = true;  // Will be saved by throttled save in main loop
+    session.requestState();
 }
 
-void AppDataManager::sendJSON() {
-    StaticJsonDocument<200> doc;
-    
-    // Calculated volumes based on Main Fader
-    int final_mus_vol = (music_volume * main_fader) / 100;
-    int final_mic_vol = (mic_volume * main_fader) / 100;
-
-    doc["mv"] = final_mus_vol;
-    doc["cv"] = final_mic_vol; // c for Channel (Microphone)
-    doc["mr"] = music_relay_state ? 1 : 0;
-    doc["cr"] = mic_relay_state ? 1 : 0;
-    
-    serializeJson(doc, Serial1);
-    Serial1.println(); // Send newline
-    
-    // Debug: Echo to Serial Monitor
-    Serial.print("RS485 TX: ");
-    serializeJson(doc, Serial);
-    Serial.println();
+void AppDataManager::sendShutdown() {
+    session.requestShutdown();
+}
+
+MixerLinkState AppDataManager::currentState() const {
+    MixerLinkState state;
+    state.music_volume = (music_volume * main_fader) / 100;
+    state.mic_volume = (mic_volume * main_fader) / 100;
+    state.music_relay = music_relay_state;
+    state.mic_relay = mic_relay_state;
+    return state;
+}
+
+// ----------------------------------------------------------------------
+// UI -> I/O command queue
+// ----------------------------------------------------------------------
+
+bool AppDataManager::post(AppCommandType type, int value) {
+    uint32_t head = cmd_head.load(std::memory_order_relaxed);
+    uint32_t tail = cmd_tail.load(std::memory_order_acquire);
+    if (head - tail >= APP_CMD_QUEUE_SIZE) {
+        cmd_overflows++;
+        return false;
+    }
+
+    AppCommand &cmd = cmd_ring[head & (APP_CMD_QUEUE_SIZE - 1)];
+    cmd.type = type;
+    cmd.value = (int16_t)value;
+    cmd_head.store(head + 1, std::memory_order_release);
+
+    if (io_task) xTaskNotifyGive(io_task);
+    return true;
+}
+
+void AppDataManager::processCommands() {
+    uint32_t tail = cmd_tail.load(std::memory_order_relaxed);
+    while (tail != cmd_head.load(std::memory_order_acquire)) {
+        AppCommand cmd = cmd_ring[tail & (APP_CMD_QUEUE_SIZE - 1)];
+        cmd_tail.store(++tail, std::memory_order_release);
+        applyCommand(cmd);
+    }
+}
+
+void AppDataManager::applyCommand(const AppCommand &cmd) {
+    switch (cmd.type) {
+        case APP_CMD_MIC_VOLUME:
+            mic_volume = cmd.value;
+            session.requestUpdate();
+            dirty = true;  // Will be saved by throttled save in main loop
+            break;
+        case APP_CMD_MUSIC_VOLUME:
+            music_volume = cmd.value;
+            session.requestUpdate();
+            dirty = true;
+            break;
+        case APP_CMD_MAIN_FADER:
+            main_fader = cmd.value;
+            session.requestUpdate();
+            dirty = true;
+            break;
+        case APP_CMD_SLIDER_RELEASED:
+            session.requestFlush();
+            break;
+        case APP_CMD_TOGGLE_MIC_RELAY:
+            // SAFETY SEQUENCE: Volume 0 with Relay = OLD, settle, then Relay = NEW
+            mic_volume = 0;
+            session.requestRelaySwitch(music_relay_state, mic_relay_state);
+            mic_relay_state = !mic_relay_state;
+            dirty = true;
+            break;
+        case APP_CMD_TOGGLE_MUSIC_RELAY:
+            music_volume = 0;
+            session.requestRelaySwitch(music_relay_state, mic_relay_state);
+            music_relay_state = !music_relay_state;
+            dirty = true;
+            break;
+        case APP_CMD_POWER_SENSING:
+            power_sensing_enabled = cmd.value != 0;
+            saveState();  // Save immediately — this is a settings change
+            Serial.printf("Power sensing: %s\n", power_sensing_enabled ? "ON" : "OFF");
+            break;
+    }
 }
 
 void AppDataManager::handleIncomingData(Stream &serial) {
     if (serial.available()) {
         String input = serial.readStringUntil('\n');
         input.trim();
-        
-        // Check for '?' or JSON command "get"
-        if (input == "?" || input.indexOf("\"cmd\":\"get\"") >= 0) {
-            sendUpdate();
-        }
+        handleCommand(input);
     }
 }
 
@@ -95,4 +175,233 @@ void AppDataManager::syncUI() {
         if(ui_Button1) lv_obj_add_state(ui_Button1, LV_STATE_CHECKED);
         if(ui_Button2) lv_obj_clear_state(ui_Button2, LV_STATE_CHECKED);
     }
+
+    // 3. Power sensing switch (Screen 2, only while it is built)
+    if (ui_power_switch) {
+        if (power_sensing_enabled) lv_obj_add_state(ui_power_switch, LV_STATE_CHECKED);
+        else lv_obj_clear_state(ui_power_switch, LV_STATE_CHECKED);
+    }
+}
+
+void AppDataManager::handleLinkMessage(const MixerLinkRxItem &item) {
+    if (item.msg.kind == MIXER_LINK_MSG_FRAME) {
+        session.handleFrame(item.msg.frame);   // ACK / NAK / TELEMETRY / GET
+    } else {
+        String input(item.msg.line);
+        input.trim();
+        handleCommand(input);
+    }
+    link.markHandled(item);
+}
+
+void AppDataManager::handleCommand(const String &input) {
+    // Check for '?' or JSON command "get"
+    if (input == "?" || input.indexOf("\"cmd\":\"get\"") >= 0) {
+        sendUpdate();
+    }
+    // Link format switch (USB testing): "bin" = MixerLink frames, "json" = fallback
+    else if (input == "bin" || input == "json") {
+        session.binary = (input == "bin");
+        session.reset();
+        saveState();
+        Serial.printf("RS485 link format: %s\n", session.binary ? "binary" : "JSON");
+    }
+    // Binary mode (USB testing): "delta" = acknowledged DELTA frames, "full" = STATE only
+    else if (input == "delta" || input == "full") {
+        session.delta = (input == "delta");
+        session.reset();
+        saveState();
+        Serial.printf("RS485 binary mode: %s\n", session.delta ? "delta" : "full state");
+    }
+    // RS485 receive statistics and latency histogram: "lat", "lat0" = reset
+    else if (input == "lat") {
+        printLinkStats();
+    }
+    // Body hardware state from its telemetry
+    else if (input == "body") {
+        printBodyStatus();
+    }
+    // Frame buffer (PSRAM) writes per frame: "fb", "fb0" = reset
+    else if (input == "fb") {
+        printFlushStats();
+    }
+    // Render mode: "render" = show modes, "render N" = save and restart
+    else if (input.startsWith("render")) {
+        int mode = input.length() > 6 ? input.substring(6).toInt() : -1;
+        if (input.length() > 6 && mode >= 0 && mode < BSP_RENDER_MODE_COUNT) {
+            render_mode = mode;
+            saveState();
+            Serial.printf("Render mode: %s, restarting\n", bsp_render_mode_name((BspRenderMode)render_mode));
+            Serial.flush();
+            ESP.restart();
+        }
+        for (int i = 0; i < BSP_RENDER_MODE_COUNT; i++) {
+            Serial.printf("%c%d %s\n", i == render_mode ? '*' : ' ', i, bsp_render_mode_name((BspRenderMode)i));
+        }
+    }
+    // LVGL stage timing histograms: "ft", "ft0" = reset, "ovl" / "ovl0" = on-screen overlay on / off
+    else if (input == "ft") {
+        printFrameTiming();
+    }
+    else if (input == "ft0") {
+        bsp_reset_frame_timing();
+        ui_corner_cache_reset_stats();
+        Serial.println("Frame timing reset");
+    }
+    else if (input == "ovl" || input == "ovl0") {
+        bsp_show_timing_overlay(input == "ovl");
+    }
+    else if (input == "fb0") {
+        bsp_reset_flush_stats();
+        Serial.println("Frame buffer stats reset");
+    }
+    // LVGL heap (ui_mem.cpp): "mem", "mem0" = reset peaks and counts
+    else if (input == "mem") {
+        printMemStats();
+    }
+    else if (input == "mem0") {
+        ui_mem_reset_stats();
+        Serial.println("LVGL heap stats reset");
+    }
+    // Screens (ui_screens.cpp): "scr", "trim" = delete Screen2 if not shown
+    else if (input == "scr") {
+        printScreens();
+    }
+    else if (input == "trim") {
+        bsp_lvgl_lock(-1);
+        uint32_t n = ui_screens_trim();
+        bsp_lvgl_unlock();
+        Serial.printf("Screens deleted: %u\n", n);
+    }
+    else if (input == "lat0") {
+        link.resetLatency();
+        session.ack_rtt.reset();
+        session.stats = {};
+        Serial.println("RS485 latency reset");
+    }
+}
+
+static void printHistogram(const char *name, const MixerLinkHistogram &h) {
+    Serial.printf("%s: n=%u avg=%uus max=%uus\n", name, h.total, h.avg_us(), h.max_us);
+    for (uint32_t i = 0; i < MIXER_LINK_HIST_BUCKETS; i++) {
+        if (i < MIXER_LINK_HIST_BUCKETS - 1) {
+            Serial.printf("  <%6uus: %u\n", MixerLinkHistogram::bound(i), h.counts[i]);
+        } else {
+            Serial.printf("  >=%5uus: %u\n", MixerLinkHistogram::bound(i - 1), h.counts[i]);
+        }
+    }
+}
+
+void AppDataManager::printLinkStats() {
+    const MixerLinkRxStats &st = link.parserStats();
+    const MixerLinkUartStats &us = link.stats();
+    Serial.printf("RS485 RX: frames=%u lines=%u crc=%u hdr=%u drop=%u long=%u overrun=%u worst_feed=%uus\n",
+                  st.frames, st.lines, st.crc_errors, st.header_errors, st.dropped_bytes,
+                  st.line_overflows, st.ring_overruns, us.worst_feed_us);
+    Serial.printf("RS485 UART: events=%u fifo_ovf=%u queue_drop=%u\n",
+                  us.events, us.fifo_overflows, us.queue_drops);
+    Serial.printf("UI commands: dropped=%u\n", cmd_overflows);
+
+    const LinkStats &ls = session.stats;
+    Serial.printf("RS485 delivery: delta=%u state=%u ack=%u nak=%u retx=%u superseded=%u lost=%u window_full=%u\n",
+                  ls.deltas, ls.states, ls.acks, ls.naks, ls.retransmits, ls.superseded, ls.lost, ls.window_full);
+    Serial.printf("RS485 body: telemetry=%u mismatch=%u poll=%u\n", ls.telemetry, ls.mismatches, ls.polls);
+
+    // Wire-to-action latency: UART event -> message handled
+    printHistogram("RS485 latency", link.latency());
+    printHistogram("RS485 ACK RTT", session.ack_rtt);
+}
+
+void AppDataManager::printBodyStatus() {
+    const MixerLinkTelemetry &body = session.body;
+    if (!session.body_valid) {
+        Serial.println("Body: no telemetry yet");
+        return;
+    }
+    Serial.printf("Body (%lums ago, seq %u): mv=%u cv=%u mr=%d cr=%d bt=%s%s%s%s\n",
+                  millis() - session.body_seen_ms, body.applied_seq,
+                  body.state.music_volume, body.state.mic_volume, body.state.music_relay, body.state.mic_relay,
+                  (body.flags & MIXER_LINK_TLM_BT_ACTIVE) ? "on" : "off",
+                  (body.flags & MIXER_LINK_TLM_BT_CONNECTED) ? " connected" : "",
+                  (body.flags & MIXER_LINK_TLM_SLEEPING) ? " sleeping" : "",
+                  (body.flags & MIXER_LINK_TLM_RAMPING) ? " ramping" : "");
+    Serial.printf("Body: i2c_err=%u loop_max=%uus loop_avg=%uus\n",
+                  body.i2c_errors, body.loop_max_us, body.loop_avg_us);
+}
+
+void AppDataManager::printFlushStats() {
+    BspFlushStats fb = {};
+    bsp_get_flush_stats(fb);
+    uint32_t frames = fb.frames ? fb.frames : 1;
+    uint32_t elapsed_ms = millis() - fb.since_ms;
+    Serial.printf("FB: mode=%s fps=%.1f render=%.2fms flush=%.2fms (avg) max_frame=%.2fms\n",
+                  bsp_render_mode_name((BspRenderMode)fb.mode),
+                  elapsed_ms ? fb.frames * 1000.0f / elapsed_ms : 0.0f,
+                  fb.render_us / 1000.0f / frames, fb.flush_us / 1000.0f / frames, fb.max_frame_us / 1000.0f);
+    if (fb.mode == BSP_RENDER_TILES) {
+        Serial.printf("FB: tiles copied by CPU (GDMA refused)=%u\n", fb.dma_fallbacks);
+    }
+    Serial.printf("FB: frames=%u full=%u avg=%lluB/frame (render %llu + sync %llu) last=%uB max=%uB\n",
+                  fb.frames, fb.full_frames, (fb.render_bytes + fb.sync_bytes) / frames,
+                  fb.render_bytes / frames, fb.sync_bytes / frames, fb.last_frame_bytes, fb.max_frame_bytes);
+}
+
+void AppDataManager::printFrameTiming() {
+    BspFrameTiming ft;
+    bsp_get_frame_timing(ft);
+    printHistogram("LVGL handler", ft.handler);
+    Serial.printf("LVGL wakeups: timer=%u vsync=%u touch=%u ui=%u\n",
+                  ft.wake_timer, ft.wake_vsync, ft.wake_touch, ft.wake_ui);
+    printHistogram("Frame render", ft.render);
+    printHistogram("Frame flush", ft.flush);
+    printHistogram("VSync wait", ft.vsync);
+    Serial.printf("LVGL lock: takes=%u contended=%u\n", ft.lock_takes, ft.lock.total);
+    printHistogram("LVGL lock wait", ft.lock);
+    Serial.printf("Touch: GT911 reads=%u\n", ft.touch_reads);
+    printHistogram("Touch to LVGL", ft.touch_read);
+    printHistogram("Touch to frame", ft.touch_frame);
+    UiCornerCacheStats cc = ui_corner_cache_stats();
+    Serial.printf("Corner cache: hits=%u misses=%u, rounded backgrounds cached=%u lvgl=%u\n",
+                  cc.hits, cc.misses, cc.rects, cc.rects_lvgl);
+    UiStyleCacheStats sc = ui_style_cache_stats();
+    Serial.printf("Style cache: lookups=%u hits=%u misses=%u, tables emptied=%u\n",
+                  sc.lookups, sc.hits, sc.misses, sc.drops);
+}
+
+void AppDataManager::printMemStats() {
+    UiMemStats st;
+    ui_mem_get_stats(&st);
+    Serial.println("LVGL slab: block used peak pages allocs overflows");
+    for (const UiMemClassStats &cs : st.classes) {
+        Serial.printf("  %5u %5u %5u %5u %7u %5u\n", cs.block, cs.used, cs.peak, cs.pages, cs.allocs, cs.overflows);
+    }
+    Serial.printf("LVGL slab: pages=%u peak=%u of %u, free in pages=%uB\n", st.pages, st.pages_peak,
+                  UI_MEM_SLAB_BYTES / UI_MEM_PAGE_BYTES, st.slab_free);
+    Serial.printf("LVGL heap: internal=%uB peak=%uB blocks=%u allocs=%u, psram=%uB peak=%uB blocks=%u allocs=%u, failures=%u\n",
+                  st.internal.used, st.internal.peak, st.internal.blocks, st.internal.allocs,
+                  st.psram.used, st.psram.peak, st.psram.blocks, st.psram.allocs, st.failures);
+    // The system heaps the large blocks come from: free, largest free block (fragmentation)
+    Serial.printf("Heap: internal free=%uB largest=%uB, psram free=%uB largest=%uB\n",
+                  heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT),
+                  heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT),
+                  heap_caps_get_free_size(MALLOC_CAP_SPIRAM), heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM));
+}
+
+void AppDataManager::printScreens() {
+    static const char *const names[UI_SCREEN_COUNT] = { "Screen1", "Screen2", "Screen3 (splash)" };
+    UiScreensStats st = ui_screens_stats();
+    for (uint32_t i = 0; i < UI_SCREEN_COUNT; i++) {
+        Serial.printf("%-16s %-5s builds=%u last=%uus\n", names[i], (st.built & (1u << i)) ? "built" : "-",
+                      st.builds[i], st.build_us[i]);
+    }
+    Serial.printf("Screens: prebuilt=%u trimmed=%u\n", st.prebuilds, st.trims);
+}
+
+void UartLinkIo::log(const char *fmt, ...) {
+    char buf[160];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    Serial.print(buf);
 }
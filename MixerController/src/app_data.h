@@ -2,6 +2,42 @@
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include <atomic>
+#include <mixer_link.h>
+#include <mixer_link_uart.h>
+#include <mixer_link_histogram.h>
+#include <controller_link.h>
+
+#define APP_CMD_QUEUE_SIZE     (32)   // UI -> I/O commands, must be a power of two
+
+// Posted by LVGL event callbacks, applied by the I/O task (loop())
+enum AppCommandType : uint8_t {
+    APP_CMD_MIC_VOLUME = 0,     // value: 0-100
+    APP_CMD_MUSIC_VOLUME,       // value: 0-100
+    APP_CMD_MAIN_FADER,         // value: 0-100
+    APP_CMD_SLIDER_RELEASED,    // Send the final state without waiting for the rate limit
+    APP_CMD_TOGGLE_MIC_RELAY,   // Anti-pop sequence: mute, settle, switch
+    APP_CMD_TOGGLE_MUSIC_RELAY,
+    APP_CMD_POWER_SENSING,      // value: 0/1, saved to NVS
+};
+
+struct AppCommand {
+    AppCommandType type;
+    int16_t value;
+};
+
+// ControllerLink I/O on the RS485 UART, Serial and the Arduino clock
+class UartLinkIo : public ControllerLinkIo {
+public:
+    explicit UartLinkIo(MixerLinkUart &uart) : uart(uart) {}
+    void write(const uint8_t *data, size_t len) override { uart.write(data, len); }
+    uint32_t nowMs() override { return millis(); }
+    uint32_t nowUs() override { return micros(); }
+    void log(const char *fmt, ...) override;
+
+private:
+    MixerLinkUart &uart;
+};
 
 class AppDataManager {
 public:
@@ -11,18 +47,49 @@ public:
     bool music_relay_state = true;
     bool mic_relay_state = true;
     bool power_sensing_enabled = true;  // Auto on/off via USB charger on DI0
+    uint8_t render_mode = 0;            // BspRenderMode, applied at boot (USB "render N")
     bool dirty = false;  // Set true when values change, cleared after save
 
     void begin();
     void saveState();
     void loadState();
     void updateFromUI(const char* event_type, int value);
-    void sendUpdate();
+    void sendUpdate();   // Full state on the next serviceTx() (heartbeat)
+
+    // UI -> I/O task command queue (single producer: LVGL task, single consumer: loop())
+    bool post(AppCommandType type, int value = 0);   // Never blocks, false if the queue is full
+    void processCommands();
+
+    // TX scheduler (I/O task): coalesced, rate-limited state frames, see ControllerLink
+    void serviceTx() { session.service(currentState()); }
+    uint32_t txWaitMs(uint32_t max_ms) const { return session.waitMs(max_ms); }
+
+    void sendShutdown();
     void handleIncomingData(Stream &serial);
+    void handleLinkMessage(const MixerLinkRxItem &item);
+    void printLinkStats();
     void syncUI(); // Updates UI widgets from current variables
 
+    MixerLinkUart link;  // RS485 (UART1, event-driven RX task)
+    UartLinkIo link_io{link};
+    ControllerLink session{link_io};  // Protocol state: format, TX scheduler, DELTA window, telemetry
+    uint32_t cmd_overflows = 0;  // UI commands dropped because the queue was full
+
+    void printBodyStatus();   // Real body hardware state from TELEMETRY (USB "body")
+    void printFlushStats();   // Render mode, FPS, frame time and PSRAM writes (USB "fb")
+    void printFrameTiming();  // LVGL stage time histograms (USB "ft")
+    void printMemStats();     // LVGL heap per size class and tier, system heaps (USB "mem")
+    void printScreens();      // Screens built, build times, trims (USB "scr")
+
 private:
-    void sendJSON();
+    TaskHandle_t io_task = nullptr;   // Woken by post() and the RS485 RX task
+    AppCommand cmd_ring[APP_CMD_QUEUE_SIZE];
+    std::atomic<uint32_t> cmd_head{0};   // Written by producer
+    std::atomic<uint32_t> cmd_tail{0};   // Written by consumer
+
+    void applyCommand(const AppCommand &cmd);
+    MixerLinkState currentState() const;
+    void handleCommand(const String &input);
 };
 
 extern AppDataManager AppData;
@@ -23,7 +23,7 @@
 /*=========================
    MEMORY SETTINGS
  *=========================*/
-#define LV_MEM_CUSTOM 0
+#define LV_MEM_CUSTOM 1      // ui_mem.cpp: internal SRAM slab, heap and PSRAM tiers
 #if LV_MEM_CUSTOM == 0
     #define LV_MEM_SIZE (64U * 1024U)
     #define LV_MEM_ADR 0
@@ -32,10 +32,10 @@
         #undef LV_MEM_POOL_ALLOC
     #endif
 #else
-    #define LV_MEM_CUSTOM_INCLUDE <stdlib.h>
-    #define LV_MEM_CUSTOM_ALLOC   malloc
-    #define LV_MEM_CUSTOM_FREE    free
-    #define LV_MEM_CUSTOM_REALLOC realloc
+    #define LV_MEM_CUSTOM_INCLUDE "ui_mem.h"
+    #define LV_MEM_CUSTOM_ALLOC   ui_mem_alloc
+    #define LV_MEM_CUSTOM_FREE    ui_mem_free
+    #define LV_MEM_CUSTOM_REALLOC ui_mem_realloc
 #endif
 #define LV_MEM_BUF_MAX_NUM 16
 #define LV_MEMCPY_MEMSET_STD 0
@@ -68,7 +68,7 @@
 
 #define LV_LAYER_SIMPLE_BUF_SIZE          (24 * 1024)
 #define LV_LAYER_SIMPLE_FALLBACK_BUF_SIZE (3 * 1024)
-#define LV_IMG_CACHE_DEF_SIZE 0
+#define LV_IMG_CACHE_DEF_SIZE 0     /*Images are blended from flash as is (tools/ui_assets.py), nothing to cache*/
 #define LV_GRADIENT_MAX_STOPS 2
 #define LV_GRAD_CACHE_DEF_SIZE 0
 #define LV_DITHER_GRADIENT 0
@@ -4,9 +4,22 @@
 #include "ui/ui.h"
 #include "bsp.h"
 #include "app_data.h"
+#include "ui_blend.h"
+#include "ui_corner_cache.h"
+#include "ui_style_cache.h"
+#include "ui_screens.h"
 
 // Defined in ui_events_impl.cpp
 extern void ui_screen2_add_power_toggle(void);
+extern void ui_sliders_add_release_flush(void);
+
+// Each screen as ui_screens.cpp builds it: the app's additions, the current values
+static void screen_built(UiScreenId id, lv_obj_t *screen) {
+    if (id == UI_SCREEN_2) ui_screen2_add_power_toggle();  // Power sensing toggle on Screen 2
+    ui_sliders_add_release_flush(); // Final RS485 frame when a slider is released
+    AppData.syncUI();
+    ui_style_cache_enable(screen);  // Resolved styles per object (ui_style_cache.h)
+}
 
 void setup() {
     Serial.begin(115200);
@@ -21,23 +34,22 @@ void setup() {
 
     // 2. Initialize BSP (IO Expander, LCD, Touch, LVGL)
     //    This also starts the LVGL task on Core 1
-    bsp_init();
+    bsp_init((BspRenderMode)AppData.render_mode);
 
     // 3. Initialize UI (must be done inside LVGL mutex)
     bsp_lvgl_lock(-1);
-    ui_init();
-    AppData.syncUI();
-    ui_screen2_add_power_toggle();  // Add power sensing toggle to Screen 2
+    ui_blend_install(lv_disp_get_default());    // Word-wide fills (ui_blend.h)
+    ui_corner_cache_install(lv_disp_get_default()); // Cached rounded corners (ui_corner_cache.h)
+    ui_screens_init(screen_built, 1u << UI_SCREEN_1);  // Splash now, Screen1 while it shows (ui_screens.h)
     bsp_lvgl_unlock();
+    UiScreensStats screens = ui_screens_stats();
+    Serial.printf("Splash built in %u us\n", screens.build_us[UI_SCREEN_3]);
 
     Serial.println("=== Setup Complete ===");
     Serial.printf("Free Heap after init: %d bytes\n", ESP.getFreeHeap());
 }
 
 void loop() {
-    // RS485 Listener
-    AppData.handleIncomingData(Serial1);
-    
     // USB Serial Listener (For Testing)
     AppData.handleIncomingData(Serial);
     
@@ -67,10 +79,10 @@ void loop() {
                     }
                     if (!system_was_on) {
                         Serial.println("Power: Switch ON detected. Waking up.");
-                        bsp_set_backlight(true);
+                        bsp_set_display_active(true);
                         
                         bsp_lvgl_lock(-1);
-                        _ui_screen_change(&ui_Screen3, LV_SCR_LOAD_ANIM_NONE, 0, 0, &ui_Screen3_screen_init);
+                        ui_screens_load(UI_SCREEN_3, LV_SCR_LOAD_ANIM_NONE, 0, 0);
                         bsp_lvgl_unlock();
                         
                         system_was_on = true;
@@ -88,16 +100,12 @@ void loop() {
                     if (shutdown_pending && (millis() - shutdown_timer_start > 15000)) {
                         // 15 seconds passed — execute shutdown
                         Serial.println("Power: Shutdown timer expired. Turning off.");
-                        bsp_set_backlight(false);
+                        bsp_set_display_active(false);
                         AppData.music_relay_state = false;
                         AppData.sendUpdate();
                         
                         // Send shutdown command to second controller
-                        StaticJsonDocument<64> shutdownDoc;
-                        shutdownDoc["pwr"] = 0;
-                        serializeJson(shutdownDoc, Serial1);
-                        Serial1.println();
-                        Serial.println("RS485 TX: {\"pwr\":0}");
+                        AppData.sendShutdown();
                         
                         system_was_on = false;
                         shutdown_pending = false;
@@ -118,6 +126,17 @@ void loop() {
         last_save = millis();
     }
     
-    // Small yield - LVGL runs in its own task, so loop just handles I/O
-    vTaskDelay(pdMS_TO_TICKS(10));
+    // UI commands posted by the LVGL task, then coalesced / rate-limited TX
+    AppData.processCommands();
+    AppData.serviceTx();
+    
+    // RS485 messages from the RX task
+    MixerLinkRxItem item;
+    while (AppData.link.receive(item, 0)) {
+        AppData.handleLinkMessage(item);
+    }
+    
+    // Sleep until the UI or the RS485 RX task posts something, or TX is due
+    // (LVGL runs in its own task, so loop just handles I/O)
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(AppData.txWaitMs(10)));
 }
@@ -2,6 +2,7 @@
  * Size: 30 px
  * Bpp: 4
  * Opts: --bpp 4 --size 30 --font C:/Users/25236/SquareLine/assets/Heebo-VariableFont_wght.ttf -o C:/Users/25236/SquareLine/assets\ui_font_Hebrew30.c --format lvgl -r 0x20-0x7f --symbols אבגדהוזחטיכלמנסעפצקרשתםןץףך --no-compress --no-prefilter
+ * ui_fonts.py: 27 of 122 glyphs: " "0134569אבדהוזחטיכמןנעפקרת"
  ******************************************************************************/
 
 #include "../ui.h"
@@ -20,237 +21,12 @@
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
-    /* U+0021 "!" */
-    0x8f, 0xf4, 0x8f, 0xf4, 0x8f, 0xf4, 0x8f, 0xf4,
-    0x7f, 0xf4, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
-    0x6f, 0xf3, 0x6f, 0xf2, 0x6f, 0xf2, 0x6f, 0xf2,
-    0x6f, 0xf2, 0x5f, 0xf2, 0x5f, 0xf1, 0x2, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe3, 0x9f, 0xf8,
-    0x3e, 0xe3,
-
     /* U+0022 "\"" */
     0xff, 0x10, 0xff, 0xf, 0xf1, 0xf, 0xf0, 0xff,
     0x0, 0xff, 0xf, 0xf0, 0xf, 0xe0, 0xfd, 0x0,
     0xfd, 0xf, 0xc0, 0xf, 0xb0, 0xfb, 0x0, 0xfa,
     0x2, 0x10, 0x2, 0x10,
 
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0,
-    0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x70, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0xef, 0x30, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x6, 0xfa, 0x0, 0x7, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf7, 0x0, 0xa, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0xe,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0,
-    0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x4f, 0xd0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xdf, 0x40, 0x0, 0xdf, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0x1, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0, 0xa,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0,
-    0xd, 0xf4, 0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5a, 0xff, 0xfc, 0x71, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0xaf, 0xfe,
-    0x85, 0x6c, 0xff, 0xe1, 0x0, 0x2f, 0xfd, 0x0,
-    0x0, 0xa, 0xff, 0x70, 0x7, 0xff, 0x50, 0x0,
-    0x0, 0x1f, 0xfd, 0x0, 0x8f, 0xf3, 0x0, 0x0,
-    0x0, 0xcf, 0xf0, 0x7, 0xff, 0x50, 0x0, 0x0,
-    0x6, 0x99, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfd, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xe8, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xaf, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x25,
-    0x52, 0x0, 0x0, 0x0, 0xa, 0xff, 0x25, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0x2f, 0xfb,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x20, 0xdf, 0xf5,
-    0x0, 0x0, 0x5, 0xff, 0xd0, 0x4, 0xff, 0xfb,
-    0x75, 0x6b, 0xff, 0xf5, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x1, 0x8c, 0xff,
-    0xfc, 0x81, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x84, 0x0,
-    0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x5c, 0xfe, 0xb4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xcd, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x5f,
-    0xe0, 0x0, 0x0, 0x72, 0x0, 0x0, 0x6f, 0xb0,
-    0x0, 0xd, 0xf3, 0x0, 0x6, 0xfb, 0x0, 0x0,
-    0x7f, 0x90, 0x0, 0xc, 0xf4, 0x0, 0x1e, 0xf1,
-    0x0, 0x0, 0x6f, 0xb0, 0x0, 0xd, 0xf3, 0x0,
-    0xbf, 0x60, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x5f,
-    0xe0, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xcd, 0xff, 0x50, 0x1e, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x5c, 0xff, 0xb4, 0x0, 0xaf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x70, 0x6, 0xab, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0xcf, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x8,
-    0xfc, 0x20, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x9f,
-    0x80, 0xe, 0xf2, 0x0, 0x9, 0xf8, 0x0, 0x0,
-    0x4, 0xfd, 0x0, 0xf, 0xf0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0xd, 0xf3, 0x0, 0x1f, 0xf0, 0x0,
-    0x5, 0xfa, 0x0, 0x0, 0x9f, 0x90, 0x0, 0xf,
-    0xf1, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x6d, 0x0,
-    0x0, 0xa, 0xf9, 0x0, 0x1e, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0xec, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xef,
-    0xd7, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x3a, 0xef, 0xea, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x63, 0x5d, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x9f, 0xf5, 0x0, 0x2,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0,
-    0x0, 0xef, 0x90, 0x0, 0x0, 0x0, 0xbf, 0xf1,
-    0x0, 0x1, 0xff, 0x70, 0x0, 0x0, 0x0, 0x8f,
-    0xf6, 0x0, 0x1c, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x14, 0xef, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc, 0xef, 0xf6,
-    0x0, 0x1, 0xcc, 0x30, 0x9, 0xff, 0x90, 0x1e,
-    0xff, 0x40, 0x3, 0xff, 0x30, 0x2f, 0xfc, 0x0,
-    0x3, 0xff, 0xf2, 0x7, 0xff, 0x10, 0x6f, 0xf5,
-    0x0, 0x0, 0x4f, 0xfe, 0x1c, 0xfd, 0x0, 0x7f,
-    0xf4, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf7, 0x0,
-    0x5f, 0xf7, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0,
-    0x0, 0xf, 0xfe, 0x20, 0x0, 0x0, 0x3f, 0xff,
-    0xd0, 0x0, 0x6, 0xff, 0xf8, 0x43, 0x5a, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xfe, 0x7e, 0xff, 0x40, 0x0, 0x2, 0x8c, 0xef,
-    0xeb, 0x60, 0x2, 0xff, 0xf3,
-
-    /* U+0027 "'" */
-    0x7f, 0xb7, 0xfb, 0x7f, 0xa7, 0xf9, 0x7f, 0x87,
-    0xf7, 0x7f, 0x60,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0x0, 0x6, 0x30, 0x0, 0x0, 0x9,
-    0xf9, 0x0, 0x0, 0x9, 0xfe, 0x20, 0x0, 0x6,
-    0xff, 0x30, 0x0, 0x1, 0xff, 0x70, 0x0, 0x0,
-    0xaf, 0xd0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x0,
-    0x9, 0xff, 0x0, 0x0, 0x0, 0xef, 0xa0, 0x0,
-    0x0, 0x4f, 0xf5, 0x0, 0x0, 0x7, 0xff, 0x20,
-    0x0, 0x0, 0xbf, 0xf0, 0x0, 0x0, 0xd, 0xfd,
-    0x0, 0x0, 0x0, 0xef, 0xc0, 0x0, 0x0, 0xf,
-    0xfb, 0x0, 0x0, 0x0, 0xff, 0xb0, 0x0, 0x0,
-    0xf, 0xfb, 0x0, 0x0, 0x0, 0xef, 0xc0, 0x0,
-    0x0, 0xd, 0xfd, 0x0, 0x0, 0x0, 0xaf, 0xf0,
-    0x0, 0x0, 0x7, 0xff, 0x20, 0x0, 0x0, 0x4f,
-    0xf6, 0x0, 0x0, 0x0, 0xef, 0xa0, 0x0, 0x0,
-    0x9, 0xff, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0,
-    0x0, 0x0, 0xaf, 0xd0, 0x0, 0x0, 0x1, 0xff,
-    0x60, 0x0, 0x0, 0x5, 0xff, 0x20, 0x0, 0x0,
-    0x8, 0xfd, 0x10, 0x0, 0x0, 0x9, 0xf9, 0x0,
-    0x0, 0x0, 0x6, 0x30,
-
-    /* U+0029 ")" */
-    0x9, 0x0, 0x0, 0x0, 0x4, 0xfc, 0x10, 0x0,
-    0x0, 0xa, 0xfc, 0x0, 0x0, 0x0, 0xd, 0xfa,
-    0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0, 0x0, 0x0,
-    0xaf, 0xe0, 0x0, 0x0, 0x2, 0xff, 0x60, 0x0,
-    0x0, 0xc, 0xfd, 0x0, 0x0, 0x0, 0x6f, 0xf3,
-    0x0, 0x0, 0x2, 0xff, 0x80, 0x0, 0x0, 0xe,
-    0xfc, 0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0, 0x0,
-    0x9, 0xff, 0x20, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x7, 0xff, 0x40, 0x0, 0x0, 0x6f, 0xf5,
-    0x0, 0x0, 0x7, 0xff, 0x40, 0x0, 0x0, 0x7f,
-    0xf3, 0x0, 0x0, 0x9, 0xff, 0x20, 0x0, 0x0,
-    0xbf, 0xf0, 0x0, 0x0, 0xd, 0xfc, 0x0, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0x0, 0x5f, 0xf3, 0x0,
-    0x0, 0xb, 0xfd, 0x0, 0x0, 0x1, 0xff, 0x60,
-    0x0, 0x0, 0x8f, 0xe0, 0x0, 0x0, 0x2f, 0xf4,
-    0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0xa, 0xfc,
-    0x0, 0x0, 0x4, 0xfc, 0x10, 0x0, 0x0, 0x8,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf8, 0x0, 0x0, 0x0, 0x71, 0x0, 0x8f, 0x80,
-    0x1, 0x50, 0x4f, 0xfb, 0x58, 0xf8, 0x4a, 0xff,
-    0x25, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x27, 0xcf, 0xff, 0xd9, 0x40, 0x0, 0x0, 0xa,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x6, 0xff, 0x8f,
-    0xf2, 0x0, 0x0, 0x2, 0xff, 0x70, 0xbf, 0xd0,
-    0x0, 0x0, 0xcf, 0xd0, 0x2, 0xff, 0x90, 0x0,
-    0x5, 0xe3, 0x0, 0x7, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x28, 0x83, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0x28, 0x88, 0x88, 0xdf, 0xff, 0x88, 0x88, 0x82,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x28, 0x83, 0x0, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x2, 0xff, 0x80, 0x2f, 0xf8, 0x2, 0xff, 0x80,
-    0x4f, 0xf5, 0x9, 0xff, 0x1, 0xff, 0x80, 0x4f,
-    0xc0, 0x0, 0x21, 0x0,
-
-    /* U+002D "-" */
-    0x13, 0x33, 0x33, 0x32, 0x7f, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0xfb,
-
-    /* U+002E "." */
-    0x2, 0x0, 0x8f, 0xf3, 0xdf, 0xf7, 0x6f, 0xd2,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x8, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x6, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0, 0x0, 0x0,
-    0x0, 0x0,
-
     /* U+0030 "0" */
     0x0, 0x0, 0x6c, 0xef, 0xeb, 0x50, 0x0, 0x0,
     0x2, 0xdf, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
@@ -287,28 +63,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xfb, 0x0, 0x0, 0x0, 0xff, 0xb0, 0x0, 0x0,
     0xf, 0xfb, 0x0, 0x0, 0x0, 0xff, 0xb0,
 
-    /* U+0032 "2" */
-    0x0, 0x1, 0x8c, 0xef, 0xeb, 0x60, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x5,
-    0xff, 0xf8, 0x43, 0x5c, 0xff, 0xd0, 0x0, 0xef,
-    0xe2, 0x0, 0x0, 0xc, 0xff, 0x60, 0x5f, 0xf7,
-    0x0, 0x0, 0x0, 0x3f, 0xfa, 0x8, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xff, 0xc0, 0x46, 0x60, 0x0,
-    0x0, 0x0, 0xf, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0x82, 0x22, 0x22, 0x22, 0x22, 0x23, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-
     /* U+0033 "3" */
     0x0, 0x2, 0x8d, 0xef, 0xea, 0x50, 0x0, 0x0,
     0x7f, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x7, 0xff,
@@ -398,50 +152,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x5f, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
     0x29, 0xdf, 0xec, 0x70, 0x0, 0x0,
 
-    /* U+0037 "7" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x29, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x7c, 0xef, 0xeb, 0x60, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x1,
-    0xef, 0xfa, 0x43, 0x5c, 0xff, 0xd0, 0x0, 0x8f,
-    0xf7, 0x0, 0x0, 0xa, 0xff, 0x60, 0xc, 0xff,
-    0x0, 0x0, 0x0, 0x2f, 0xf9, 0x0, 0xdf, 0xe0,
-    0x0, 0x0, 0x0, 0xff, 0xa0, 0xa, 0xff, 0x10,
-    0x0, 0x0, 0x3f, 0xf8, 0x0, 0x3f, 0xfb, 0x0,
-    0x0, 0x1c, 0xff, 0x10, 0x0, 0x6f, 0xfe, 0x98,
-    0x9e, 0xff, 0x40, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x4e, 0xff, 0xee, 0xff,
-    0xfd, 0x30, 0x0, 0x3f, 0xfc, 0x10, 0x0, 0x3d,
-    0xfe, 0x10, 0xc, 0xfe, 0x10, 0x0, 0x0, 0x2f,
-    0xfa, 0x2, 0xff, 0x90, 0x0, 0x0, 0x0, 0xbf,
-    0xf0, 0x4f, 0xf6, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x24, 0xff, 0x70, 0x0, 0x0, 0x0, 0x9f, 0xf2,
-    0x2f, 0xfb, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0,
-    0xcf, 0xf4, 0x0, 0x0, 0x7, 0xff, 0x90, 0x3,
-    0xff, 0xf9, 0x43, 0x4a, 0xff, 0xe1, 0x0, 0x4,
-    0xef, 0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x1,
-    0x7c, 0xef, 0xeb, 0x60, 0x0, 0x0,
-
     /* U+0039 "9" */
     0x0, 0x1, 0x7c, 0xef, 0xd8, 0x20, 0x0, 0x0,
     0x3e, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x2, 0xff,
@@ -463,1345 +173,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xff, 0xfb, 0x10, 0x0, 0x0, 0x8, 0xfe, 0xc8,
     0x20, 0x0, 0x0,
 
-    /* U+003A ":" */
-    0x8, 0xfc, 0x0, 0xff, 0xf4, 0xb, 0xfe, 0x10,
-    0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20,
-    0x0, 0xbf, 0xe1, 0xf, 0xff, 0x40, 0x9f, 0xc0,
-
-    /* U+003B ";" */
-    0x1, 0xcf, 0x70, 0x5f, 0xff, 0x2, 0xff, 0xa0,
-    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44,
-    0x30, 0xf, 0xfb, 0x0, 0xff, 0xb0, 0xf, 0xfa,
-    0x2, 0xff, 0x70, 0x8f, 0xf1, 0x1f, 0xf8, 0x1,
-    0xab, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xcf, 0xf0, 0x0, 0x0, 0x0,
-    0x6d, 0xff, 0xff, 0x0, 0x0, 0x17, 0xef, 0xff,
-    0xe8, 0x10, 0x2, 0x9f, 0xff, 0xfc, 0x50, 0x0,
-    0xa, 0xff, 0xff, 0x92, 0x0, 0x0, 0x0, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb,
-    0x50, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xe8,
-    0x10, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff, 0xb4,
-    0x0, 0x0, 0x0, 0x2, 0x9f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0xef, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+003D "=" */
-    0x5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x40, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-
-    /* U+003E ">" */
-    0x2a, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xfe, 0x71, 0x0, 0x0, 0x0, 0x1, 0x7d, 0xff,
-    0xff, 0x92, 0x0, 0x0, 0x0, 0x0, 0x39, 0xff,
-    0xff, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x6, 0xcf,
-    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xff, 0xf4,
-    0x0, 0x0, 0x17, 0xef, 0xff, 0xd6, 0x0, 0x0,
-    0x4b, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x2e, 0xff,
-    0xff, 0x92, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x81,
-    0x0, 0x0, 0x0, 0x0, 0x3d, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x18, 0xdf, 0xfe, 0xa3, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x2f, 0xff, 0xb6, 0x69,
-    0xff, 0xf4, 0x9f, 0xf6, 0x0, 0x0, 0x5f, 0xfb,
-    0xdf, 0xf0, 0x0, 0x0, 0xe, 0xfe, 0x22, 0x10,
-    0x0, 0x0, 0xc, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x30, 0x0, 0x0, 0x2, 0xef,
-    0xf4, 0x0, 0x0, 0x0, 0xd, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x6f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xec,
-    0x94, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x9f, 0xff, 0xff, 0xef, 0xff, 0xfd, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xe8, 0x30, 0x0,
-    0x2, 0x5b, 0xff, 0x90, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
-    0x90, 0x0, 0x0, 0x2, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0x50, 0x0, 0x0,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x8, 0xef, 0xea, 0x20, 0x0, 0x9, 0xf6, 0x0,
-    0xe, 0xf4, 0x0, 0x0, 0x1d, 0xff, 0xef, 0xff,
-    0x90, 0x0, 0x3f, 0xb0, 0x5, 0xfd, 0x0, 0x0,
-    0xd, 0xfc, 0x20, 0xf, 0xf9, 0x0, 0x0, 0xef,
-    0x0, 0x9f, 0x80, 0x0, 0x7, 0xfd, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0xb, 0xf3, 0xe, 0xf3, 0x0,
-    0x0, 0xff, 0x50, 0x0, 0xd, 0xf5, 0x0, 0x0,
-    0x8f, 0x51, 0xff, 0x0, 0x0, 0x5f, 0xf0, 0x0,
-    0x0, 0xef, 0x40, 0x0, 0x7, 0xf6, 0x2f, 0xe0,
-    0x0, 0x9, 0xfb, 0x0, 0x0, 0xf, 0xf2, 0x0,
-    0x0, 0x7f, 0x64, 0xfd, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x1, 0xff, 0x10, 0x0, 0x8, 0xf6, 0x4f,
-    0xd0, 0x0, 0xe, 0xf6, 0x0, 0x0, 0x2f, 0xf0,
-    0x0, 0x0, 0x9f, 0x44, 0xfd, 0x0, 0x0, 0xff,
-    0x50, 0x0, 0x7, 0xfe, 0x0, 0x0, 0xc, 0xf2,
-    0x3f, 0xe0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0xef,
-    0xd0, 0x0, 0x1, 0xfd, 0x1, 0xff, 0x10, 0x0,
-    0xcf, 0xb0, 0x0, 0x2f, 0xfe, 0x0, 0x0, 0x8f,
-    0x70, 0xe, 0xf4, 0x0, 0x7, 0xff, 0x71, 0x4e,
-    0xff, 0xf5, 0x0, 0x6f, 0xe0, 0x0, 0x9f, 0x90,
-    0x0, 0x1d, 0xff, 0xff, 0xe2, 0x9f, 0xfc, 0xef,
-    0xe3, 0x0, 0x4, 0xff, 0x10, 0x0, 0x2a, 0xef,
-    0xa1, 0x0, 0x8e, 0xfe, 0x91, 0x0, 0x0, 0xc,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfd,
-    0x61, 0x0, 0x0, 0x4, 0xa1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3c, 0xff, 0xff, 0xdd, 0xef,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x8c, 0xef, 0xfe, 0xc8, 0x30, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfe, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf6, 0xcf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf1, 0x6f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xa0, 0x1f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x40, 0xa, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfe, 0x0, 0x5, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9, 0x0, 0x0,
-    0xef, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3,
-    0x0, 0x0, 0x9f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xd0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x70, 0x0, 0x0, 0xd, 0xfe,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x7f,
-    0xfa, 0x44, 0x44, 0x44, 0x44, 0xff, 0xf1, 0x0,
-    0x0, 0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf7, 0x0, 0x3, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfd, 0x0, 0xa, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0xf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90,
-    0x6f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xf0,
-
-    /* U+0042 "B" */
-    0x8f, 0xff, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x8f,
-    0xf8, 0x44, 0x44, 0x58, 0xef, 0xfa, 0x8, 0xff,
-    0x50, 0x0, 0x0, 0x1, 0xef, 0xf1, 0x8f, 0xf5,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x58, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x6f, 0xf6, 0x8f, 0xf5, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x48, 0xff, 0x50, 0x0,
-    0x0, 0x2, 0xff, 0xe0, 0x8f, 0xf8, 0x67, 0x77,
-    0x8b, 0xff, 0xf3, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc2, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa1, 0x8, 0xff, 0x50, 0x0, 0x0, 0x29,
-    0xff, 0xd0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x78, 0xff, 0x50, 0x0, 0x0, 0x0, 0x1f,
-    0xfd, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xf8, 0xff, 0x50, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x2, 0xff, 0xc8,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x8f,
-    0xf8, 0x44, 0x44, 0x47, 0xef, 0xfd, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x8f, 0xff,
-    0xff, 0xff, 0xfe, 0xa5, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xec, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0xb, 0xff, 0xf9, 0x64, 0x6a,
-    0xff, 0xf5, 0x0, 0x0, 0x8f, 0xfc, 0x10, 0x0,
-    0x0, 0x3f, 0xff, 0x10, 0x3, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x9, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xe0, 0xe, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0xd1, 0x1f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9c, 0xc1, 0x9,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xff, 0xe0,
-    0x3, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x80, 0x0, 0x9f, 0xfb, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x10, 0x0, 0xc, 0xff, 0xe8, 0x54, 0x6a,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x3, 0x9d,
-    0xff, 0xdb, 0x61, 0x0, 0x0,
-
-    /* U+0044 "D" */
-    0x8f, 0xff, 0xff, 0xff, 0xc9, 0x30, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0,
-    0x8f, 0xf9, 0x44, 0x46, 0x8e, 0xff, 0xe3, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x8f, 0xfe, 0x10,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x7, 0xff, 0xa0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfe,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfe,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfe,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x8, 0xff, 0xa0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x9f, 0xfd, 0x0,
-    0x8f, 0xf9, 0x44, 0x46, 0x9f, 0xff, 0xe2, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0,
-    0x8f, 0xff, 0xff, 0xfe, 0xc8, 0x30, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x8f,
-    0xf9, 0x44, 0x44, 0x44, 0x44, 0x43, 0x8, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x8, 0xff, 0x94, 0x44, 0x44, 0x44,
-    0x42, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf9, 0x44, 0x44, 0x44, 0x44, 0x44, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-
-    /* U+0046 "F" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x8f, 0xf9,
-    0x44, 0x44, 0x44, 0x44, 0x43, 0x8f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf9, 0x44, 0x44, 0x44, 0x44, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x8f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xec, 0x82, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x1d, 0xff, 0xf9, 0x64, 0x6a,
-    0xff, 0xfa, 0x0, 0x0, 0xaf, 0xfc, 0x10, 0x0,
-    0x0, 0x2d, 0xff, 0x50, 0x3, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x8, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xd, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfa, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xf3, 0x3f, 0xfa, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xf3, 0x2f, 0xfb, 0x0, 0x0,
-    0x2, 0x44, 0x44, 0xbf, 0xf3, 0xf, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3, 0xd, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3, 0x8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3,
-    0x1, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf3, 0x0, 0x7f, 0xfe, 0x30, 0x0, 0x0, 0x2,
-    0xdf, 0xf3, 0x0, 0x9, 0xff, 0xfb, 0x64, 0x46,
-    0xaf, 0xff, 0xb0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1, 0x7c,
-    0xef, 0xfe, 0xb7, 0x10, 0x0,
-
-    /* U+0048 "H" */
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xe8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfe, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xe8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfe, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xe8, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfe, 0x8f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xe8, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfe, 0x8f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xe8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0x94,
-    0x44, 0x44, 0x44, 0x44, 0x4f, 0xfe, 0x8f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xe8, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfe, 0x8f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xe8,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfe,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xe8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfe, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xe8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfe, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xe0,
-
-    /* U+0049 "I" */
-    0x5f, 0xf8, 0x5f, 0xf8, 0x5f, 0xf8, 0x5f, 0xf8,
-    0x5f, 0xf8, 0x5f, 0xf8, 0x5f, 0xf8, 0x5f, 0xf8,
-    0x5f, 0xf8, 0x5f, 0xf8, 0x5f, 0xf8, 0x5f, 0xf8,
-    0x5f, 0xf8, 0x5f, 0xf8, 0x5f, 0xf8, 0x5f, 0xf8,
-    0x5f, 0xf8, 0x5f, 0xf8, 0x5f, 0xf8, 0x5f, 0xf8,
-    0x5f, 0xf8,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf4, 0x1, 0x10, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x32, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
-    0xf, 0xfd, 0x0, 0x0, 0x0, 0xe, 0xff, 0x0,
-    0xbf, 0xf7, 0x0, 0x0, 0x9, 0xff, 0xa0, 0x3,
-    0xff, 0xfb, 0x64, 0x6c, 0xff, 0xe2, 0x0, 0x5,
-    0xef, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x1,
-    0x7c, 0xef, 0xec, 0x70, 0x0, 0x0,
-
-    /* U+004B "K" */
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfb,
-    0x8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x9f, 0xfc,
-    0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x8f, 0xfd,
-    0x10, 0x8, 0xff, 0x50, 0x0, 0x0, 0x6f, 0xfe,
-    0x10, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x5f, 0xff,
-    0x20, 0x0, 0x8, 0xff, 0x50, 0x0, 0x4f, 0xff,
-    0x30, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x3f, 0xff,
-    0x50, 0x0, 0x0, 0x8, 0xff, 0x50, 0x2e, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x1d, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x8, 0xff, 0x6d, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xad, 0xff, 0x80, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xa0, 0x2f, 0xff, 0x40, 0x0, 0x0, 0x8, 0xff,
-    0xf0, 0x0, 0x5f, 0xfe, 0x20, 0x0, 0x0, 0x8f,
-    0xf5, 0x0, 0x0, 0x8f, 0xfc, 0x0, 0x0, 0x8,
-    0xff, 0x50, 0x0, 0x0, 0xcf, 0xf9, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x1, 0xef, 0xf6, 0x0,
-    0x8, 0xff, 0x50, 0x0, 0x0, 0x4, 0xff, 0xf2,
-    0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xd0, 0x8, 0xff, 0x50, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xa0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0x70,
-
-    /* U+004C "L" */
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf9,
-    0x44, 0x44, 0x44, 0x44, 0x41, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6,
-
-    /* U+004D "M" */
-    0x8f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xfb, 0x8f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x8f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfb, 0x8f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xfb, 0x8f, 0xfd, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xee, 0xfb, 0x8f,
-    0xf7, 0xff, 0x50, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x8e, 0xfb, 0x8f, 0xf2, 0xef, 0xc0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x2e, 0xfb, 0x8f, 0xf2, 0x8f,
-    0xf2, 0x0, 0x0, 0x0, 0xf, 0xfb, 0xf, 0xfb,
-    0x8f, 0xf2, 0x2f, 0xf9, 0x0, 0x0, 0x0, 0x6f,
-    0xf5, 0xf, 0xfb, 0x8f, 0xf3, 0xb, 0xff, 0x0,
-    0x0, 0x0, 0xcf, 0xe0, 0xf, 0xfb, 0x8f, 0xf3,
-    0x4, 0xff, 0x60, 0x0, 0x3, 0xff, 0x70, 0xf,
-    0xfb, 0x8f, 0xf4, 0x0, 0xef, 0xc0, 0x0, 0x9,
-    0xff, 0x10, 0x1f, 0xfb, 0x8f, 0xf4, 0x0, 0x7f,
-    0xf3, 0x0, 0xf, 0xfa, 0x0, 0x1f, 0xfb, 0x8f,
-    0xf4, 0x0, 0x1f, 0xf9, 0x0, 0x6f, 0xf4, 0x0,
-    0x1f, 0xfb, 0x8f, 0xf4, 0x0, 0xa, 0xff, 0x0,
-    0xdf, 0xd0, 0x0, 0x1f, 0xfb, 0x8f, 0xf4, 0x0,
-    0x4, 0xff, 0x63, 0xff, 0x70, 0x0, 0x1f, 0xfb,
-    0x8f, 0xf4, 0x0, 0x0, 0xdf, 0xda, 0xff, 0x10,
-    0x0, 0x1f, 0xfb, 0x8f, 0xf4, 0x0, 0x0, 0x6f,
-    0xff, 0xf9, 0x0, 0x0, 0x1f, 0xfb, 0x8f, 0xf4,
-    0x0, 0x0, 0xf, 0xff, 0xf3, 0x0, 0x0, 0x1f,
-    0xfb, 0x8f, 0xf4, 0x0, 0x0, 0x9, 0xff, 0xc0,
-    0x0, 0x0, 0x1f, 0xfb, 0x8f, 0xf4, 0x0, 0x0,
-    0x3, 0xff, 0x60, 0x0, 0x0, 0x1f, 0xfb,
-
-    /* U+004E "N" */
-    0x8f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xe8, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfe, 0x8f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xe8, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0xf, 0xfe, 0x8f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xff, 0xe8, 0xff, 0x8f, 0xfe, 0x0, 0x0,
-    0x0, 0xf, 0xfe, 0x8f, 0xf5, 0x8f, 0xf9, 0x0,
-    0x0, 0x0, 0xff, 0xe8, 0xff, 0x50, 0xdf, 0xf4,
-    0x0, 0x0, 0xf, 0xfe, 0x8f, 0xf5, 0x3, 0xff,
-    0xd0, 0x0, 0x0, 0xff, 0xe8, 0xff, 0x50, 0x9,
-    0xff, 0x90, 0x0, 0xf, 0xfe, 0x8f, 0xf5, 0x0,
-    0xd, 0xff, 0x40, 0x0, 0xff, 0xe8, 0xff, 0x50,
-    0x0, 0x3f, 0xfd, 0x0, 0xf, 0xfe, 0x8f, 0xf5,
-    0x0, 0x0, 0x9f, 0xf9, 0x0, 0xff, 0xe8, 0xff,
-    0x50, 0x0, 0x0, 0xdf, 0xf3, 0xf, 0xfe, 0x8f,
-    0xf5, 0x0, 0x0, 0x4, 0xff, 0xd0, 0xff, 0xe8,
-    0xff, 0x50, 0x0, 0x0, 0x9, 0xff, 0x8f, 0xfe,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xe8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xfe, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xe8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xfe, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xe0,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x2, 0x8c, 0xff, 0xeb, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xfe,
-    0x50, 0x0, 0x0, 0xb, 0xff, 0xfb, 0x76, 0x8d,
-    0xff, 0xf6, 0x0, 0x0, 0x8f, 0xfd, 0x20, 0x0,
-    0x0, 0x5f, 0xff, 0x30, 0x2, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xc0, 0x8, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2, 0xd, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7, 0x1f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb,
-    0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfd, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfd, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xfe, 0x4f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfd, 0x3f, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfd, 0x1f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb, 0xd, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7, 0x8,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3,
-    0x2, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xc0, 0x0, 0x8f, 0xfd, 0x20, 0x0, 0x0, 0x4f,
-    0xff, 0x30, 0x0, 0xb, 0xff, 0xfa, 0x76, 0x8c,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x2, 0x8c,
-    0xff, 0xec, 0x71, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x8f, 0xff, 0xff, 0xff, 0xfe, 0xc7, 0x10, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x8f, 0xf8, 0x44, 0x44, 0x46, 0xaf, 0xff, 0x70,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf1,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf9,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x2, 0xef, 0xf3,
-    0x8f, 0xf9, 0x44, 0x44, 0x45, 0x9f, 0xff, 0x90,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x30, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xfe,
-    0x40, 0x0, 0x0, 0xc, 0xff, 0xfa, 0x76, 0x8d,
-    0xff, 0xf4, 0x0, 0x0, 0xaf, 0xfc, 0x10, 0x0,
-    0x0, 0x7f, 0xff, 0x20, 0x3, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xa0, 0xa, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf1, 0xf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0x3f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9,
-    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xfb, 0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfc, 0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x6f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfc, 0x5f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xfb, 0x3f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0xf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0xb,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf1,
-    0x4, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xa0, 0x0, 0xaf, 0xfc, 0x10, 0x0, 0x0, 0x6f,
-    0xff, 0x20, 0x0, 0xc, 0xff, 0xfa, 0x76, 0x8e,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3, 0x9d,
-    0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x0,
-
-    /* U+0052 "R" */
-    0x8f, 0xff, 0xff, 0xff, 0xed, 0x94, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0,
-    0x8f, 0xf8, 0x44, 0x44, 0x58, 0xef, 0xfd, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0xc, 0xff, 0x70,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x2, 0xff, 0xc0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0xa, 0xff, 0x80,
-    0x8f, 0xf5, 0x0, 0x0, 0x14, 0xcf, 0xfd, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x8f, 0xf9, 0x44, 0x44, 0xdf, 0xf6, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x8, 0xff, 0x70, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x1, 0xff, 0xe1, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0xe, 0xff, 0x10,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x6, 0xff, 0x90,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfa,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x5a, 0xdf, 0xfd, 0xb5, 0x0, 0x0,
-    0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0,
-    0x2, 0xef, 0xfc, 0x75, 0x56, 0xbf, 0xff, 0x30,
-    0xa, 0xff, 0x80, 0x0, 0x0, 0x5, 0xff, 0xe0,
-    0xf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
-    0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf8,
-    0xf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3, 0x32,
-    0xb, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xfd, 0x61, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2c, 0xff, 0xff, 0xc7, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x5c, 0xff, 0xff, 0xfb, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x27, 0xcf, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf3,
-    0x34, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfa,
-    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8,
-    0x1f, 0xff, 0x50, 0x0, 0x0, 0x2, 0xef, 0xf3,
-    0x4, 0xff, 0xfd, 0x75, 0x45, 0x9f, 0xff, 0xa0,
-    0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xc8, 0x20, 0x0,
-
-    /* U+0054 "T" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x14, 0x44, 0x44, 0x4b, 0xff, 0xa4,
-    0x44, 0x44, 0x40, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x60, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0xef, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
-    0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
-    0x9f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf1,
-    0x2f, 0xff, 0x40, 0x0, 0x0, 0xa, 0xff, 0xa0,
-    0x6, 0xff, 0xfa, 0x64, 0x58, 0xdf, 0xfc, 0x0,
-    0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0,
-    0x0, 0x1, 0x6b, 0xef, 0xed, 0x93, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x80, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xf2, 0xa, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xfc, 0x0, 0x4f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x60, 0x0, 0xef,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf0, 0x0,
-    0x8, 0xff, 0x60, 0x0, 0x0, 0x0, 0x4f, 0xfa,
-    0x0, 0x0, 0x2f, 0xfc, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0x40, 0x0, 0x0, 0xcf, 0xf2, 0x0, 0x0,
-    0x0, 0xff, 0xe0, 0x0, 0x0, 0x6, 0xff, 0x70,
-    0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0xf,
-    0xfd, 0x0, 0x0, 0xb, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0xaf, 0xf2, 0x0, 0x1, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x6f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xfd, 0x0, 0xc,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3,
-    0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x90, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfe, 0xd, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0xf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xfd, 0xb, 0xff, 0x10,
-    0x0, 0x0, 0x1, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x3f, 0xf9, 0x7, 0xff, 0x50, 0x0, 0x0, 0x6,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x7f, 0xf5, 0x4,
-    0xff, 0x80, 0x0, 0x0, 0xb, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0xf, 0xfd, 0xfe, 0x0, 0x0, 0x0, 0xef,
-    0xd0, 0x0, 0xcf, 0xf0, 0x0, 0x0, 0x4f, 0xf6,
-    0xff, 0x30, 0x0, 0x2, 0xff, 0x90, 0x0, 0x8f,
-    0xf4, 0x0, 0x0, 0x8f, 0xe0, 0xef, 0x80, 0x0,
-    0x6, 0xff, 0x50, 0x0, 0x4f, 0xf7, 0x0, 0x0,
-    0xdf, 0xa0, 0xaf, 0xc0, 0x0, 0x9, 0xff, 0x20,
-    0x0, 0xf, 0xfb, 0x0, 0x2, 0xff, 0x50, 0x5f,
-    0xf1, 0x0, 0xd, 0xfe, 0x0, 0x0, 0xc, 0xff,
-    0x0, 0x6, 0xff, 0x10, 0x1f, 0xf5, 0x0, 0x1f,
-    0xfa, 0x0, 0x0, 0x8, 0xff, 0x20, 0xb, 0xfc,
-    0x0, 0xc, 0xfa, 0x0, 0x4f, 0xf6, 0x0, 0x0,
-    0x4, 0xff, 0x60, 0xf, 0xf7, 0x0, 0x7, 0xfe,
-    0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0, 0xff, 0xa0,
-    0x4f, 0xf2, 0x0, 0x3, 0xff, 0x30, 0xbf, 0xe0,
-    0x0, 0x0, 0x0, 0xcf, 0xe0, 0x9f, 0xd0, 0x0,
-    0x0, 0xef, 0x70, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x8f, 0xf1, 0xdf, 0x90, 0x0, 0x0, 0xaf, 0xb3,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0xff,
-    0x40, 0x0, 0x0, 0x5f, 0xf6, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x1f, 0xfc, 0xff, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0,
-
-    /* U+0058 "X" */
-    0xa, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf8, 0x0, 0x1e, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x6f, 0xfd, 0x0, 0x0, 0x6f, 0xfd, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0x40, 0x0, 0x0, 0xbf, 0xf8,
-    0x0, 0x0, 0xa, 0xff, 0x90, 0x0, 0x0, 0x2,
-    0xff, 0xf3, 0x0, 0x4, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xc0, 0x0, 0xdf, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x70, 0x8f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x4f,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfe,
-    0x3f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x50, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xb0, 0x0, 0xcf, 0xf7, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf1, 0x0, 0x3, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0xdf, 0xf6, 0x0, 0x0, 0x8,
-    0xff, 0xb0, 0x0, 0x0, 0x8f, 0xfc, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x60, 0x0, 0x3f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x10, 0xd, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfb, 0x0,
-
-    /* U+0059 "Y" */
-    0x8f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf7, 0xe, 0xff, 0x30, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xe0, 0x6, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x50, 0x0, 0xdf, 0xf4, 0x0, 0x0,
-    0x0, 0x4f, 0xfc, 0x0, 0x0, 0x4f, 0xfc, 0x0,
-    0x0, 0x0, 0xcf, 0xf3, 0x0, 0x0, 0xb, 0xff,
-    0x50, 0x0, 0x5, 0xff, 0xa0, 0x0, 0x0, 0x2,
-    0xff, 0xd0, 0x0, 0xd, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x9f, 0xf5, 0x0, 0x6f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfd, 0x0, 0xdf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x66, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xee, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x60, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x24, 0x44, 0x44, 0x44, 0x44, 0x48, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+005B "[" */
-    0xdf, 0xff, 0xfa, 0xdf, 0xff, 0xfa, 0xdf, 0xe2,
-    0x21, 0xdf, 0xe0, 0x0, 0xdf, 0xe0, 0x0, 0xdf,
-    0xe0, 0x0, 0xdf, 0xe0, 0x0, 0xdf, 0xe0, 0x0,
-    0xdf, 0xe0, 0x0, 0xdf, 0xe0, 0x0, 0xdf, 0xe0,
-    0x0, 0xdf, 0xe0, 0x0, 0xdf, 0xe0, 0x0, 0xdf,
-    0xe0, 0x0, 0xdf, 0xe0, 0x0, 0xdf, 0xe0, 0x0,
-    0xdf, 0xe0, 0x0, 0xdf, 0xe0, 0x0, 0xdf, 0xe0,
-    0x0, 0xdf, 0xe0, 0x0, 0xdf, 0xe0, 0x0, 0xdf,
-    0xe0, 0x0, 0xdf, 0xe0, 0x0, 0xdf, 0xe0, 0x0,
-    0xdf, 0xe0, 0x0, 0xdf, 0xe0, 0x0, 0xdf, 0xe2,
-    0x21, 0xdf, 0xff, 0xfa, 0xdf, 0xff, 0xfa,
-
-    /* U+005C "\\" */
-    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfe, 0x0,
-
-    /* U+005D "]" */
-    0xdf, 0xff, 0xfb, 0xdf, 0xff, 0xfb, 0x22, 0x3f,
-    0xfb, 0x0, 0xf, 0xfb, 0x0, 0xf, 0xfb, 0x0,
-    0xf, 0xfb, 0x0, 0xf, 0xfb, 0x0, 0xf, 0xfb,
-    0x0, 0xf, 0xfb, 0x0, 0xf, 0xfb, 0x0, 0xf,
-    0xfb, 0x0, 0xf, 0xfb, 0x0, 0xf, 0xfb, 0x0,
-    0xf, 0xfb, 0x0, 0xf, 0xfb, 0x0, 0xf, 0xfb,
-    0x0, 0xf, 0xfb, 0x0, 0xf, 0xfb, 0x0, 0xf,
-    0xfb, 0x0, 0xf, 0xfb, 0x0, 0xf, 0xfb, 0x0,
-    0xf, 0xfb, 0x0, 0xf, 0xfb, 0x0, 0xf, 0xfb,
-    0x0, 0xf, 0xfb, 0x0, 0xf, 0xfb, 0x22, 0x3f,
-    0xfb, 0xdf, 0xff, 0xfb, 0xdf, 0xff, 0xfb,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0xc, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfd,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x8, 0xfd, 0xbf, 0xa0, 0x0, 0x0, 0xe,
-    0xf7, 0x5f, 0xf1, 0x0, 0x0, 0x5f, 0xf1, 0xe,
-    0xf8, 0x0, 0x0, 0xcf, 0xa0, 0x8, 0xfe, 0x0,
-    0x3, 0xff, 0x40, 0x2, 0xff, 0x50, 0x9, 0xfd,
-    0x0, 0x0, 0xcf, 0xc0, 0x1f, 0xf7, 0x0, 0x0,
-    0x5f, 0xf2,
-
-    /* U+005F "_" */
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7,
-
-    /* U+0060 "`" */
-    0x28, 0x87, 0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0,
-    0xcf, 0xf1, 0x0, 0x1, 0xef, 0xa0, 0x0, 0x3,
-    0xff, 0x40,
-
-    /* U+0061 "a" */
-    0x0, 0x2, 0x8d, 0xef, 0xea, 0x40, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x5, 0xff,
-    0xe6, 0x33, 0x6e, 0xff, 0x70, 0xd, 0xfe, 0x10,
-    0x0, 0x2, 0xff, 0xe0, 0x6, 0x74, 0x0, 0x0,
-    0x0, 0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf2, 0x0, 0x1, 0x7a, 0xdd, 0xee, 0xff,
-    0xf2, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x8, 0xff, 0xc5, 0x20, 0x0, 0x9f, 0xf2, 0x1f,
-    0xfc, 0x0, 0x0, 0x0, 0x9f, 0xf2, 0x5f, 0xf6,
-    0x0, 0x0, 0x0, 0xdf, 0xf2, 0x5f, 0xf7, 0x0,
-    0x0, 0x0, 0xff, 0xf2, 0x3f, 0xfd, 0x0, 0x0,
-    0x9, 0xff, 0xf2, 0xc, 0xff, 0xd7, 0x57, 0xdf,
-    0xff, 0xf3, 0x2, 0xef, 0xff, 0xff, 0xfd, 0x9f,
-    0xf6, 0x0, 0x8, 0xdf, 0xfc, 0x70, 0x3b, 0xb7,
-
-    /* U+0062 "b" */
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xc0, 0x5b, 0xef, 0xd9, 0x10,
-    0x0, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0xff, 0xff, 0xd6, 0x45, 0xbf, 0xff, 0x10, 0xff,
-    0xfa, 0x0, 0x0, 0x8, 0xff, 0x90, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xef, 0xf0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x8f, 0xf3, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x5f, 0xf5, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x4f, 0xf7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x4f,
-    0xf7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x5f, 0xf5,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xef, 0xf0, 0xff, 0xfa,
-    0x0, 0x0, 0x9, 0xff, 0x90, 0xff, 0xff, 0xd6,
-    0x46, 0xbf, 0xfe, 0x10, 0xff, 0xba, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0xff, 0x90, 0x5b, 0xef, 0xe9,
-    0x20, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x7c, 0xff, 0xea, 0x40, 0x0, 0x0,
-    0x2d, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x1, 0xef,
-    0xf9, 0x43, 0x5c, 0xff, 0xa0, 0xa, 0xff, 0x50,
-    0x0, 0x0, 0xbf, 0xf3, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0x2f, 0xf8, 0x6f, 0xf6, 0x0, 0x0, 0x0,
-    0x8, 0x96, 0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6,
-    0x0, 0x0, 0x0, 0x2, 0x32, 0x1f, 0xfb, 0x0,
-    0x0, 0x0, 0xf, 0xf9, 0xa, 0xff, 0x50, 0x0,
-    0x0, 0x9f, 0xf4, 0x1, 0xef, 0xf9, 0x43, 0x5c,
-    0xff, 0xa0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x7c, 0xff, 0xea, 0x30, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfc, 0x0, 0x1, 0x9d, 0xfe, 0xb5, 0xf,
-    0xfc, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xaf, 0xfc,
-    0x1, 0xff, 0xfb, 0x54, 0x6d, 0xff, 0xfc, 0xa,
-    0xff, 0x70, 0x0, 0x0, 0xaf, 0xfc, 0x1f, 0xfd,
-    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x5f, 0xf7, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0x7f, 0xf3, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x9f, 0xf2, 0x0, 0x0, 0x0,
-    0xf, 0xfd, 0x9f, 0xf2, 0x0, 0x0, 0x0, 0xf,
-    0xfd, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0xf, 0xfc,
-    0x5f, 0xf7, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f,
-    0xfd, 0x0, 0x0, 0x0, 0xf, 0xfc, 0xa, 0xff,
-    0x70, 0x0, 0x0, 0xbf, 0xfc, 0x1, 0xff, 0xfb,
-    0x64, 0x6d, 0xff, 0xfc, 0x0, 0x3e, 0xff, 0xff,
-    0xff, 0xad, 0xfc, 0x0, 0x1, 0x9e, 0xfe, 0xb5,
-    0xc, 0xfc,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x4b, 0xef, 0xda, 0x40, 0x0, 0x0,
-    0x1b, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xcf,
-    0xfa, 0x43, 0x5c, 0xff, 0x80, 0x8, 0xff, 0x70,
-    0x0, 0x0, 0xbf, 0xf2, 0xf, 0xfc, 0x0, 0x0,
-    0x0, 0x3f, 0xf7, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0xf, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xaf, 0xf4, 0x33, 0x33, 0x33, 0x33, 0x32, 0x8f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd, 0x0,
-    0x0, 0x0, 0x1, 0x20, 0xa, 0xff, 0x90, 0x0,
-    0x0, 0x1d, 0xe3, 0x0, 0xdf, 0xfc, 0x63, 0x48,
-    0xef, 0xf2, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xfe,
-    0x30, 0x0, 0x0, 0x5b, 0xdf, 0xec, 0x70, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x2, 0x43, 0x0, 0x0, 0x0,
-    0x7e, 0xff, 0xf6, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x50, 0x0, 0x2f, 0xfe, 0x50, 0x0, 0x0, 0x7,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x9f, 0xf2, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x20, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x20, 0x0, 0x0, 0x0, 0x9f, 0xf2,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x9f, 0xf2, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x9f, 0xf2, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x20, 0x0, 0x0, 0x0, 0x9f,
-    0xf2, 0x0, 0x0, 0x0, 0x9, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x9f, 0xf2, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x9f, 0xf2, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x20, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x1, 0x9d, 0xfe, 0xb5, 0xb, 0xfd, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xac, 0xfd, 0x2, 0xff,
-    0xfb, 0x54, 0x6d, 0xff, 0xfd, 0xa, 0xff, 0x80,
-    0x0, 0x0, 0xaf, 0xfd, 0x1f, 0xfd, 0x0, 0x0,
-    0x0, 0x1f, 0xfd, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0xf, 0xfd, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0xf,
-    0xfd, 0x8f, 0xf2, 0x0, 0x0, 0x0, 0xf, 0xfe,
-    0x8f, 0xf2, 0x0, 0x0, 0x0, 0xf, 0xfe, 0x7f,
-    0xf4, 0x0, 0x0, 0x0, 0xf, 0xfd, 0x5f, 0xf7,
-    0x0, 0x0, 0x0, 0xf, 0xfd, 0xf, 0xfd, 0x0,
-    0x0, 0x0, 0xf, 0xfd, 0xa, 0xff, 0x80, 0x0,
-    0x0, 0xaf, 0xfd, 0x1, 0xff, 0xfb, 0x64, 0x6d,
-    0xff, 0xfd, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xaf,
-    0xfd, 0x0, 0x1, 0x9e, 0xfe, 0xb5, 0xe, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfb, 0x0,
-    0x20, 0x0, 0x0, 0x0, 0x4f, 0xf8, 0x2, 0xf8,
-    0x0, 0x0, 0x0, 0xdf, 0xf2, 0x8, 0xff, 0xc6,
-    0x33, 0x7e, 0xff, 0x80, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x2, 0x8c, 0xff, 0xd9,
-    0x30, 0x0,
-
-    /* U+0068 "h" */
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x3a, 0xef, 0xea, 0x20, 0xf, 0xfc, 0x7f,
-    0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xd7, 0x45,
-    0xbf, 0xfe, 0xf, 0xff, 0xc0, 0x0, 0x0, 0xbf,
-    0xf4, 0xff, 0xf1, 0x0, 0x0, 0x5, 0xff, 0x6f,
-    0xff, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0xff, 0xf0,
-    0x0, 0x0, 0x3, 0xff, 0x8f, 0xfe, 0x0, 0x0,
-    0x0, 0x3f, 0xf8, 0xff, 0xc0, 0x0, 0x0, 0x3,
-    0xff, 0x8f, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-    0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0x8f, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xf8, 0xff, 0xc0, 0x0,
-    0x0, 0x3, 0xff, 0x8f, 0xfc, 0x0, 0x0, 0x0,
-    0x3f, 0xf8, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff,
-    0x8f, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-
-    /* U+0069 "i" */
-    0x6f, 0xc1, 0xdf, 0xf5, 0x7f, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf1, 0x9f, 0xf1, 0x9f, 0xf1,
-    0x9f, 0xf1, 0x9f, 0xf1, 0x9f, 0xf1, 0x9f, 0xf1,
-    0x9f, 0xf1, 0x9f, 0xf1, 0x9f, 0xf1, 0x9f, 0xf1,
-    0x9f, 0xf1, 0x9f, 0xf1, 0x9f, 0xf1, 0x9f, 0xf1,
-    0x9f, 0xf1,
-
-    /* U+006A "j" */
-    0x0, 0xa, 0xfa, 0x0, 0x0, 0xff, 0xf1, 0x0,
-    0xa, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xe0, 0x0, 0xd, 0xfe,
-    0x0, 0x0, 0xdf, 0xe0, 0x0, 0xd, 0xfe, 0x0,
-    0x0, 0xdf, 0xe0, 0x0, 0xd, 0xfe, 0x0, 0x0,
-    0xdf, 0xe0, 0x0, 0xd, 0xfe, 0x0, 0x0, 0xdf,
-    0xe0, 0x0, 0xd, 0xfe, 0x0, 0x0, 0xdf, 0xe0,
-    0x0, 0xd, 0xfe, 0x0, 0x0, 0xdf, 0xe0, 0x0,
-    0xd, 0xfe, 0x0, 0x0, 0xdf, 0xe0, 0x0, 0xd,
-    0xfe, 0x0, 0x0, 0xdf, 0xe0, 0x0, 0xd, 0xfd,
-    0x0, 0x0, 0xff, 0xc0, 0x44, 0xbf, 0xf9, 0xf,
-    0xff, 0xff, 0x20, 0xdf, 0xfb, 0x20, 0x0,
-
-    /* U+006B "k" */
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xd0, 0x0, 0x0, 0x5f, 0xfe,
-    0x10, 0xff, 0xd0, 0x0, 0x4, 0xff, 0xe2, 0x0,
-    0xff, 0xd0, 0x0, 0x3f, 0xff, 0x30, 0x0, 0xff,
-    0xd0, 0x2, 0xef, 0xf4, 0x0, 0x0, 0xff, 0xd0,
-    0x2e, 0xff, 0x50, 0x0, 0x0, 0xff, 0xd1, 0xdf,
-    0xf6, 0x0, 0x0, 0x0, 0xff, 0xdb, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0xff, 0xf9, 0xc, 0xff, 0x60, 0x0, 0x0,
-    0xff, 0xf0, 0x2, 0xff, 0xf2, 0x0, 0x0, 0xff,
-    0xd0, 0x0, 0x5f, 0xfd, 0x0, 0x0, 0xff, 0xd0,
-    0x0, 0x9, 0xff, 0x90, 0x0, 0xff, 0xd0, 0x0,
-    0x0, 0xdf, 0xf5, 0x0, 0xff, 0xd0, 0x0, 0x0,
-    0x2f, 0xff, 0x20, 0xff, 0xd0, 0x0, 0x0, 0x6,
-    0xff, 0xc0,
-
-    /* U+006C "l" */
-    0xbf, 0xf0, 0xbf, 0xf0, 0xbf, 0xf0, 0xbf, 0xf0,
-    0xbf, 0xf0, 0xbf, 0xf0, 0xbf, 0xf0, 0xbf, 0xf0,
-    0xbf, 0xf0, 0xbf, 0xf0, 0xbf, 0xf0, 0xbf, 0xf0,
-    0xbf, 0xf0, 0xbf, 0xf0, 0xbf, 0xf0, 0xbf, 0xf0,
-    0xbf, 0xf0, 0xbf, 0xf0, 0xbf, 0xf0, 0xbf, 0xf0,
-    0xbf, 0xf0, 0xbf, 0xf0,
-
-    /* U+006D "m" */
-    0xff, 0xa0, 0x5b, 0xef, 0xe9, 0x20, 0x1, 0x8d,
-    0xff, 0xd8, 0x0, 0xf, 0xfc, 0xbf, 0xff, 0xff,
-    0xff, 0x43, 0xef, 0xff, 0xff, 0xfd, 0x10, 0xff,
-    0xff, 0xa5, 0x46, 0xcf, 0xff, 0xff, 0xa5, 0x46,
-    0xdf, 0xfa, 0xf, 0xff, 0x50, 0x0, 0x0, 0xcf,
-    0xff, 0x50, 0x0, 0x1, 0xef, 0xf0, 0xff, 0xf0,
-    0x0, 0x0, 0x5, 0xff, 0xf0, 0x0, 0x0, 0x9,
-    0xff, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x0, 0x0, 0x0, 0x8f, 0xf3, 0xff, 0xf0, 0x0,
-    0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x7, 0xff,
-    0x4f, 0xfd, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0,
-    0x0, 0x0, 0x7f, 0xf4, 0xff, 0xc0, 0x0, 0x0,
-    0x3, 0xff, 0x80, 0x0, 0x0, 0x7, 0xff, 0x4f,
-    0xfc, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
-    0x0, 0x7f, 0xf4, 0xff, 0xc0, 0x0, 0x0, 0x3,
-    0xff, 0x80, 0x0, 0x0, 0x7, 0xff, 0x4f, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0,
-    0x7f, 0xf4, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff,
-    0x80, 0x0, 0x0, 0x7, 0xff, 0x4f, 0xfc, 0x0,
-    0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x7f,
-    0xf4, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0x80,
-    0x0, 0x0, 0x7, 0xff, 0x4f, 0xfc, 0x0, 0x0,
-    0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0xf4,
-
-    /* U+006E "n" */
-    0xff, 0xa0, 0x3a, 0xdf, 0xea, 0x20, 0xf, 0xfb,
-    0x8f, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xd6,
-    0x45, 0xbf, 0xfe, 0xf, 0xff, 0xa0, 0x0, 0x0,
-    0xbf, 0xf4, 0xff, 0xf0, 0x0, 0x0, 0x5, 0xff,
-    0x6f, 0xff, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0xff,
-    0xf0, 0x0, 0x0, 0x3, 0xff, 0x8f, 0xfd, 0x0,
-    0x0, 0x0, 0x3f, 0xf8, 0xff, 0xc0, 0x0, 0x0,
-    0x3, 0xff, 0x8f, 0xfc, 0x0, 0x0, 0x0, 0x3f,
-    0xf8, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0x8f,
-    0xfc, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0xff, 0xc0,
-    0x0, 0x0, 0x3, 0xff, 0x8f, 0xfc, 0x0, 0x0,
-    0x0, 0x3f, 0xf8, 0xff, 0xc0, 0x0, 0x0, 0x3,
-    0xff, 0x8f, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x5b, 0xef, 0xec, 0x60, 0x0, 0x0,
-    0x1, 0xbf, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
-    0xdf, 0xfb, 0x53, 0x4a, 0xff, 0xe1, 0x0, 0x8f,
-    0xf8, 0x0, 0x0, 0x6, 0xff, 0xa0, 0xf, 0xfd,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x25, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x5f, 0xf7, 0x8f, 0xf3, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xa9, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xf, 0xfb, 0x9f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xb8, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x70, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xbf, 0xf2, 0x8, 0xff, 0x80, 0x0, 0x0, 0x6f,
-    0xfa, 0x0, 0xd, 0xff, 0xb5, 0x35, 0xaf, 0xfe,
-    0x10, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xfd, 0x20,
-    0x0, 0x0, 0x5, 0xbe, 0xff, 0xc6, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0xff, 0x90, 0x5c, 0xef, 0xd9, 0x10, 0x0, 0xff,
-    0xbb, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xff, 0xff,
-    0xb5, 0x46, 0xcf, 0xff, 0x10, 0xff, 0xf8, 0x0,
-    0x0, 0xa, 0xff, 0x90, 0xff, 0xf0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x9f, 0xf3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x6f,
-    0xf5, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x4f, 0xf6,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x4f, 0xf6, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x9f, 0xf3, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xef, 0xe0, 0xff, 0xf6, 0x0, 0x0,
-    0x9, 0xff, 0x80, 0xff, 0xff, 0xa4, 0x35, 0xbf,
-    0xfe, 0x10, 0xff, 0xec, 0xff, 0xff, 0xff, 0xe3,
-    0x0, 0xff, 0xc0, 0x6c, 0xef, 0xe9, 0x10, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x1, 0x9d, 0xfe, 0xb5, 0xc, 0xfc, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xbe, 0xfc, 0x2, 0xff,
-    0xfa, 0x43, 0x5c, 0xff, 0xfc, 0xb, 0xff, 0x70,
-    0x0, 0x0, 0x9f, 0xfc, 0x1f, 0xfd, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0xf, 0xfc, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0xf,
-    0xfd, 0x9f, 0xf2, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x9f, 0xf2, 0x0, 0x0, 0x0, 0xf, 0xff, 0x7f,
-    0xf3, 0x0, 0x0, 0x0, 0xf, 0xfd, 0x5f, 0xf7,
-    0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfd, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0xa, 0xff, 0x70, 0x0,
-    0x0, 0x9f, 0xfc, 0x2, 0xff, 0xfa, 0x43, 0x5b,
-    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xbf,
-    0xfc, 0x0, 0x2, 0x9e, 0xfe, 0xc6, 0xf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfc,
-
-    /* U+0072 "r" */
-    0xff, 0xb0, 0x7d, 0xfa, 0xff, 0xcb, 0xff, 0xfb,
-    0xff, 0xff, 0xfa, 0x97, 0xff, 0xfb, 0x10, 0x0,
-    0xff, 0xf1, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x3, 0xad, 0xfe, 0xd8, 0x10, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x7, 0xff,
-    0xd5, 0x34, 0x9f, 0xff, 0x20, 0xe, 0xfe, 0x0,
-    0x0, 0x6, 0xff, 0x90, 0xf, 0xfb, 0x0, 0x0,
-    0x0, 0xcd, 0xa0, 0xe, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfa, 0x51, 0x0, 0x0,
-    0x0, 0x0, 0x5e, 0xff, 0xff, 0xd8, 0x20, 0x0,
-    0x0, 0x0, 0x5a, 0xef, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x6e, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xd0, 0x8f, 0xf3, 0x0,
-    0x0, 0x0, 0xcf, 0xf0, 0x4f, 0xfb, 0x0, 0x0,
-    0x1, 0xef, 0xd0, 0xb, 0xff, 0xc6, 0x33, 0x6d,
-    0xff, 0x60, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xd9, 0x30, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xc0,
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xbe, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0xf, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xfc, 0x0,
-    0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xfc,
-    0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0xf,
-    0xfc, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0xf, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0xe, 0xfd, 0x0, 0x0, 0x0, 0xbf, 0xf8,
-    0x54, 0x0, 0x4, 0xff, 0xff, 0xc0, 0x0, 0x5,
-    0xdf, 0xf9,
-
-    /* U+0075 "u" */
-    0xff, 0xb0, 0x0, 0x0, 0x4, 0xff, 0x7f, 0xfb,
-    0x0, 0x0, 0x0, 0x4f, 0xf7, 0xff, 0xb0, 0x0,
-    0x0, 0x4, 0xff, 0x7f, 0xfb, 0x0, 0x0, 0x0,
-    0x4f, 0xf7, 0xff, 0xb0, 0x0, 0x0, 0x4, 0xff,
-    0x7f, 0xfb, 0x0, 0x0, 0x0, 0x4f, 0xf7, 0xff,
-    0xb0, 0x0, 0x0, 0x4, 0xff, 0x7f, 0xfb, 0x0,
-    0x0, 0x0, 0x4f, 0xf7, 0xff, 0xb0, 0x0, 0x0,
-    0x4, 0xff, 0x7f, 0xfb, 0x0, 0x0, 0x0, 0x4f,
-    0xf7, 0xff, 0xc0, 0x0, 0x0, 0x4, 0xff, 0x7e,
-    0xfe, 0x0, 0x0, 0x0, 0x8f, 0xf7, 0xbf, 0xf4,
-    0x0, 0x0, 0x1f, 0xff, 0x75, 0xff, 0xf7, 0x45,
-    0x8e, 0xff, 0xf7, 0xa, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0x70, 0x6, 0xcf, 0xfd, 0xa3, 0x2f, 0xf7,
-
-    /* U+0076 "v" */
-    0x5f, 0xf7, 0x0, 0x0, 0x0, 0xf, 0xfc, 0xf,
-    0xfc, 0x0, 0x0, 0x0, 0x4f, 0xf7, 0x9, 0xff,
-    0x10, 0x0, 0x0, 0x9f, 0xf1, 0x4, 0xff, 0x60,
-    0x0, 0x0, 0xef, 0xb0, 0x0, 0xef, 0xc0, 0x0,
-    0x3, 0xff, 0x60, 0x0, 0x8f, 0xf1, 0x0, 0x8,
-    0xff, 0x10, 0x0, 0x3f, 0xf6, 0x0, 0xd, 0xfa,
-    0x0, 0x0, 0xd, 0xfb, 0x0, 0x3f, 0xf5, 0x0,
-    0x0, 0x7, 0xff, 0x10, 0x8f, 0xf0, 0x0, 0x0,
-    0x1, 0xff, 0x60, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0xcf, 0xb2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x6f,
-    0xf8, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x3f, 0xf7, 0x0, 0x0, 0x0, 0xff, 0x70, 0x0,
-    0x0, 0xf, 0xfb, 0xe, 0xfb, 0x0, 0x0, 0x5,
-    0xff, 0xc0, 0x0, 0x0, 0x4f, 0xf6, 0xa, 0xff,
-    0x0, 0x0, 0xa, 0xff, 0xf1, 0x0, 0x0, 0x8f,
-    0xf1, 0x5, 0xff, 0x40, 0x0, 0xe, 0xff, 0xf6,
-    0x0, 0x0, 0xcf, 0xd0, 0x1, 0xff, 0x80, 0x0,
-    0x4f, 0xfa, 0xfb, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0xcf, 0xc0, 0x0, 0x9f, 0xb5, 0xff, 0x0, 0x4,
-    0xff, 0x40, 0x0, 0x8f, 0xf1, 0x0, 0xef, 0x60,
-    0xff, 0x50, 0x8, 0xff, 0x0, 0x0, 0x3f, 0xf5,
-    0x3, 0xff, 0x10, 0xaf, 0xa0, 0xc, 0xfa, 0x0,
-    0x0, 0xe, 0xf9, 0x8, 0xfc, 0x0, 0x5f, 0xf0,
-    0xf, 0xf6, 0x0, 0x0, 0xa, 0xfd, 0xc, 0xf7,
-    0x0, 0xf, 0xf4, 0x4f, 0xf1, 0x0, 0x0, 0x5,
-    0xff, 0x3f, 0xf2, 0x0, 0xb, 0xf9, 0x8f, 0xd0,
-    0x0, 0x0, 0x1, 0xff, 0xcf, 0xd0, 0x0, 0x6,
-    0xfe, 0xcf, 0x80, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x80, 0x0, 0x1, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x30, 0x0, 0x0, 0xcf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0,
-    0x0, 0x7f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf9, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0xd, 0xff, 0x30, 0x0, 0x0, 0x6f, 0xfb, 0x0,
-    0x4f, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0x20, 0x0,
-    0x9f, 0xf6, 0x0, 0xa, 0xff, 0x60, 0x0, 0x0,
-    0xef, 0xf1, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x4,
-    0xff, 0xa0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf6, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x6f, 0xf8, 0xa, 0xff,
-    0x40, 0x0, 0x0, 0x2f, 0xfd, 0x0, 0x1f, 0xfd,
-    0x0, 0x0, 0xb, 0xff, 0x40, 0x0, 0x7f, 0xf9,
-    0x0, 0x6, 0xff, 0xb0, 0x0, 0x0, 0xdf, 0xf3,
-    0x1, 0xff, 0xf2, 0x0, 0x0, 0x3, 0xff, 0xd0,
-
-    /* U+0079 "y" */
-    0x7f, 0xf7, 0x0, 0x0, 0x0, 0x4f, 0xfa, 0x2f,
-    0xfd, 0x0, 0x0, 0x0, 0x9f, 0xf4, 0xc, 0xff,
-    0x20, 0x0, 0x0, 0xef, 0xe0, 0x6, 0xff, 0x70,
-    0x0, 0x3, 0xff, 0x90, 0x1, 0xff, 0xd0, 0x0,
-    0x8, 0xff, 0x30, 0x0, 0xaf, 0xf2, 0x0, 0xd,
-    0xfe, 0x0, 0x0, 0x4f, 0xf7, 0x0, 0x2f, 0xf8,
-    0x0, 0x0, 0xe, 0xfd, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x9, 0xff, 0x20, 0xcf, 0xd0, 0x0, 0x0,
-    0x3, 0xff, 0x71, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0xdf, 0xd6, 0xff, 0x20, 0x0, 0x0, 0x0, 0x7f,
-    0xfd, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf4, 0x0, 0x0, 0x0, 0x4, 0x69, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0xa, 0xfe, 0xa1, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+007A "z" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x13, 0x33, 0x33,
-    0x33, 0x6f, 0xff, 0x10, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x9, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x50, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf3, 0x22,
-    0x22, 0x22, 0x22, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x0, 0x63, 0x0, 0x0, 0x0,
-    0x5e, 0xfa, 0x0, 0x0, 0x6, 0xff, 0xa1, 0x0,
-    0x0, 0x2f, 0xfb, 0x0, 0x0, 0x0, 0x8f, 0xf3,
-    0x0, 0x0, 0x0, 0xcf, 0xf0, 0x0, 0x0, 0x0,
-    0xef, 0xd0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xff, 0xb0, 0x0, 0x0,
-    0x2, 0xff, 0x90, 0x0, 0x0, 0xa, 0xff, 0x30,
-    0x0, 0x9, 0xdf, 0xf9, 0x0, 0x0, 0x2f, 0xff,
-    0xb0, 0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x2d, 0xff, 0x20, 0x0, 0x0, 0x5, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xef, 0xc0, 0x0, 0x0, 0x0, 0xdf, 0xe0, 0x0,
-    0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0, 0x4f,
-    0xf8, 0x0, 0x0, 0x0, 0xb, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0xbf, 0xf9, 0x0, 0x0, 0x0, 0x5,
-    0xb6, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007C "|" */
-    0x6f, 0xc6, 0xfc, 0x6f, 0xc6, 0xfc, 0x6f, 0xc6,
-    0xfc, 0x6f, 0xc6, 0xfc, 0x6f, 0xc6, 0xfc, 0x6f,
-    0xc6, 0xfc, 0x6f, 0xc6, 0xfc, 0x6f, 0xc6, 0xfc,
-    0x6f, 0xc6, 0xfc, 0x6f, 0xc6, 0xfc, 0x6f, 0xc6,
-    0xfc, 0x6f, 0xc6, 0xfc, 0x6f, 0xc0,
-
-    /* U+007D "}" */
-    0x26, 0x10, 0x0, 0x0, 0x0, 0x8f, 0xf7, 0x0,
-    0x0, 0x0, 0x19, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x9f, 0xf3, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0,
-    0x0, 0x0, 0xd, 0xfe, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0x0, 0x0, 0x0, 0xa, 0xff, 0x10, 0x0,
-    0x0, 0xa, 0xff, 0x10, 0x0, 0x0, 0xa, 0xff,
-    0x10, 0x0, 0x0, 0x9, 0xff, 0x20, 0x0, 0x0,
-    0x7, 0xff, 0x40, 0x0, 0x0, 0x2, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x6f, 0xfd, 0x91, 0x0, 0x0,
-    0x6, 0xff, 0xf5, 0x0, 0x0, 0x4f, 0xff, 0xe2,
-    0x0, 0x1, 0xef, 0xe2, 0x0, 0x0, 0x6, 0xff,
-    0x60, 0x0, 0x0, 0x9, 0xff, 0x20, 0x0, 0x0,
-    0xa, 0xff, 0x10, 0x0, 0x0, 0xa, 0xff, 0x10,
-    0x0, 0x0, 0xa, 0xff, 0x10, 0x0, 0x0, 0xb,
-    0xff, 0x0, 0x0, 0x0, 0xc, 0xff, 0x0, 0x0,
-    0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0x0, 0x0, 0x5, 0xff, 0xb0, 0x0, 0x0, 0x8f,
-    0xfa, 0x0, 0x0, 0x0, 0x4a, 0x40, 0x0, 0x0,
-    0x0,
-
-    /* U+007E "~" */
-    0x0, 0x3b, 0xef, 0xb4, 0x0, 0x0, 0x0, 0x4a,
-    0x70, 0x5f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x9,
-    0xfb, 0x1f, 0xfd, 0x66, 0xdf, 0xfb, 0x0, 0x1,
-    0xff, 0x67, 0xff, 0x10, 0x0, 0xaf, 0xfd, 0x66,
-    0xdf, 0xe1, 0xaf, 0xb0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xf4, 0x6, 0x85, 0x0, 0x0, 0x0, 0x4b,
-    0xfe, 0xb3, 0x0,
-
     /* U+05D0 "א" */
     0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
     0xa, 0xff, 0x60, 0x0, 0x0, 0x1, 0xff, 0xe0,
@@ -1840,20 +211,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
     0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
 
-    /* U+05D2 "ג" */
-    0x0, 0xaf, 0xff, 0xff, 0xf0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x12, 0x22, 0xcf, 0xf0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x40, 0x0, 0x0, 0xc, 0xbf, 0xf7, 0x0,
-    0x0, 0x1b, 0xf4, 0xdf, 0xa0, 0x68, 0xbf, 0xfb,
-    0xa, 0xfe, 0xb, 0xff, 0xfb, 0x0, 0x7f, 0xf1,
-    0xbf, 0xc6, 0x0, 0x3, 0xff, 0x50,
-
     /* U+05D3 "ד" */
     0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x2,
@@ -1952,27 +309,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xb0, 0x0, 0xf, 0xfb, 0x0, 0x0, 0xff, 0xb0,
     0x0, 0xa, 0xa7,
 
-    /* U+05DA "ך" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x2, 0x22, 0x22,
-    0x22, 0x28, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x30,
-
     /* U+05DB "כ" */
     0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0xff,
     0xff, 0xff, 0xff, 0xff, 0xf7, 0x2, 0x22, 0x22,
@@ -1989,47 +325,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xe2, 0xa, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0,
     0x48, 0xce, 0xff, 0xdb, 0x60, 0x0, 0x0,
 
-    /* U+05DC "ל" */
-    0x68, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3, 0x0, 0x0,
-    0x0,
-
-    /* U+05DD "ם" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x65,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x5f,
-    0xf7, 0x22, 0x22, 0x22, 0x26, 0xff, 0x65, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x4f, 0xf6, 0x5f, 0xf5,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x65, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x4f, 0xf6, 0x5f, 0xf5, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x65, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x4f, 0xf6, 0x5f, 0xf5, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x65, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x4f, 0xf6, 0x5f, 0xf5, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x65, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x4f, 0xf6, 0x5f, 0xf5, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x65, 0xff, 0x50, 0x0, 0x0, 0x0, 0x4f,
-    0xf6, 0x5f, 0xf7, 0x33, 0x33, 0x33, 0x37, 0xff,
-    0x65, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-
     /* U+05DE "מ" */
     0x0, 0x15, 0x8b, 0xde, 0xff, 0xd9, 0x20, 0x0,
     0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
@@ -2071,27 +366,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x55, 0xaf, 0xfd, 0x1, 0xff, 0xff, 0xff, 0x40,
     0x1c, 0xef, 0xeb, 0x30, 0x0,
 
-    /* U+05E1 "ס" */
-    0x1, 0x58, 0xad, 0xef, 0xfe, 0xc7, 0x10, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x2f, 0xca, 0xff, 0xfa, 0x89, 0xdf, 0xff,
-    0x60, 0x0, 0x1, 0xef, 0xd1, 0x0, 0x0, 0x6f,
-    0xff, 0x20, 0x0, 0x9f, 0xf2, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x1f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xd0, 0x5, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x0, 0x7f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf1, 0x8, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x10, 0x8f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf1, 0x6, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x0, 0x4f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xd0, 0x0, 0xef,
-    0xe0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x8,
-    0xff, 0xb0, 0x0, 0x0, 0x3f, 0xff, 0x20, 0x0,
-    0xc, 0xff, 0xe8, 0x56, 0xaf, 0xff, 0x60, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x4, 0xad, 0xfe, 0xc8, 0x10, 0x0,
-    0x0,
-
     /* U+05E2 "ע" */
     0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xff, 0xb0,
     0xd, 0xfe, 0x0, 0x0, 0x0, 0xf, 0xfb, 0x0,
@@ -2110,29 +384,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0,
     0x0, 0x59, 0xce, 0xff, 0xdb, 0x60, 0x0, 0x0,
 
-    /* U+05E3 "ף" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x23, 0xff,
-    0x72, 0x22, 0x22, 0x9f, 0xf2, 0x7, 0xff, 0x0,
-    0x0, 0x0, 0x8f, 0xf2, 0xd, 0xfb, 0x0, 0x0,
-    0x0, 0x8f, 0xf2, 0xf, 0xf9, 0x0, 0x0, 0x0,
-    0x8f, 0xf2, 0x2f, 0xf8, 0x0, 0x0, 0x0, 0x8f,
-    0xf2, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0xf2,
-    0x2f, 0xfc, 0x64, 0x0, 0x0, 0x8f, 0xf2, 0x2f,
-    0xff, 0xfc, 0x0, 0x0, 0x8f, 0xf2, 0x4, 0xad,
-    0xfc, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf2,
-
     /* U+05E4 "פ" */
     0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2e,
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x24,
@@ -2151,50 +402,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
     0x2, 0x6a, 0xde, 0xfe, 0xc8, 0x20, 0x0, 0x0,
 
-    /* U+05E5 "ץ" */
-    0xc, 0xff, 0x40, 0x0, 0x0, 0x0, 0xef, 0xf2,
-    0x2, 0xff, 0xd0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x6f, 0xf9, 0x0, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0xb, 0xff, 0x30, 0x0, 0x9f, 0xf6, 0x0,
-    0x0, 0x1, 0xef, 0xd0, 0x2, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x5f, 0xf9, 0xb, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x8f, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0,
-
-    /* U+05E6 "צ" */
-    0xc, 0xff, 0x40, 0x0, 0x0, 0x0, 0xef, 0xf2,
-    0x2, 0xff, 0xe0, 0x0, 0x0, 0x8, 0xff, 0x80,
-    0x0, 0x6f, 0xf9, 0x0, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0xb, 0xff, 0x40, 0x0, 0x9f, 0xf6, 0x0,
-    0x0, 0x1, 0xef, 0xe0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x4f, 0xf9, 0xb, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x9f, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3, 0x0,
-    0x0, 0x33, 0x33, 0x33, 0x33, 0x4f, 0xfd, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-
     /* U+05E7 "ק" */
     0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0x22,
@@ -2234,30 +441,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
     0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x70,
 
-    /* U+05E9 "ש" */
-    0x5f, 0xf4, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0,
-    0x7f, 0xf2, 0x5f, 0xf4, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x0, 0x7f, 0xf2, 0x5f, 0xf4, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf2, 0x5f, 0xf4,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf2,
-    0x5f, 0xf4, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0,
-    0x7f, 0xf2, 0x5f, 0xf4, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x0, 0x7f, 0xf2, 0x5f, 0xf4, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf2, 0x5f, 0xf4,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf2,
-    0x5f, 0xf4, 0x0, 0x0, 0x7f, 0xf2, 0x0, 0x0,
-    0x7f, 0xf2, 0x5f, 0xf4, 0x0, 0x0, 0x8f, 0xf1,
-    0x0, 0x0, 0x7f, 0xf2, 0x5f, 0xf4, 0x0, 0x0,
-    0xaf, 0xd0, 0x0, 0x0, 0x9f, 0xf1, 0x5f, 0xf4,
-    0x0, 0x0, 0xef, 0x60, 0x0, 0x0, 0xef, 0xf0,
-    0x5f, 0xf4, 0x0, 0x3, 0x87, 0x0, 0x0, 0x8,
-    0xff, 0x90, 0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x9f, 0xfe, 0x10, 0x5f, 0xff, 0xea, 0x64,
-    0x33, 0x46, 0xaf, 0xff, 0xe3, 0x0, 0x5, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0,
-    0x0, 0x1, 0x59, 0xce, 0xff, 0xfd, 0xa6, 0x10,
-    0x0, 0x0,
-
     /* U+05EA "ת" */
     0x5, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa3, 0x0,
     0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
@@ -2278,7 +461,7 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x3f, 0xf8,
     0xef, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x3, 0xff,
     0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0
+    0x0,
 };
 
 
@@ -2289,145 +472,51 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 119, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 124, .box_w = 4, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 42, .adv_w = 154, .box_w = 7, .box_h = 8, .ofs_x = 2, .ofs_y = 14},
-    {.bitmap_index = 70, .adv_w = 296, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 259, .adv_w = 270, .box_w = 15, .box_h = 28, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 469, .adv_w = 352, .box_w = 20, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 679, .adv_w = 299, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 868, .adv_w = 84, .box_w = 3, .box_h = 7, .ofs_x = 1, .ofs_y = 15},
-    {.bitmap_index = 879, .adv_w = 165, .box_w = 9, .box_h = 31, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 1019, .adv_w = 167, .box_w = 9, .box_h = 31, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 1159, .adv_w = 207, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 8},
-    {.bitmap_index = 1244, .adv_w = 258, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 1372, .adv_w = 94, .box_w = 5, .box_h = 8, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 1392, .adv_w = 132, .box_w = 8, .box_h = 3, .ofs_x = 0, .ofs_y = 8},
-    {.bitmap_index = 1404, .adv_w = 127, .box_w = 4, .box_h = 4, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1412, .adv_w = 198, .box_w = 12, .box_h = 23, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1550, .adv_w = 270, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1708, .adv_w = 270, .box_w = 9, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1803, .adv_w = 270, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1961, .adv_w = 270, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2108, .adv_w = 270, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2287, .adv_w = 270, .box_w = 14, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2434, .adv_w = 270, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2592, .adv_w = 270, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2750, .adv_w = 270, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2908, .adv_w = 270, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3055, .adv_w = 117, .box_w = 5, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3095, .adv_w = 102, .box_w = 5, .box_h = 21, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 3148, .adv_w = 258, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 3239, .adv_w = 258, .box_w = 14, .box_h = 9, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 3302, .adv_w = 258, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 3400, .adv_w = 227, .box_w = 12, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3526, .adv_w = 431, .box_w = 25, .box_h = 27, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 3864, .adv_w = 314, .box_w = 20, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4074, .adv_w = 299, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4232, .adv_w = 312, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4421, .adv_w = 315, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4589, .adv_w = 273, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4747, .adv_w = 265, .box_w = 14, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4894, .adv_w = 327, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5083, .adv_w = 342, .box_w = 17, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5262, .adv_w = 131, .box_w = 4, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5304, .adv_w = 265, .box_w = 15, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5462, .adv_w = 301, .box_w = 17, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5641, .adv_w = 259, .box_w = 14, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5788, .adv_w = 419, .box_w = 22, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6019, .adv_w = 342, .box_w = 17, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6198, .adv_w = 330, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6387, .adv_w = 303, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6555, .adv_w = 330, .box_w = 18, .box_h = 25, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 6780, .adv_w = 296, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6948, .adv_w = 285, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7116, .adv_w = 286, .box_w = 18, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7305, .adv_w = 311, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7473, .adv_w = 306, .box_w = 19, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7673, .adv_w = 426, .box_w = 26, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7946, .adv_w = 301, .box_w = 19, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8146, .adv_w = 288, .box_w = 18, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8335, .adv_w = 288, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8503, .adv_w = 128, .box_w = 6, .box_h = 29, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 8590, .adv_w = 197, .box_w = 13, .box_h = 23, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8740, .adv_w = 128, .box_w = 6, .box_h = 29, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 8827, .adv_w = 258, .box_w = 12, .box_h = 11, .ofs_x = 2, .ofs_y = 11},
-    {.bitmap_index = 8893, .adv_w = 217, .box_w = 14, .box_h = 3, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8914, .adv_w = 145, .box_w = 7, .box_h = 5, .ofs_x = 1, .ofs_y = 18},
-    {.bitmap_index = 8932, .adv_w = 261, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9044, .adv_w = 270, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9198, .adv_w = 251, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9310, .adv_w = 271, .box_w = 14, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9464, .adv_w = 255, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9576, .adv_w = 167, .box_w = 11, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9703, .adv_w = 270, .box_w = 14, .box_h = 22, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 9857, .adv_w = 264, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10000, .adv_w = 120, .box_w = 4, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10042, .adv_w = 118, .box_w = 7, .box_h = 27, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 10137, .adv_w = 244, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10291, .adv_w = 117, .box_w = 4, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10335, .adv_w = 421, .box_w = 23, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10519, .adv_w = 265, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10623, .adv_w = 274, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10743, .adv_w = 270, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 10897, .adv_w = 273, .box_w = 14, .box_h = 22, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 11051, .adv_w = 163, .box_w = 8, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11115, .adv_w = 248, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11227, .adv_w = 157, .box_w = 9, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11317, .adv_w = 265, .box_w = 13, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11421, .adv_w = 233, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11533, .adv_w = 361, .box_w = 22, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11709, .adv_w = 238, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11829, .adv_w = 227, .box_w = 14, .box_h = 22, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 11983, .adv_w = 238, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12087, .adv_w = 163, .box_w = 10, .box_h = 30, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 12237, .adv_w = 117, .box_w = 3, .box_h = 25, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 12275, .adv_w = 163, .box_w = 10, .box_h = 29, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 12420, .adv_w = 305, .box_w = 17, .box_h = 6, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 12471, .adv_w = 308, .box_w = 16, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12607, .adv_w = 253, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12743, .adv_w = 186, .box_w = 11, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12837, .adv_w = 250, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12965, .adv_w = 282, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13084, .adv_w = 142, .box_w = 6, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13135, .adv_w = 170, .box_w = 9, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13212, .adv_w = 291, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13331, .adv_w = 296, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13459, .adv_w = 145, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 13494, .adv_w = 238, .box_w = 13, .box_h = 23, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 13644, .adv_w = 258, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13755, .adv_w = 247, .box_w = 14, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13916, .adv_w = 305, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14044, .adv_w = 304, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14180, .adv_w = 138, .box_w = 5, .box_h = 23, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 14238, .adv_w = 174, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14315, .adv_w = 306, .box_w = 17, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14460, .adv_w = 278, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14588, .adv_w = 285, .box_w = 14, .box_h = 23, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 14749, .adv_w = 301, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14877, .adv_w = 257, .box_w = 16, .box_h = 23, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 15061, .adv_w = 262, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15197, .adv_w = 298, .box_w = 14, .box_h = 23, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 15358, .adv_w = 236, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15469, .adv_w = 381, .box_w = 20, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15639, .adv_w = 300, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = -1}
+    {.bitmap_index = 0, .adv_w = 154, .box_w = 7, .box_h = 8, .ofs_x = 2, .ofs_y = 14},
+    {.bitmap_index = 28, .adv_w = 270, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 186, .adv_w = 270, .box_w = 9, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 281, .adv_w = 270, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 428, .adv_w = 270, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 607, .adv_w = 270, .box_w = 14, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 754, .adv_w = 270, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 912, .adv_w = 270, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1059, .adv_w = 308, .box_w = 16, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1195, .adv_w = 253, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1331, .adv_w = 250, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1459, .adv_w = 282, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1578, .adv_w = 142, .box_w = 6, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1629, .adv_w = 170, .box_w = 9, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1706, .adv_w = 291, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1825, .adv_w = 296, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1953, .adv_w = 145, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 1988, .adv_w = 258, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2099, .adv_w = 304, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2235, .adv_w = 138, .box_w = 5, .box_h = 23, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 2293, .adv_w = 174, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2370, .adv_w = 278, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2498, .adv_w = 301, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2626, .adv_w = 298, .box_w = 14, .box_h = 23, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 2787, .adv_w = 236, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2898, .adv_w = 300, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = -1}
 };
 
 /*---------------------
  *  CHARACTER MAPPING
  *--------------------*/
 
-
+static const uint16_t unicode_list_0[] = {
+    0x0, 0x2, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16,
+    0x19, 0x5b0, 0x5b1, 0x5b3, 0x5b4, 0x5b5, 0x5b6, 0x5b7,
+    0x5b8, 0x5b9, 0x5bb, 0x5be, 0x5bf, 0x5c0, 0x5c2, 0x5c4,
+    0x5c7, 0x5c8, 0x5ca,
+};
 
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1488, .range_length = 27, .glyph_id_start = 96,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+        .range_start = 32, .range_length = 1483, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 27, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
@@ -2436,29 +525,7 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
  *----------------*/
 
 
-/*Pair left and right glyphs for kerning*/
-static const uint8_t kern_pair_glyph_ids[] =
-{
-    8, 8,
-    15, 8,
-    16, 16
-};
-
-/* Kerning between the respective left and right glyphs
- * 4.4 format which needs to scaled with `kern_scale`*/
-static const int8_t kern_pair_values[] =
-{
-    -10, -64, -58
-};
-
-/*Collect the kern pair's data in one place*/
-static const lv_font_fmt_txt_kern_pair_t kern_pairs =
-{
-    .glyph_ids = kern_pair_glyph_ids,
-    .values = kern_pair_values,
-    .pair_cnt = 3,
-    .glyph_ids_size = 0
-};
+/*No kerning pair between the kept glyphs*/
 
 /*--------------------
  *  ALL CUSTOM DATA
@@ -2477,9 +544,9 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .glyph_bitmap = glyph_bitmap,
     .glyph_dsc = glyph_dsc,
     .cmaps = cmaps,
-    .kern_dsc = &kern_pairs,
+    .kern_dsc = NULL,
     .kern_scale = 16,
-    .cmap_num = 2,
+    .cmap_num = 1,
     .bpp = 4,
     .kern_classes = 0,
     .bitmap_format = 0,
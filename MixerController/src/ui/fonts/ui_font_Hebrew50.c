@@ -2,6 +2,7 @@
  * Size: 50 px
  * Bpp: 4
  * Opts: --bpp 4 --size 50 --font C:/Users/25236/SquareLine/assets/Heebo-VariableFont_wght.ttf -o C:/Users/25236/SquareLine/assets\ui_font_Hebrew50.c --format lvgl -r 0x20-0x7f --symbols אבגדהוזחטיכלמנסעפצקרשתםןץףך --no-compress --no-prefilter
+ * ui_fonts.py: 8 of 122 glyphs: " אוילםרש"
  ******************************************************************************/
 
 #include "../ui.h"
@@ -20,4540 +21,6 @@
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
-    /* U+0021 "!" */
-    0xe, 0xff, 0xfd, 0x0, 0xef, 0xff, 0xd0, 0xe,
-    0xff, 0xfd, 0x0, 0xef, 0xff, 0xc0, 0xd, 0xff,
-    0xfc, 0x0, 0xdf, 0xff, 0xc0, 0xd, 0xff, 0xfc,
-    0x0, 0xdf, 0xff, 0xc0, 0xc, 0xff, 0xfb, 0x0,
-    0xcf, 0xff, 0xb0, 0xc, 0xff, 0xfb, 0x0, 0xcf,
-    0xff, 0xb0, 0xc, 0xff, 0xfb, 0x0, 0xbf, 0xff,
-    0xa0, 0xb, 0xff, 0xfa, 0x0, 0xbf, 0xff, 0xa0,
-    0xb, 0xff, 0xfa, 0x0, 0xbf, 0xff, 0x90, 0xa,
-    0xff, 0xf9, 0x0, 0xaf, 0xff, 0x90, 0xa, 0xff,
-    0xf9, 0x0, 0xaf, 0xff, 0x90, 0x9, 0xff, 0xf8,
-    0x0, 0x9f, 0xff, 0x80, 0x9, 0xff, 0xf8, 0x0,
-    0x59, 0x99, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x3e, 0xff, 0x60,
-    0xd, 0xff, 0xff, 0x10, 0xff, 0xff, 0xf4, 0xd,
-    0xff, 0xff, 0x10, 0x2c, 0xfd, 0x40,
-
-    /* U+0022 "\"" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xc0,
-    0x0, 0xff, 0xf6, 0xaf, 0xfc, 0x0, 0xf, 0xff,
-    0x6a, 0xff, 0xc0, 0x0, 0xff, 0xf6, 0xaf, 0xfc,
-    0x0, 0xf, 0xff, 0x6a, 0xff, 0xa0, 0x0, 0xff,
-    0xf4, 0xaf, 0xf9, 0x0, 0xf, 0xff, 0x3a, 0xff,
-    0x80, 0x0, 0xff, 0xf2, 0xaf, 0xf6, 0x0, 0xf,
-    0xff, 0xa, 0xff, 0x50, 0x0, 0xff, 0xf0, 0xaf,
-    0xf4, 0x0, 0xf, 0xfe, 0xa, 0xff, 0x20, 0x0,
-    0xff, 0xc0, 0xaf, 0xf1, 0x0, 0x1f, 0xfb, 0x0,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf2,
-    0x0, 0x0, 0x6, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x0, 0x0,
-    0x0, 0x9f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xc0, 0x0, 0x0, 0xc,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xf9, 0x0, 0x0, 0x0, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x60, 0x0, 0x0, 0x2f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf3,
-    0x0, 0x0, 0x6, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xd0, 0x0, 0x0, 0xc,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x0, 0x0, 0x0, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x60, 0x0, 0x0, 0x2f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x16, 0x66, 0x66, 0x6a, 0xff, 0xfa,
-    0x66, 0x66, 0x6b, 0xff, 0xf9, 0x66, 0x66, 0x10,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x70, 0x0, 0x0, 0x1f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf4,
-    0x0, 0x0, 0x4, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x10, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xe0, 0x0, 0x0, 0xb,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xfb, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x80, 0x0, 0x0, 0x1f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf5,
-    0x0, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x10, 0x0,
-    0x0, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5,
-    0x55, 0x55, 0x5f, 0xff, 0xf5, 0x55, 0x55, 0x5f,
-    0xff, 0xf5, 0x55, 0x55, 0x10, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x20, 0x0,
-    0x0, 0x6f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xf0, 0x0, 0x0, 0x9,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0xcf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0x90, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf6,
-    0x0, 0x0, 0x3, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x30, 0x0,
-    0x0, 0x6f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xf0, 0x0, 0x0, 0x9,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0xcf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0x90, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf6,
-    0x0, 0x0, 0x2, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xff, 0xff, 0xfb,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x10, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xf8, 0x30, 0x0, 0x3a,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x2f, 0xff, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x8f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x60, 0x0, 0xcf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xb0,
-    0x0, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xe0, 0x0, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0,
-    0x0, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf1, 0x0, 0xcf, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x44, 0x40,
-    0x0, 0x8f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xfa, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xfe, 0x83,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x6c, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xef,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf4, 0x3d, 0xdd, 0xd3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6,
-    0x3f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf6, 0x1f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5,
-    0xe, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf3, 0x9, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xf0,
-    0x3, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xff, 0xff, 0xa0, 0x0, 0x9f, 0xff, 0xff,
-    0xa4, 0x0, 0x0, 0x28, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x1c, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x1, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x9c, 0xff, 0xff, 0xda, 0x61, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x58, 0x88, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x0, 0x4a, 0xdf, 0xec, 0x82, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xb2, 0x0, 0x4d, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xc0, 0x0, 0x0, 0x1f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0xa, 0x91, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xef, 0xf9,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x20, 0x0, 0x0, 0x9f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x10, 0x0, 0xd, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x40,
-    0x0, 0x0, 0x8, 0xff, 0xf0, 0x0, 0x8, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfc,
-    0x0, 0x0, 0x1, 0xff, 0xfa, 0x0, 0x2, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfc, 0x30, 0x15, 0xdf, 0xff, 0x30, 0x0, 0xcf,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x6f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x1f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x9c, 0xee, 0xc8, 0x10, 0x0, 0xb,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x40, 0x0, 0x17, 0xce, 0xed, 0x93,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xa0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf1, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf6, 0x0, 0x1e, 0xff, 0xe5, 0x10,
-    0x3c, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xfc, 0x0, 0x8, 0xff, 0xf3, 0x0,
-    0x0, 0xd, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x20, 0x0, 0xdf, 0xfa, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x70, 0x0, 0xf, 0xff, 0x60,
-    0x0, 0x0, 0x1, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xd0, 0x0, 0x1, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf3, 0x0, 0x0, 0x2f, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xf9, 0x0, 0x0, 0x1, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0xf, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0xdf, 0xfa, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x30,
-    0x0, 0x0, 0x3, 0xcf, 0xa0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf2, 0x0, 0x0, 0xc, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x71, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xe5, 0x0, 0x2b, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xfe, 0xa4,
-    0x0, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x0, 0x4a, 0xde, 0xfe, 0xc8,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xbb, 0xdf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfa, 0x0,
-    0x0, 0x3d, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfd, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xf8, 0x0, 0x1b, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf3, 0x5e, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfb, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x1, 0x77,
-    0x76, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x60, 0x6f,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x4f, 0xff, 0xd0,
-    0x0, 0x1e, 0xff, 0xff, 0x40, 0x0, 0x9f, 0xff,
-    0xfc, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x0, 0xa,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0xbf, 0xff, 0xfa,
-    0x0, 0x0, 0x8f, 0xff, 0xa0, 0x1, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xf8, 0x0,
-    0xc, 0xff, 0xf7, 0x0, 0x5f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf5, 0x1, 0xff,
-    0xff, 0x40, 0x7, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf3, 0x8f, 0xff, 0xf0,
-    0x0, 0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x6,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x4f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0xef, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xe5, 0x0, 0x0,
-    0x1, 0x6e, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x3e, 0xff, 0xff, 0xff, 0xdb, 0xbd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe4, 0x9f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0,
-    0xbf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x5a,
-    0xce, 0xff, 0xdc, 0x84, 0x0, 0x0, 0x1, 0xdf,
-    0xff, 0xf8,
-
-    /* U+0027 "'" */
-    0x5b, 0xbb, 0x27, 0xff, 0xf3, 0x7f, 0xff, 0x37,
-    0xff, 0xf3, 0x7f, 0xff, 0x27, 0xff, 0xf1, 0x7f,
-    0xff, 0x7, 0xff, 0xf0, 0x7f, 0xfe, 0x7, 0xff,
-    0xd0, 0x7f, 0xfc, 0x7, 0xff, 0xb0,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2c, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x20,
-
-    /* U+0029 ")" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x80, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfa, 0x40, 0x0, 0xd, 0xff, 0x80, 0x0, 0x5,
-    0xbe, 0x0, 0xbf, 0xff, 0xe8, 0x30, 0xdf, 0xf7,
-    0x3, 0x9e, 0xff, 0xf3, 0x1f, 0xff, 0xff, 0xff,
-    0xde, 0xff, 0xcd, 0xff, 0xff, 0xff, 0x81, 0x9e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x3, 0x8c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd9, 0x40, 0x0, 0x0, 0x0, 0x1, 0x7f,
-    0xff, 0xff, 0xd7, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xfe, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x2d, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x70, 0x3f, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xc0, 0x0, 0x9f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf3, 0x0,
-    0x0, 0xef, 0xff, 0x70, 0x0, 0x0, 0x8, 0xff,
-    0xf8, 0x0, 0x0, 0x5, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x5, 0xed, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x1, 0x30, 0x0, 0x0,
-    0x0, 0x17, 0x0, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x68, 0x88, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x33, 0x33,
-    0x33, 0x33, 0xff, 0xff, 0xf3, 0x33, 0x33, 0x33,
-    0x33, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x68, 0x88, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+002C "," */
-    0x0, 0xe, 0xff, 0xf9, 0x0, 0xe, 0xff, 0xf9,
-    0x0, 0xe, 0xff, 0xf9, 0x0, 0xe, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xf5,
-    0x0, 0x4f, 0xff, 0xf1, 0x0, 0x9f, 0xff, 0xc0,
-    0x1, 0xff, 0xff, 0x50, 0x9, 0xff, 0xfb, 0x0,
-    0x1f, 0xff, 0xf2, 0x0, 0x4, 0xef, 0x30, 0x0,
-    0x0, 0x3, 0x0, 0x0,
-
-    /* U+002D "-" */
-    0x1b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x91, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd,
-
-    /* U+002E "." */
-    0x0, 0x45, 0x20, 0x0, 0xbf, 0xff, 0x60, 0x5f,
-    0xff, 0xff, 0x7, 0xff, 0xff, 0xf1, 0x3f, 0xff,
-    0xfd, 0x0, 0x6d, 0xfc, 0x30,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x38, 0x88, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xc8,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xdb, 0xbd, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0x7f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf9, 0x0,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x0, 0x4, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x50,
-    0x8, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x90, 0xb, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xc0,
-    0xe, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf1,
-    0x1f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf2, 0x2f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3,
-    0x2f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf3, 0x2f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4,
-    0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf4, 0x3f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4,
-    0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf4, 0x3f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4,
-    0x2f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf4, 0x2f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf3,
-    0x2f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf3, 0x1f, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf2,
-    0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf0, 0xd, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0,
-    0xa, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xc0, 0x7, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90,
-    0x2, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x40, 0x0, 0xdf, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x0,
-    0x0, 0x6f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf8, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xc3, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xdb, 0xbd, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x8b, 0xef, 0xfe, 0xc9, 0x30, 0x0, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xcd, 0x0,
-    0x0, 0x0, 0x0, 0x4a, 0xff, 0xfd, 0x0, 0x0,
-    0x2, 0x8d, 0xff, 0xff, 0xfd, 0x0, 0x5, 0xbf,
-    0xff, 0xff, 0xff, 0xfd, 0x39, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xee,
-    0xff, 0xfd, 0xdf, 0xff, 0xff, 0xa4, 0xc, 0xff,
-    0xfd, 0xdf, 0xfc, 0x60, 0x0, 0xc, 0xff, 0xfd,
-    0xb8, 0x20, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfd,
-
-    /* U+0032 "2" */
-    0x0, 0x0, 0x0, 0x5, 0xac, 0xef, 0xfe, 0xc8,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0xff, 0xff, 0xfd, 0xbb, 0xdf, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfe, 0x60, 0x0,
-    0x0, 0x2b, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x6f,
-    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xd0, 0x0, 0xe, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x20, 0x3,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf7, 0x0, 0x7f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x80,
-    0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf9, 0x0, 0xae, 0xee, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xda, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0x20, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4,
-
-    /* U+0033 "3" */
-    0x0, 0x0, 0x0, 0x16, 0xad, 0xff, 0xfe, 0xb7,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xec,
-    0xbc, 0xef, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xdf,
-    0xff, 0xfd, 0x40, 0x0, 0x0, 0x2a, 0xff, 0xff,
-    0xf1, 0x0, 0x7f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x80, 0xe, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfe,
-    0x2, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf1, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x32,
-    0x66, 0x66, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x6e, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x5b, 0xbb, 0xcd, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x5a, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xfd, 0xaf, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xc8, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfb, 0x6f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x71, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xf2, 0xa, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xfb, 0x0, 0x1f, 0xff, 0xff,
-    0xc4, 0x0, 0x0, 0x2, 0xaf, 0xff, 0xff, 0x20,
-    0x0, 0x4f, 0xff, 0xff, 0xfe, 0xcb, 0xbe, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x4e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xde,
-    0xff, 0xdb, 0x72, 0x0, 0x0, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xdf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xfc, 0x8f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf2,
-    0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x80, 0x8f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfd, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf4, 0x0, 0x8f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xa0, 0x0, 0x8f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x10,
-    0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xf6, 0x0, 0x0, 0x8f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xc0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff,
-    0xff, 0xfb, 0xaa, 0xaa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf0, 0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0xa, 0xff, 0xfb, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x0, 0x0, 0xb, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xc0, 0x49, 0xde, 0xff, 0xda,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xdd,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0xdf, 0xff, 0xfe, 0x73, 0x10, 0x14, 0xaf,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x8d, 0xff, 0xb1,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x14, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0,
-    0x2f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xe0, 0xf, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xc0,
-    0xc, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0x70, 0x6, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x20,
-    0x1, 0xef, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xfb, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x3b, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xcb, 0xce, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x9c, 0xef, 0xfe, 0xc8, 0x30, 0x0, 0x0, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8b, 0xde,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x9f, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
-    0xff, 0xff, 0xed, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xff, 0xfe, 0x83, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf6, 0x0, 0x49, 0xce,
-    0xfe, 0xd9, 0x40, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x33, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0,
-    0x0, 0x4f, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xcc, 0xff, 0xff, 0xff, 0xe2, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0x92, 0x0, 0x0, 0x5e,
-    0xff, 0xff, 0xc0, 0x9, 0xff, 0xff, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0x50, 0xaf,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xfb, 0xb, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf1, 0xbf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x5c, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf8, 0xbf, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xaa, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfa, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xa7,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf9, 0x3f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf4, 0x9, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0x0, 0x3f, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x90, 0x0, 0xaf, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0xf2, 0x0, 0x1, 0xef, 0xff,
-    0xfb, 0x30, 0x0, 0x5, 0xef, 0xff, 0xf9, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xdb, 0xcf, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xce,
-    0xff, 0xdb, 0x61, 0x0, 0x0, 0x0,
-
-    /* U+0037 "7" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xc9,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xdb, 0xbd, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x2b,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0xbf, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfc, 0x0,
-    0x1, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x20, 0x4, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x50,
-    0x6, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x70, 0x6, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
-    0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x70, 0x2, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x30,
-    0x0, 0xdf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xfe, 0x0, 0x0, 0x5f, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf6, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x3b,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xfd, 0xce, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xc5, 0x10, 0x0, 0x5c, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x9f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xfa, 0x0, 0x3, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x40,
-    0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xb0, 0xf, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf1,
-    0x2f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf4, 0x3f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf5,
-    0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf5, 0x1f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3,
-    0xe, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xf0, 0xa, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xff, 0x50, 0x0, 0xaf, 0xff, 0xff,
-    0x71, 0x0, 0x0, 0x16, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xdb, 0xbd, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x9c, 0xef, 0xfe, 0xc9, 0x50, 0x0, 0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xfd, 0xa5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfc,
-    0xbd, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x70, 0x0, 0x2, 0xaf, 0xff, 0xff,
-    0x30, 0x0, 0x1f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf4,
-    0x0, 0xdf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xa0, 0x1f, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x5,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf4, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x78, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfa, 0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xb7, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfc, 0x5f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xd2, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfd,
-    0xe, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xc0, 0x9f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xfc, 0x2,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0xff, 0xff, 0xb0, 0x9, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x18, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x1d,
-    0xff, 0xff, 0xff, 0xcb, 0xdf, 0xff, 0xfe, 0xef,
-    0xff, 0x90, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x2d, 0xff, 0xf7, 0x0, 0x0, 0x1b,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x3, 0x9c, 0xef, 0xec, 0x82,
-    0x0, 0x2f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x15, 0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xdd, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfe, 0xc9,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x8, 0xee, 0xa0, 0x6f, 0xff, 0xf9, 0xaf, 0xff,
-    0xfd, 0x9f, 0xff, 0xfc, 0x2e, 0xff, 0xf4, 0x0,
-    0x45, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x45, 0x10, 0x2e, 0xff, 0xe3, 0x9f, 0xff, 0xfb,
-    0xbf, 0xff, 0xfd, 0x7f, 0xff, 0xf9, 0x9, 0xee,
-    0xa1,
-
-    /* U+003B ";" */
-    0x0, 0x4c, 0xfd, 0x40, 0x1, 0xef, 0xff, 0xf1,
-    0x4, 0xff, 0xff, 0xf4, 0x2, 0xff, 0xff, 0xf2,
-    0x0, 0x9f, 0xff, 0xa0, 0x0, 0x3, 0x53, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0x99, 0x80,
-    0x0, 0x9f, 0xff, 0xe0, 0x0, 0x9f, 0xff, 0xe0,
-    0x0, 0x9f, 0xff, 0xe0, 0x0, 0x9f, 0xff, 0xd0,
-    0x0, 0xaf, 0xff, 0xc0, 0x0, 0xdf, 0xff, 0x80,
-    0x2, 0xff, 0xff, 0x30, 0x8, 0xff, 0xfd, 0x0,
-    0x1f, 0xff, 0xf4, 0x0, 0xaf, 0xff, 0xb0, 0x0,
-    0x6f, 0xfd, 0x10, 0x0, 0x2, 0xa1, 0x0, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x17, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x8f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x6, 0xdf, 0xff, 0xff, 0xff, 0xfa, 0x30, 0x0,
-    0x0, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xfe, 0x71,
-    0x0, 0x0, 0x0, 0x18, 0xef, 0xff, 0xff, 0xff,
-    0xb5, 0x0, 0x0, 0x0, 0x2, 0x9f, 0xff, 0xff,
-    0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xfd, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6d, 0xff, 0xff, 0xff, 0xfa, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xff,
-    0xff, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4b, 0xff, 0xff, 0xff, 0xff, 0x92, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xff,
-    0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29,
-    0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x8e, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xc6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+003D "=" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xae, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0x8c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9,
-
-    /* U+003E ">" */
-    0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe7,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0x92, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xfb, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xff, 0xff,
-    0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7d, 0xff, 0xff, 0xff, 0xfe, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xff, 0xff,
-    0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x16, 0xdf, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x39, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6c, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x8e, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xff, 0xff,
-    0xff, 0xfe, 0x71, 0x0, 0x0, 0x0, 0x18, 0xef,
-    0xff, 0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x4,
-    0xbf, 0xff, 0xff, 0xff, 0xfb, 0x40, 0x0, 0x0,
-    0x1, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x92, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xe7,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xeb, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x10, 0x1, 0xff, 0xff, 0xfd, 0x51, 0x0,
-    0x17, 0xff, 0xff, 0xf9, 0x0, 0x8f, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0xd,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x50, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf8, 0x1c, 0xcc, 0xc5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3c, 0xcc, 0xc3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xb1, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x59, 0xbe, 0xff, 0xfe, 0xda, 0x73, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xfe, 0xb8, 0x54,
-    0x34, 0x56, 0x9c, 0xff, 0xff, 0xfd, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
-    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x7e, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xfd, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x60, 0x0, 0x0, 0x4f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x8d, 0xff, 0xec, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xfc, 0x0, 0x0, 0xb,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf1, 0x0, 0x2, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xc, 0xff, 0x60, 0x0,
-    0x8f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x83, 0x23, 0x8f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x8f, 0xfa, 0x0, 0xd, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0xdf, 0xfd, 0x0, 0x0, 0x0, 0x4, 0xff, 0xd0,
-    0x2, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0xd, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x0, 0x6f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf2, 0x9, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0x40, 0xcf, 0xfc,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf5, 0xe, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0xc, 0xff, 0x50, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf5, 0x1f, 0xff, 0x70, 0x0, 0x0,
-    0x3, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0xc, 0xff, 0x52,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf4, 0x2f, 0xff, 0x50, 0x0,
-    0x0, 0x8, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x32, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xf1, 0x2f, 0xff, 0x50,
-    0x0, 0x0, 0x9, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xfe, 0x1, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xb0, 0xf, 0xff,
-    0x80, 0x0, 0x0, 0x9, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf6, 0x0, 0xef, 0xfa, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0x90, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x10, 0xc,
-    0xff, 0xc0, 0x0, 0x0, 0x4, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x90, 0x0, 0x8f, 0xff, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x9, 0xff, 0xf1, 0x0,
-    0x5, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xfe, 0x99, 0xdf, 0xfe, 0x5f, 0xff, 0xe4, 0x0,
-    0x3b, 0xff, 0xf5, 0x0, 0x0, 0x1f, 0xff, 0x90,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0xfd, 0x30, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x1, 0x8d, 0xff, 0xc7,
-    0x0, 0x0, 0x0, 0x6c, 0xef, 0xec, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xb2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xfb, 0x51, 0x0, 0x0, 0x0,
-    0x0, 0x16, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff,
-    0xff, 0xfd, 0xa9, 0x89, 0x9b, 0xef, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x45,
-    0x67, 0x76, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x9f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfc,
-    0x1f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf6,
-    0xb, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf1,
-    0x6, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xb0,
-    0x0, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x50,
-    0x0, 0xaf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0,
-    0x0, 0x4f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf9, 0x0,
-    0x0, 0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4, 0x0,
-    0x0, 0x9, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xfe, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xc0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0,
-    0x0, 0xd, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x0,
-    0x0, 0x9f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x40,
-    0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xa0,
-    0x5, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf1,
-    0xb, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf6,
-    0x2f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc,
-
-    /* U+0042 "B" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xda,
-    0x72, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xe, 0xff, 0xff,
-    0xdd, 0xdd, 0xdd, 0xde, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x26, 0xdf, 0xff, 0xff, 0x30, 0xe, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xfb, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xf0, 0xe,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x30, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf4,
-    0xe, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x50, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf5, 0xe, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0x10, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xc0, 0xe, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xf4, 0x0, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xff,
-    0xff, 0xf7, 0x0, 0xe, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb2, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x81, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0xe, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x12, 0x6c, 0xff, 0xff,
-    0xf3, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xd0, 0xe, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x70, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0xe,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xf1, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x3e, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xf4, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x3e, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf2, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xe, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xa0, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf4, 0xe, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4b, 0xff, 0xff, 0xfb, 0x0,
-    0xef, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xde, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd6, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xb8, 0x40, 0x0,
-    0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff,
-    0xfd, 0xb7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xfe, 0xde, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf8,
-    0x30, 0x0, 0x1, 0x5b, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xd0, 0x0, 0x3, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x40, 0x0, 0xbf, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xfa, 0x0, 0x1f, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xe0, 0x5, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x10,
-    0x9f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6b, 0xbb, 0xb2, 0xc, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xaa, 0xaa, 0x20, 0x5f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xf1, 0x1, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfe, 0x0,
-    0xb, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x90, 0x0, 0x4f,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xf4, 0x0, 0x0, 0xbf, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xfc, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x61,
-    0x0, 0x0, 0x15, 0xbf, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfe, 0xdd,
-    0xef, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x9d, 0xef, 0xfe, 0xca, 0x61, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0044 "D" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xda, 0x72,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xfd, 0xdd, 0xdd, 0xde, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x14, 0x9f, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xaf, 0xff, 0xff, 0x40, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xe1, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf9, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0x20, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0x80, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xe0, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf3, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf6, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf9, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfb, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfc,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xfd, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xfd, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfd, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfd, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfc, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf9, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf6,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf3, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xe0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x90, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0x20, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfa,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xe1, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
-    0xff, 0x40, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x15, 0xaf, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0xef, 0xff, 0xfd, 0xdd, 0xdd, 0xde, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xca, 0x61, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7e, 0xff, 0xff, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd6, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0xe, 0xff, 0xff, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xd2, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0x9e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-
-    /* U+0046 "F" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x2e, 0xff, 0xff, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd1, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xd9, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0xce, 0xff,
-    0xfd, 0xb8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xe8,
-    0x30, 0x0, 0x1, 0x5b, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xb1, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf2, 0x0, 0x4, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x80, 0x0, 0xaf, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfe, 0x0, 0xf, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xf2, 0x4, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xbb, 0xbb, 0x30,
-    0x8f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x6c, 0xcc, 0xcc, 0xcc, 0xdf, 0xff, 0xf6, 0xc,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x60, 0xaf, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf6, 0x7, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x60, 0x3f, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf6, 0x0, 0xef, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x60,
-    0x7, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf6, 0x0, 0x1e,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x60, 0x0, 0x6f, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf6, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x60, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xc6,
-    0x10, 0x0, 0x0, 0x26, 0xcf, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xed,
-    0xde, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x6a, 0xde, 0xff, 0xfe, 0xc9, 0x51, 0x0,
-    0x0, 0x0,
-
-    /* U+0048 "H" */
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xef, 0xff, 0xfd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xf7,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7,
-
-    /* U+0049 "I" */
-    0x8f, 0xff, 0xf3, 0x8f, 0xff, 0xf3, 0x8f, 0xff,
-    0xf3, 0x8f, 0xff, 0xf3, 0x8f, 0xff, 0xf3, 0x8f,
-    0xff, 0xf3, 0x8f, 0xff, 0xf3, 0x8f, 0xff, 0xf3,
-    0x8f, 0xff, 0xf3, 0x8f, 0xff, 0xf3, 0x8f, 0xff,
-    0xf3, 0x8f, 0xff, 0xf3, 0x8f, 0xff, 0xf3, 0x8f,
-    0xff, 0xf3, 0x8f, 0xff, 0xf3, 0x8f, 0xff, 0xf3,
-    0x8f, 0xff, 0xf3, 0x8f, 0xff, 0xf3, 0x8f, 0xff,
-    0xf3, 0x8f, 0xff, 0xf3, 0x8f, 0xff, 0xf3, 0x8f,
-    0xff, 0xf3, 0x8f, 0xff, 0xf3, 0x8f, 0xff, 0xf3,
-    0x8f, 0xff, 0xf3, 0x8f, 0xff, 0xf3, 0x8f, 0xff,
-    0xf3, 0x8f, 0xff, 0xf3, 0x8f, 0xff, 0xf3, 0x8f,
-    0xff, 0xf3, 0x8f, 0xff, 0xf3, 0x8f, 0xff, 0xf3,
-    0x8f, 0xff, 0xf3, 0x8f, 0xff, 0xf3, 0x8f, 0xff,
-    0xf3, 0x8f, 0xff, 0xf3,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xc3,
-    0x55, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfb, 0xaf, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xa9, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf8, 0x6f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0x52, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0xf9, 0x0, 0x3f, 0xff, 0xff,
-    0xd6, 0x10, 0x0, 0x17, 0xff, 0xff, 0xfe, 0x10,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xed, 0xef, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7b, 0xdf,
-    0xff, 0xdb, 0x71, 0x0, 0x0, 0x0,
-
-    /* U+004B "K" */
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfd, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xe1, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x20, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x50, 0x0, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x7, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x5f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x4,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xd1, 0xef, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xed, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xdb, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xfe, 0x10, 0xdf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xe2, 0x0, 0x2f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfe, 0x20,
-    0x0, 0x5, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xfe, 0x10, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xc0, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf8, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x40, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xe1,
-
-    /* U+004C "L" */
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xd9, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb,
-
-    /* U+004D "M" */
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf8, 0xef, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf8, 0xef, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf8, 0xef, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf8,
-    0xef, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xf8, 0xef, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf8, 0xef, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xf8, 0xef, 0xff,
-    0xcf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0xff, 0xf8,
-    0xef, 0xff, 0x7f, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x9c,
-    0xff, 0xf8, 0xef, 0xff, 0x79, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x3d, 0xff, 0xf8, 0xef, 0xff, 0x73, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xfd, 0xd, 0xff, 0xf8, 0xef, 0xff,
-    0x80, 0xcf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf6, 0xe, 0xff, 0xf8,
-    0xef, 0xff, 0x80, 0x6f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf1, 0xe,
-    0xff, 0xf8, 0xef, 0xff, 0x90, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x90, 0xf, 0xff, 0xf8, 0xef, 0xff, 0x90, 0x9,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x30, 0xf, 0xff, 0xf8, 0xef, 0xff,
-    0xa0, 0x3, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfd, 0x0, 0xf, 0xff, 0xf8,
-    0xef, 0xff, 0xa0, 0x0, 0xcf, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0, 0xf,
-    0xff, 0xf8, 0xef, 0xff, 0xb0, 0x0, 0x6f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0xf, 0xff, 0xf8, 0xef, 0xff, 0xb0, 0x0,
-    0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x90, 0x0, 0x1f, 0xff, 0xf8, 0xef, 0xff,
-    0xc0, 0x0, 0x9, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0x30, 0x0, 0x1f, 0xff, 0xf8,
-    0xef, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0xa, 0xff, 0xfd, 0x0, 0x0, 0x2f,
-    0xff, 0xf8, 0xef, 0xff, 0xd0, 0x0, 0x0, 0xcf,
-    0xff, 0xb0, 0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0,
-    0x0, 0x2f, 0xff, 0xf8, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x6f, 0xff, 0xf1, 0x0, 0x0, 0x7f, 0xff,
-    0xf0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0xf, 0xff, 0xf7, 0x0, 0x0,
-    0xdf, 0xff, 0x90, 0x0, 0x0, 0x3f, 0xff, 0xf8,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x9, 0xff, 0xfe,
-    0x0, 0x3, 0xff, 0xff, 0x30, 0x0, 0x0, 0x3f,
-    0xff, 0xf8, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x40, 0xa, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf8, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xa0, 0xf, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf1, 0x6f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf7, 0xcf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf8, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xfe, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf8, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf8, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf8, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8,
-
-    /* U+004E "N" */
-    0xef, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7, 0xef, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf7, 0xef, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf7, 0xef, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7,
-    0xef, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7, 0xef, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf7, 0xef, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf7, 0xef, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7,
-    0xef, 0xff, 0xee, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7, 0xef, 0xff,
-    0xd4, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf7, 0xef, 0xff, 0xd0, 0xaf,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf7, 0xef, 0xff, 0xd0, 0x1e, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7,
-    0xef, 0xff, 0xd0, 0x5, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7, 0xef, 0xff,
-    0xd0, 0x0, 0xbf, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0,
-    0x1f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0, 0x7, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0xcf, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x3f, 0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x3f,
-    0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xf5, 0x0, 0x0, 0x3f, 0xff, 0xf7,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfe, 0x10, 0x0, 0x3f, 0xff, 0xf7, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xa0,
-    0x0, 0x3f, 0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf4, 0x0, 0x3f,
-    0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xf7,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0x90, 0x3f, 0xff, 0xf7, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xf3, 0x3f, 0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xfd, 0x3f,
-    0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xbf, 0xff, 0xf7,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf7,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf7, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf7, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf7,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xbe, 0xff,
-    0xed, 0xa6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
-    0xff, 0xfb, 0x52, 0x0, 0x14, 0x8e, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf8, 0x0,
-    0x0, 0x9f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xfe, 0x0, 0x0,
-    0xef, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x50, 0x4, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xa0, 0x8, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xe0, 0xb, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf1, 0xe, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf4, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf6, 0x1f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6,
-    0x1f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf7, 0x2f,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x2f, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf8, 0x1f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf7, 0x1f, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf6, 0xf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf6, 0xe, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf4, 0xb, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf2,
-    0x8, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0, 0x4,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xa0, 0x0, 0xef,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x60, 0x0, 0x9f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf8, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfe, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xfb, 0x52,
-    0x0, 0x3, 0x8e, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0xbe, 0xff, 0xed, 0xa6, 0x10,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xb8, 0x30, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xef,
-    0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xef, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x5c, 0xff, 0xff, 0xfb,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x50, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xd0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf3,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xf7, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xfa, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfb, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xfa, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf8, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xf4, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x80, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xff, 0xff,
-    0xfe, 0x0, 0xef, 0xff, 0xfd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xef, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x30, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xb8, 0x40, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff,
-    0xec, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xfa, 0x51, 0x0, 0x14, 0xaf, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfc,
-    0x20, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x5f, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf5, 0x0,
-    0x0, 0xcf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x2,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0x20, 0x7, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x70, 0xc, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xb0, 0xf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xe0, 0x1f, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xf1, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf2, 0x4f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf3,
-    0x5f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x5f,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf4, 0x5f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf4, 0x5f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf4, 0x4f, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf3, 0x3f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf2, 0x1f, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xf1, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0,
-    0xc, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x7,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x70, 0x2, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x20, 0x0, 0xcf, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xfc, 0x0, 0x0, 0x5f, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf5, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x20,
-    0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0x41,
-    0x0, 0x14, 0x9f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x49, 0xce, 0xff, 0xec, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff,
-    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x40, 0x0,
-
-    /* U+0052 "R" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xda,
-    0x72, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xef,
-    0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xef, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x26, 0xdf, 0xff, 0xff, 0x90,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xf2, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xf9, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfe, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0x20, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x40, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x50, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x50, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x30, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0x10, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xfc, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xf6, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xff, 0xff, 0xc0, 0x0, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x2, 0x4a, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x20, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xef,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf4, 0x0, 0x0, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0,
-    0x0, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x50, 0x0, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xe0, 0x0, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf7, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfe, 0x10, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x80, 0xef, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf2, 0xef,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xfa,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xfe,
-    0xda, 0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xee,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xfe, 0x72, 0x0, 0x0, 0x15, 0xbf,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0xef, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x40, 0x0, 0x5f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xfc, 0x0, 0xa,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xf3, 0x0, 0xdf, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x70, 0xe, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfa, 0x0,
-    0xcf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaa, 0xaa, 0x70, 0xa, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xfe, 0x94, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xcf, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xcf, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0x90, 0xaa, 0xaa, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb, 0xf,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xc0, 0xcf, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x8, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x90,
-    0x1f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf5, 0x0, 0x7f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xfe, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xc6,
-    0x20, 0x0, 0x0, 0x38, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xfd, 0xde,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x19, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0xbd, 0xff,
-    0xfe, 0xc9, 0x50, 0x0, 0x0, 0x0,
-
-    /* U+0054 "T" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xad, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf,
-    0xff, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x9f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x29, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf2, 0x9f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x29, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf2, 0x9f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x29, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf2, 0x9f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x29, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf2, 0x9f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x29, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf2, 0x9f,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x29, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf2, 0x9f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x29,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf2, 0x9f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x29, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf2,
-    0x9f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x29, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf2, 0x9f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x29, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf2, 0x9f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x29, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf2, 0x9f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x29, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf2, 0x8f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x27, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0x6f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0x2, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xb0, 0xe, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf6, 0x0,
-    0x8f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x10, 0x0, 0xef, 0xff,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x70, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x83,
-    0x0, 0x0, 0x5, 0xbf, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xed, 0xef,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x4,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xff,
-    0xda, 0x61, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0x1f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf0,
-    0xc, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xa0,
-    0x6, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x40,
-    0x0, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfe, 0x0,
-    0x0, 0xaf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0,
-    0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf3, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xc0, 0x0,
-    0x0, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0,
-    0x0, 0x4f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf7, 0x0,
-    0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfd, 0x0,
-    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x20,
-    0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
-    0xa, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xd0,
-    0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf2,
-    0x5f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf8,
-    0xbf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x6f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x22, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xe0, 0xe, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa,
-    0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x70, 0x7, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf3, 0x0, 0x3f, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xb0, 0x0, 0xb,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xcf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf7, 0x0, 0x0, 0x7f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf6, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0x40, 0x0, 0x4, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0xf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xb0, 0xbf, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf7, 0x6,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x8, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x20, 0x2f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xe0, 0x0, 0xdf, 0xff, 0x20, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x10, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x8, 0xff, 0xf9, 0x0,
-    0x9, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x40, 0x0, 0x5f, 0xff,
-    0xb0, 0x0, 0x0, 0xe, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x1f,
-    0xff, 0xf0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x20, 0x0, 0x6, 0xff, 0xfb, 0x0,
-    0x0, 0xc, 0xff, 0xf3, 0x0, 0x0, 0x5f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf6,
-    0x0, 0x0, 0xaf, 0xff, 0x70, 0x0, 0x0, 0x7f,
-    0xff, 0x80, 0x0, 0x9, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0xe,
-    0xff, 0xf2, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0,
-    0x0, 0xcf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xfd, 0x0, 0x3, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf1, 0x0, 0xf, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf1, 0x0, 0x7f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x50, 0x3, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x50, 0xc,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf9,
-    0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf8, 0x1, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xe0, 0xa, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xc0, 0x5f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x20, 0xef, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x9,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf6, 0x1f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf1, 0xdf, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xa3, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x4f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfd, 0x6f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfa,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xfa, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x1e, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x70, 0x6,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xfd, 0x0, 0x0, 0xcf,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xf8, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x20, 0x0, 0xa,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xc0, 0x0, 0x4f, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf6, 0x0, 0xdf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xfe, 0x18, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xbf, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0x6d, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfc,
-    0x4, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf2, 0x0,
-    0xaf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0x80, 0x0, 0x1e,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xfd, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xd0, 0x0, 0x1,
-    0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xf7, 0x0, 0xa, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x20, 0x4f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xb0,
-
-    /* U+0059 "Y" */
-    0x5f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf5, 0xd,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xc0, 0x4, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x30, 0x0, 0xbf, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xfb, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0xa, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0x30, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xb0, 0x0, 0xb, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xf3, 0x0, 0x3f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfb,
-    0x0, 0xcf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x34,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xcc, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x7d,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-
-    /* U+005B "[" */
-    0x4a, 0xaa, 0xaa, 0xaa, 0xa8, 0x7f, 0xff, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xf2, 0x0,
-    0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff,
-    0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0,
-    0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf2,
-    0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7f,
-    0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0,
-    0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff,
-    0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0,
-    0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf2,
-    0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7f,
-    0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0,
-    0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff,
-    0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0,
-    0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf2,
-    0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7f,
-    0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0,
-    0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff,
-    0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0,
-    0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf2,
-    0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7f,
-    0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0,
-    0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff,
-    0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0,
-    0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf2,
-    0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7f,
-    0xff, 0xf2, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0,
-    0x0, 0x7f, 0xff, 0xfb, 0xaa, 0xa8, 0x7f, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+005C "\\" */
-    0xcf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x28, 0x88, 0x70,
-
-    /* U+005D "]" */
-    0x8a, 0xaa, 0xaa, 0xaa, 0xa5, 0xcf, 0xff, 0xff,
-    0xff, 0xf8, 0xcf, 0xff, 0xff, 0xff, 0xf8, 0xcf,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff,
-    0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0,
-    0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf8,
-    0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f,
-    0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0,
-    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff,
-    0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0,
-    0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf8,
-    0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f,
-    0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0,
-    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff,
-    0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0,
-    0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf8,
-    0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f,
-    0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0,
-    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff,
-    0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0,
-    0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf8,
-    0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f,
-    0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0,
-    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff,
-    0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0,
-    0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf8,
-    0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f,
-    0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0,
-    0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff,
-    0xf8, 0x8a, 0xaa, 0xbf, 0xff, 0xf8, 0xcf, 0xff,
-    0xff, 0xff, 0xf8, 0xcf, 0xff, 0xff, 0xff, 0xf8,
-    0xcf, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf9, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfd, 0xf,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x70, 0x9f, 0xff, 0x70, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf1, 0x3, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfb, 0x0, 0xd, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0x50, 0x0, 0x7f, 0xff,
-    0xa0, 0x0, 0x0, 0x2f, 0xff, 0xe0, 0x0, 0x1,
-    0xff, 0xff, 0x10, 0x0, 0x9, 0xff, 0xf8, 0x0,
-    0x0, 0xa, 0xff, 0xf7, 0x0, 0x0, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x4f, 0xff, 0xd0, 0x0, 0x6f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x40,
-    0xc, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xfb, 0x3, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf1,
-
-    /* U+005F "_" */
-    0x9a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0x5e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-
-    /* U+0060 "`" */
-    0x2e, 0xff, 0xff, 0x40, 0x0, 0x0, 0x3f, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x5f, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x50,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xed, 0xb6,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xeb,
-    0xab, 0xef, 0xff, 0xff, 0xd1, 0x0, 0x0, 0xbf,
-    0xff, 0xfc, 0x30, 0x0, 0x0, 0x4d, 0xff, 0xff,
-    0xa0, 0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xff, 0x10, 0x9, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5,
-    0x0, 0x9c, 0xcc, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x12, 0x23, 0x33, 0x3f, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x4, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0xbf, 0xff, 0xff, 0xa6, 0x31, 0x0,
-    0x0, 0xf, 0xff, 0xf9, 0x0, 0x6f, 0xff, 0xfc,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90,
-    0xd, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf9, 0x2, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x4f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf9, 0x5, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x90, 0x3f, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xf9, 0x0, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0xff, 0xff, 0x90, 0x9, 0xff, 0xff,
-    0xf8, 0x20, 0x0, 0x39, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x5c, 0xff, 0xff, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20,
-    0x9f, 0xff, 0xf4, 0x0, 0x0, 0x3, 0x9d, 0xff,
-    0xed, 0x93, 0x0, 0x2, 0x88, 0x88, 0x30,
-
-    /* U+0062 "b" */
-    0x5a, 0xaa, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x0, 0x4, 0x9d, 0xff, 0xec, 0x93, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf0, 0x3c, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x10, 0x0, 0x9, 0xff, 0xff,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xed, 0xef,
-    0xff, 0xff, 0xfe, 0x10, 0x9, 0xff, 0xff, 0xff,
-    0xd5, 0x0, 0x0, 0x18, 0xff, 0xff, 0xfa, 0x0,
-    0x9f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf3, 0x9, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xa0, 0x9f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf4, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x79, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfa, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xb9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfc, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xc9,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xfc, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xb9, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf9, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x79, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf4, 0x9f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0x9, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x90,
-    0x9f, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf2, 0x9, 0xff, 0xff, 0xff, 0xe7,
-    0x10, 0x0, 0x18, 0xff, 0xff, 0xf9, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xed, 0xef, 0xff, 0xff,
-    0xfd, 0x0, 0x9, 0xff, 0xfc, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x9f, 0xff,
-    0xb0, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10,
-    0x0, 0x9, 0xff, 0xfa, 0x0, 0x4, 0x9d, 0xff,
-    0xfc, 0x93, 0x0, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xc8,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfd,
-    0xbb, 0xdf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0x81, 0x0, 0x0, 0x2b, 0xff, 0xff,
-    0xe1, 0x0, 0xe, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x80, 0x6, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x0, 0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf4, 0x2f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x76,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0x77, 0x74, 0x8f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9b, 0xbb, 0x60, 0xdf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5, 0x7, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x10, 0xe, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xa0, 0x0, 0x4f, 0xff,
-    0xff, 0x71, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xfc, 0xbb, 0xdf,
-    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0, 0x0,
-    0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9c,
-    0xef, 0xfe, 0xb7, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9a, 0xaa, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x1, 0x7b, 0xef, 0xfd, 0xa5, 0x0, 0xf,
-    0xff, 0xfa, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x50, 0xff, 0xff, 0xa0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff,
-    0xfa, 0x0, 0xa, 0xff, 0xff, 0xff, 0xed, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x6, 0xff, 0xff,
-    0xfa, 0x30, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xfa,
-    0x0, 0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xa0, 0x7f, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfa, 0xc,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xa1, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x5f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xa7, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfa, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xaa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfa, 0xaf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xaa,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfa, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa7, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfa, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xa1, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfa, 0xc, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xa0, 0x6f, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfa,
-    0x0, 0xef, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xa0, 0x5, 0xff, 0xff, 0xfa,
-    0x30, 0x0, 0x4, 0xcf, 0xff, 0xff, 0xfa, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xed, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8b, 0xff, 0xfa, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0xaf,
-    0xff, 0xa0, 0x0, 0x0, 0x1, 0x7b, 0xef, 0xfd,
-    0xa6, 0x0, 0x9, 0xff, 0xfa,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x0, 0x1, 0x7b, 0xef, 0xfe, 0xb7,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd,
-    0xbb, 0xdf, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x1e,
-    0xff, 0xff, 0xa1, 0x0, 0x0, 0x2c, 0xff, 0xff,
-    0xb0, 0x0, 0xa, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0x30, 0x3, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa,
-    0x0, 0xbf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf0, 0xf, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x35,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf7, 0x7f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x9a, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0xbf, 0xff, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0x7a, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0x80, 0x0, 0xd, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xff, 0xb1, 0x0, 0x3f, 0xff,
-    0xff, 0xd4, 0x0, 0x0, 0x2, 0x8f, 0xff, 0xfd,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xcb, 0xcd,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x4e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0,
-    0x0, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7b,
-    0xdf, 0xff, 0xdb, 0x61, 0x0, 0x0, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x9d, 0xef, 0xec,
-    0x40, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff,
-    0xdd, 0xf4, 0x0, 0x0, 0x8, 0xff, 0xff, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x37,
-    0x77, 0xdf, 0xff, 0xfa, 0x77, 0x77, 0x60, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x0, 0x17, 0xbe, 0xfe, 0xda, 0x50,
-    0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xe5, 0x9, 0xff, 0xfb, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xaf, 0xff, 0xb0, 0x0, 0xbf, 0xff, 0xff, 0xfe,
-    0xdd, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x6f,
-    0xff, 0xff, 0xb3, 0x0, 0x0, 0x4b, 0xff, 0xff,
-    0xff, 0xb0, 0xe, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfb, 0x7, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xb0, 0xcf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfb, 0x1f, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xb5,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfb, 0x7f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xb9, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfb, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xba, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfb, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xb9, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfb,
-    0x7f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xb4, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x1f,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xb0, 0xcf, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x6, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xb0, 0xe, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfb, 0x0, 0x5f, 0xff,
-    0xff, 0xa3, 0x0, 0x0, 0x4c, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xde, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xef, 0xff, 0xb0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe5,
-    0xe, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x17, 0xbe,
-    0xff, 0xda, 0x60, 0x0, 0xef, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf5, 0x0, 0x6, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0x10, 0x4, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xa0,
-    0x1, 0xef, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf2, 0x0, 0xb, 0xff, 0xff, 0xfb,
-    0x64, 0x34, 0x8d, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7d, 0xff, 0xff, 0xff, 0xfe, 0x81, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x46, 0x77,
-    0x52, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0x25, 0x55, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x17, 0xbe, 0xfe,
-    0xda, 0x40, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x9f,
-    0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x9f, 0xff, 0xfc, 0xff, 0xff, 0xed,
-    0xef, 0xff, 0xff, 0xfd, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0x71, 0x0, 0x1, 0x8f, 0xff, 0xff, 0x50,
-    0x9f, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xb0, 0x9f, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xf0, 0x9f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf1, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf2, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf3, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf3, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf3, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf3, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf3, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf3, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf3, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf3, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf3,
-
-    /* U+0069 "i" */
-    0x6, 0xef, 0xb1, 0x2f, 0xff, 0xfa, 0x6f, 0xff,
-    0xfe, 0x3f, 0xff, 0xfb, 0x8, 0xff, 0xd2, 0x0,
-    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0xf, 0xff,
-    0xf8, 0xf, 0xff, 0xf8, 0xf, 0xff, 0xf8, 0xf,
-    0xff, 0xf8, 0xf, 0xff, 0xf8, 0xf, 0xff, 0xf8,
-    0xf, 0xff, 0xf8, 0xf, 0xff, 0xf8, 0xf, 0xff,
-    0xf8, 0xf, 0xff, 0xf8, 0xf, 0xff, 0xf8, 0xf,
-    0xff, 0xf8, 0xf, 0xff, 0xf8, 0xf, 0xff, 0xf8,
-    0xf, 0xff, 0xf8, 0xf, 0xff, 0xf8, 0xf, 0xff,
-    0xf8, 0xf, 0xff, 0xf8, 0xf, 0xff, 0xf8, 0xf,
-    0xff, 0xf8, 0xf, 0xff, 0xf8, 0xf, 0xff, 0xf8,
-    0xf, 0xff, 0xf8, 0xf, 0xff, 0xf8, 0xf, 0xff,
-    0xf8, 0xf, 0xff, 0xf8,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x0, 0xaf, 0xe7, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf4, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0xaf, 0xff, 0xf5, 0x0, 0x0,
-    0x1, 0xdf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0, 0x7f,
-    0xff, 0xf2, 0x0, 0x0, 0x7, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x7f, 0xff, 0xf2,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x20, 0x0, 0x0, 0x7f, 0xff,
-    0xf2, 0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0, 0x7f,
-    0xff, 0xf2, 0x0, 0x0, 0x7, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x7f, 0xff, 0xf2,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x7f, 0xff, 0xf2, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x20, 0x0, 0x0, 0x7f, 0xff,
-    0xf1, 0x0, 0x0, 0x7, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x1e, 0xff,
-    0xfd, 0x4, 0x55, 0x7e, 0xff, 0xff, 0x80, 0x9f,
-    0xff, 0xff, 0xff, 0xf2, 0x9, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x9f, 0xff, 0xff, 0xd5, 0x0, 0x1,
-    0x47, 0x76, 0x30, 0x0, 0x0,
-
-    /* U+006B "k" */
-    0x5a, 0xaa, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfa, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x9, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfc, 0x0,
-    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xfd, 0x10, 0x0, 0x9, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x9, 0xff, 0xff, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf0, 0x0, 0x4f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x0, 0x3f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x2e, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x1d, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfb,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xc0, 0x6f,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xd1, 0x0, 0xaf, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf1, 0x0, 0x1, 0xef,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0x50, 0x0, 0x9, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xfe, 0x10, 0x0, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xfc, 0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf8, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf4, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xe1,
-
-    /* U+006C "l" */
-    0x1a, 0xaa, 0xa3, 0x3f, 0xff, 0xf6, 0x3f, 0xff,
-    0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f,
-    0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6,
-    0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff,
-    0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f,
-    0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6,
-    0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff,
-    0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f,
-    0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6,
-    0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff,
-    0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f,
-    0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6,
-    0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff,
-    0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f,
-    0xff, 0xf6,
-
-    /* U+006D "m" */
-    0x9f, 0xff, 0xb0, 0x0, 0x49, 0xce, 0xfe, 0xd9,
-    0x30, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xda,
-    0x50, 0x0, 0x0, 0x9f, 0xff, 0xc0, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x3c, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x9f, 0xff,
-    0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff,
-    0xff, 0xff, 0xfc, 0x5f, 0xff, 0xff, 0xdd, 0xef,
-    0xff, 0xff, 0xff, 0x10, 0x9f, 0xff, 0xff, 0xf9,
-    0x30, 0x0, 0x3, 0xbf, 0xff, 0xff, 0xff, 0xfe,
-    0x50, 0x0, 0x1, 0x7f, 0xff, 0xff, 0x80, 0x9f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xe0, 0x9f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xf2, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf6, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf6, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf7, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf7, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf7, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf7, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf7, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf7,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf7, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf7, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf7, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf7, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf7, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf7, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf7, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf7,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf7, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf7, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf7,
-
-    /* U+006E "n" */
-    0x9f, 0xff, 0xc0, 0x0, 0x27, 0xce, 0xfe, 0xda,
-    0x40, 0x0, 0x0, 0x9f, 0xff, 0xc0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x9f, 0xff,
-    0xd2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x9f, 0xff, 0xfe, 0xff, 0xff, 0xed, 0xef,
-    0xff, 0xff, 0xfd, 0x0, 0x9f, 0xff, 0xff, 0xfe,
-    0x61, 0x0, 0x1, 0x8f, 0xff, 0xff, 0x50, 0x9f,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xb0, 0x9f, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf0, 0x9f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf2, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf3, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf3, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf3, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf3, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf3, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf3, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf3, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf3, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf3,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x0, 0x1, 0x7b, 0xef, 0xfe, 0xc9,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xfe, 0xbb, 0xcf, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xb3, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf9, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x3, 0xef,
-    0xff, 0xf4, 0x0, 0x4, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xd0, 0x0,
-    0xbf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x40, 0x1f, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf9,
-    0x5, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xe0, 0x8f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x1a, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3, 0xbf, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x4b, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4, 0xbf,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x4a, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3,
-    0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x15, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xe0, 0x1f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf9, 0x0, 0xbf, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x40, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xd0, 0x0, 0xc,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0xff, 0xf4, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xb3,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xfe, 0xbb, 0xcf, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7b, 0xef, 0xfe, 0xc9, 0x40, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x9f, 0xff, 0x90, 0x0, 0x4a, 0xdf, 0xfe, 0xc9,
-    0x30, 0x0, 0x0, 0x9, 0xff, 0xfa, 0x3, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x9f,
-    0xff, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xde, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x9f, 0xff,
-    0xff, 0xfc, 0x40, 0x0, 0x3, 0xaf, 0xff, 0xff,
-    0xa0, 0x9, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0x20, 0x9f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf9,
-    0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xe0, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x39,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf6, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x99, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfa, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xb9, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xfb, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xb9, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfa,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x89, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf6, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x39, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xe0, 0x9f, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf8, 0x9, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x20, 0x9f, 0xff, 0xff,
-    0xf9, 0x20, 0x0, 0x1, 0x8f, 0xff, 0xff, 0x80,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xbc, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x9f, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x9,
-    0xff, 0xff, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xa1, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x59,
-    0xde, 0xfe, 0xc9, 0x20, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xeb, 0x61,
-    0x0, 0x9f, 0xff, 0x90, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xe6, 0xa, 0xff, 0xf9, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xcf, 0xff, 0x90, 0x0, 0xbf, 0xff, 0xff, 0xfd,
-    0xbb, 0xdf, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x7f,
-    0xff, 0xff, 0xa2, 0x0, 0x0, 0x19, 0xff, 0xff,
-    0xff, 0x90, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf9, 0x7, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0x90, 0xdf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf9, 0x2f, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x95,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf9, 0x7f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x99, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf9, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x9a, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf9, 0xaf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x99, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf9,
-    0x7f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x95, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf9, 0x1f,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x90, 0xdf, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf9, 0x7, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x90, 0xe, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf9, 0x0, 0x6f, 0xff,
-    0xff, 0x91, 0x0, 0x0, 0x29, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0xaf, 0xff, 0xff, 0xfd, 0xbb, 0xdf,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe6,
-    0xf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x17, 0xbe,
-    0xff, 0xda, 0x60, 0x0, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x90,
-
-    /* U+0072 "r" */
-    0x9f, 0xff, 0xd0, 0x1, 0x8c, 0xff, 0xd2, 0x9f,
-    0xff, 0xe0, 0x5f, 0xff, 0xff, 0xf3, 0x9f, 0xff,
-    0xe5, 0xff, 0xff, 0xff, 0xf3, 0x9f, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xf3, 0x9f, 0xff, 0xff, 0xff,
-    0xc8, 0x65, 0x61, 0x9f, 0xff, 0xff, 0xe3, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xec, 0x94,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xfc, 0xbb, 0xdf,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0xef, 0xff, 0xf8,
-    0x10, 0x0, 0x1, 0xaf, 0xff, 0xff, 0x20, 0x6,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x90, 0xa, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xe0, 0xc, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0,
-    0xb, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x12, 0x22, 0x20, 0x7, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfd, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xc8, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xb6, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7b, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x7c, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xf1, 0x58, 0x88,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf4, 0x9f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf5, 0x6f, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3, 0x1f,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xff, 0xf0, 0x7, 0xff, 0xff, 0xf8, 0x10, 0x0,
-    0x0, 0x4d, 0xff, 0xff, 0x90, 0x0, 0xbf, 0xff,
-    0xff, 0xfd, 0xbb, 0xcf, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd2, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x49, 0xce, 0xff, 0xec, 0x95, 0x0, 0x0,
-    0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x0, 0x7, 0x88, 0x84, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf9, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x57, 0x77, 0x7f, 0xff, 0xff,
-    0x77, 0x77, 0x30, 0x0, 0x0, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xef,
-    0x90, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x7, 0xcf, 0xfe, 0xc5,
-
-    /* U+0075 "u" */
-    0xaf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf2, 0xaf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf2, 0xaf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf2, 0xaf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf2, 0xaf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf2, 0xaf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf2, 0xaf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf2, 0xaf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf2,
-    0xaf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf2, 0xaf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf2, 0xaf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf2, 0xaf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf2, 0xaf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf2, 0xaf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf2, 0xaf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf2, 0xaf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf2,
-    0xaf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf2, 0xaf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf2, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf2, 0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xf2, 0x5f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf2, 0x1f,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2d, 0xff,
-    0xff, 0xf2, 0xb, 0xff, 0xff, 0xe4, 0x0, 0x0,
-    0x27, 0xef, 0xff, 0xff, 0xf2, 0x3, 0xff, 0xff,
-    0xff, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x9f, 0xff, 0xf2, 0x0, 0x5, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xc2, 0x4f, 0xff, 0xf2, 0x0, 0x0,
-    0x6, 0xbe, 0xff, 0xec, 0x94, 0x0, 0x3f, 0xff,
-    0xf2,
-
-    /* U+0076 "v" */
-    0xf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf2, 0xa, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xc0,
-    0x4, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x60, 0x0, 0xef, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x10,
-    0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xfb, 0x0, 0x0, 0x3f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0,
-    0x0, 0xe, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf0, 0x0, 0x0, 0x8, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xa0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x80, 0x0, 0x0, 0x5, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xd0, 0x0, 0x0, 0xa,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf2, 0x0, 0x0, 0xf, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf8, 0x0, 0x0, 0x4f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xfd, 0x0, 0x0, 0x9f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x20, 0x0, 0xef,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0x70, 0x3, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xc0, 0x8, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf1, 0xd, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf7, 0x2f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xfc, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xef, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf4, 0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf0, 0x3f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xb0, 0xf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x60,
-    0xa, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x20, 0x6, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xfd, 0x0, 0x1, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf8, 0x0, 0x0, 0xdf,
-    0xff, 0x80, 0x0, 0x0, 0x6, 0xff, 0xf7, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf4, 0x0,
-    0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0, 0xb, 0xff,
-    0xf1, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x3f, 0xff,
-    0xf0, 0x0, 0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0,
-    0xf, 0xff, 0xc0, 0x7f, 0xff, 0x70, 0x0, 0x0,
-    0x7f, 0xff, 0xb0, 0x0, 0x0, 0xf, 0xff, 0xf4,
-    0x0, 0x0, 0x5f, 0xff, 0x70, 0x2f, 0xff, 0xc0,
-    0x0, 0x0, 0xbf, 0xff, 0x60, 0x0, 0x0, 0xb,
-    0xff, 0xf8, 0x0, 0x0, 0xaf, 0xff, 0x20, 0xd,
-    0xff, 0xf1, 0x0, 0x0, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x6, 0xff, 0xfd, 0x0, 0x0, 0xef, 0xfd,
-    0x0, 0x8, 0xff, 0xf6, 0x0, 0x3, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x10, 0x3,
-    0xff, 0xf8, 0x0, 0x3, 0xff, 0xfb, 0x0, 0x7,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x50, 0x8, 0xff, 0xf3, 0x0, 0x0, 0xef, 0xff,
-    0x0, 0xb, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x90, 0xd, 0xff, 0xe0, 0x0, 0x0,
-    0x9f, 0xff, 0x40, 0xf, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xd0, 0x2f, 0xff, 0x90,
-    0x0, 0x0, 0x4f, 0xff, 0x90, 0x3f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf1, 0x7f,
-    0xff, 0x50, 0x0, 0x0, 0xe, 0xff, 0xe0, 0x7f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf5, 0xcf, 0xff, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf3, 0xbf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xfb, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xf8, 0xef, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x6f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x20, 0xcf, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x70, 0x2,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xc0, 0x0, 0x7, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xf3, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x9f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-    0x3f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf6, 0x0, 0xc, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xe1, 0x6, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x91, 0xef, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xbf, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfe, 0x4f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x60, 0xaf, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xc0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xf3, 0x0, 0x7, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf9, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0x20, 0x0, 0x0, 0x1f, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xf6, 0x0, 0x5, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf1, 0x1,
-    0xef, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xb0, 0xaf, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x60,
-
-    /* U+0079 "y" */
-    0x4f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xd0, 0xe, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x80,
-    0x9, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x30, 0x3, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x0,
-    0x0, 0xdf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x8f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0,
-    0x0, 0x2f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xd0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x40, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0xf,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf4, 0x0, 0x0, 0x5f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf9, 0x0, 0x0, 0xaf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xfe, 0x0, 0x0, 0xef, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x4, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x90, 0x9, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0, 0xd, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf4, 0x2f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf9, 0x7f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xfe, 0xcf, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3d, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x77, 0x9c, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x76, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x7b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xcf, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa1,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9e, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xd2,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x3a, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0x39, 0xcf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xfd, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0x60,
-
-    /* U+007C "|" */
-    0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff,
-    0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff,
-    0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff,
-    0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff,
-    0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff,
-    0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff,
-    0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff,
-    0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff,
-    0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff,
-    0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff,
-    0xbf, 0xff, 0xbf, 0xff, 0x58, 0x87,
-
-    /* U+007D "}" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xbf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc3,
-    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xa4, 0x10,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x4e, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x0, 0x28, 0xce, 0xdc, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x55, 0x53, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfa, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xf8, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf5,
-    0xe, 0xff, 0xfd, 0x40, 0x15, 0xdf, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x3f, 0xff, 0xf0, 0x4f, 0xff,
-    0xe1, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfa, 0x20,
-    0x5, 0xef, 0xff, 0x80, 0x9f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0xef, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
-    0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x22, 0x22,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xdf,
-    0xfc, 0x70, 0x0, 0x0,
-
     /* U+05D0 "א" */
     0xd, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0xa, 0xff, 0xff, 0x70, 0x3f, 0xff,
@@ -4605,179 +72,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xff, 0x80, 0x4, 0xff, 0xff, 0x20, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x40,
 
-    /* U+05D1 "ב" */
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xed, 0xb7, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x9, 0xaa,
-    0xaa, 0xaa, 0xab, 0xef, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2a, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xa0, 0x0,
-    0x6, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbf, 0xff, 0xff, 0xa9, 0x80, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20,
-
-    /* U+05D2 "ג" */
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xaa, 0xaa, 0xaa,
-    0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf8, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc3, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x50, 0xff, 0xff, 0x30,
-    0x13, 0x45, 0x9e, 0xff, 0xfc, 0x0, 0xdf, 0xff,
-    0x60, 0x8f, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x9f,
-    0xff, 0xa0, 0x8f, 0xff, 0xff, 0xfd, 0x20, 0x0,
-    0x6f, 0xff, 0xd0, 0x8f, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x3f, 0xff, 0xf0, 0x8f, 0xfd, 0x93, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf4,
-
-    /* U+05D3 "ד" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x5a, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xea, 0xaa, 0xa4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x0, 0x0,
-
-    /* U+05D4 "ה" */
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xb7,
-    0x20, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x4, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xab, 0xef, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xb0, 0x3e, 0xee,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xfb, 0x9, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xb0, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb,
-    0x2f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xb4, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x5f,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xb5, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x5f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xb5, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xfb, 0x5f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xb5, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfb, 0x5f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xb5,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xfb, 0x5f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xb5, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xfb, 0x5f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xb0,
-
     /* U+05D5 "ו" */
     0x9f, 0xff, 0xff, 0xff, 0x59, 0xff, 0xff, 0xff,
     0xf5, 0x9f, 0xff, 0xff, 0xff, 0x55, 0xaa, 0xbf,
@@ -4797,127 +91,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xff, 0x50, 0x0, 0x3f, 0xff, 0xf5, 0x0, 0x3,
     0xff, 0xff, 0x50,
 
-    /* U+05D6 "ז" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x9c,
-    0xff, 0xff, 0xca, 0xaa, 0xaa, 0xa8, 0x0, 0xf,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5,
-    0x0, 0x0,
-
-    /* U+05D7 "ח" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xb7,
-    0x30, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x9, 0xff, 0xff, 0xaa, 0xaa, 0xaa,
-    0xab, 0xdf, 0xff, 0xff, 0xf5, 0x0, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff,
-    0xf1, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x90, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf3, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x69,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf7, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x99, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf9, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x99, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf9, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x99, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf9,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x99, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf9, 0x9f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x99, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf9, 0x9f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x99, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf9, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x99, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf9, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x99,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf9, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x99, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf9, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x90,
-
-    /* U+05D8 "ט" */
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x5a, 0xdf,
-    0xfe, 0xa3, 0x0, 0x0, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0xe, 0xff, 0xdd, 0xff, 0xff, 0xff, 0x40,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x7, 0x40, 0x0,
-    0x2c, 0xff, 0xff, 0xb0, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf0,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf3, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf5, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf6,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf6, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf6,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf6, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf6,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf6, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf6,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf6, 0x9f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf5,
-    0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf5, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4,
-    0x5f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf2, 0x1f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
-    0xc, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x90, 0x5, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x30,
-    0x0, 0xcf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x1,
-    0xcf, 0xff, 0xfa, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xe8, 0x32, 0x24, 0x9f, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x2c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff, 0xff,
-    0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x14, 0x67, 0x76, 0x40, 0x0, 0x0, 0x0, 0x0,
-
     /* U+05D9 "י" */
     0xaf, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff,
     0xff, 0xff, 0xf2, 0xaf, 0xff, 0xff, 0xff, 0xff,
@@ -4932,101 +105,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xff, 0xff, 0x20, 0x0, 0x0, 0x6f, 0xff, 0xf2,
     0x0, 0x0, 0x0, 0x22, 0x22, 0x0,
 
-    /* U+05DA "ך" */
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x4a, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5,
-
-    /* U+05DB "כ" */
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
-    0xff, 0xfa, 0x0, 0x7, 0xfc, 0x96, 0x43, 0x22,
-    0x47, 0xbf, 0xff, 0xff, 0xd1, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa1, 0x0, 0x0, 0x5, 0x9d, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xa3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x56, 0x77, 0x75, 0x20, 0x0, 0x0,
-    0x0, 0x0,
-
     /* U+05DC "ל" */
     0x78, 0x88, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0,
@@ -5128,482 +206,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
     0xff, 0xff, 0xff, 0xf5,
 
-    /* U+05DE "מ" */
-    0x0, 0x0, 0x0, 0x0, 0x24, 0x67, 0x77, 0x65,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xad,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x0,
-    0x0, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x3f, 0xff, 0xfe, 0xdf, 0xff, 0xfd,
-    0x75, 0x68, 0xcf, 0xff, 0xff, 0x90, 0x0, 0xeb,
-    0x61, 0x1d, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x4e,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xb, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0,
-    0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf3, 0x0, 0x0, 0xcf, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x70, 0x0, 0x2f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xfb, 0x0, 0x6, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xd0, 0x0, 0x9f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x0, 0xb,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xf0, 0x0, 0xdf, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf0, 0x1, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x3f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf0, 0x5, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x9, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x0, 0xbf, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0xd,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0xef, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0,
-    0xf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x2, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf0, 0x4f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x6, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x8, 0xaa, 0xaa, 0xaa, 0xdf,
-    0xff, 0xf0, 0x8f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xcf, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+05DF "ן" */
-    0xef, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xff, 0x9a, 0xad, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x8, 0xff, 0xff,
-
-    /* U+05E0 "נ" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x4, 0xaa, 0xaa, 0xaf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x43, 0x75, 0x44, 0x6d, 0xff, 0xff,
-    0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xe6, 0x0, 0x0, 0x25, 0x67, 0x76,
-    0x30, 0x0, 0x0,
-
-    /* U+05E1 "ס" */
-    0x0, 0x0, 0x0, 0x0, 0x24, 0x56, 0x77, 0x76,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x59,
-    0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x50,
-    0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0xe, 0xff,
-    0xfc, 0xef, 0xff, 0xfc, 0x75, 0x57, 0xaf, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x88, 0x30, 0x8f, 0xff,
-    0xe5, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x1f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x40, 0x0, 0x9, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xfa, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf0, 0x0,
-    0x5f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x20, 0x8, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf5, 0x0, 0xbf, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x60,
-    0xc, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf7, 0x0, 0xdf, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x70, 0xd, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf7,
-    0x0, 0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0xd, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf7, 0x0, 0xcf, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x60, 0xa, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf5, 0x0, 0x8f,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x20, 0x4, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xe0, 0x0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfa, 0x0, 0x0,
-    0x9f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x40, 0x0, 0x2, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x1a, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xfd, 0x86, 0x56, 0xaf,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x9e, 0xff, 0xff, 0xff,
-    0xfd, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x57, 0x76, 0x52, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+05E2 "ע" */
-    0x0, 0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x9f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x6f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x2f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0xe, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0xb, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x4, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0xdf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x5f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0xe, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0xa, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf8, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xfd, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x20,
-    0x7, 0x93, 0x0, 0x0, 0xdf, 0xff, 0x20, 0x6,
-    0xff, 0xff, 0xf8, 0x0, 0xd, 0xff, 0xea, 0x63,
-    0x4f, 0xff, 0xe7, 0xdf, 0xff, 0xff, 0xb0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x27, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14,
-    0x67, 0x77, 0x64, 0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+05E3 "ף" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x45, 0xaa, 0xaf, 0xff, 0xea, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xbf, 0xff, 0xf4, 0x0, 0x8,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x40, 0x0, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf4, 0x0, 0x5f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x40, 0xa, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf4, 0x0, 0xef, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x40,
-    0x1f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf4, 0x3, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x40, 0x4f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf4, 0x5, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x40, 0x5f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf4, 0x5, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x40, 0x4f, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x40, 0x1b, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4, 0x0,
-    0x2, 0x7b, 0xde, 0xff, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x40,
-
-    /* U+05E4 "פ" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x5a, 0xab, 0xff, 0xfe,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xad, 0xff, 0xfe,
-    0x0, 0x8, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
-    0x0, 0x5f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfe, 0x0, 0xbf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
-    0x0, 0xef, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
-    0x3, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfe, 0x4, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
-    0x5, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfe, 0x5, 0xff, 0xff, 0x61,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfe, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
-    0x1, 0xaf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfe, 0x0, 0x1, 0x69, 0xcd,
-    0xed, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x80,
-    0x0, 0x25, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xbf, 0xff, 0xfe, 0x10, 0x0, 0x8f, 0xfe, 0xb8,
-    0x65, 0x44, 0x58, 0xcf, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0, 0x0,
-    0x0, 0x5, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x56, 0x77, 0x75, 0x30, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+05E5 "ץ" */
-    0x3f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0x60, 0x8f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xd0, 0x0, 0xdf, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xf4, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xfb, 0x0, 0x0, 0x7, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x20, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfc,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xf6, 0x0, 0x0, 0x8f,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf2, 0x0, 0x1f, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xb0, 0xa,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x63, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfe,
-    0xdf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+05E6 "צ" */
-    0x3f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0x60, 0x8f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xd0, 0x0, 0xdf, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xf4, 0x0, 0x3, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xfb, 0x0, 0x0, 0x8, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x20, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xf7, 0x0, 0x0, 0x8f,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf2, 0x0, 0x1f, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xc0, 0x9,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x62, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xdf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfe, 0x10,
-    0x0, 0x8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xdf, 0xff, 0xfa, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0,
-
-    /* U+05E7 "ק" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xaa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaf, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfa, 0x0, 0xef, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xa0, 0x6f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfa, 0xb, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xa0, 0xef, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfa,
-    0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xa0, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfa, 0x1f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x91, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf7, 0x1f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0x41, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xe0, 0x1f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0x1, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x10, 0x1f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x3, 0xbf, 0xff, 0xff, 0x50, 0x1,
-    0xff, 0xff, 0x50, 0x0, 0x8, 0xae, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0x60, 0x0, 0x1, 0xff,
-    0xff, 0x50, 0x0, 0xe, 0xff, 0xff, 0xfa, 0x10,
-    0x0, 0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0xee,
-    0xda, 0x61, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
     /* U+05E8 "ר" */
     0x8f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc9, 0x40,
     0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
@@ -5704,59 +306,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xff, 0xff, 0xea, 0x40, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x56, 0x77,
     0x65, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+05EA "ת" */
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xda, 0x72, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x2a, 0xaa, 0xaa, 0xff, 0xff,
-    0xaa, 0xaa, 0xab, 0xef, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x2, 0xaf, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf8, 0x0, 0x0, 0xa, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x7f, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0xac, 0xdf,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0xcf, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf8, 0xcf, 0xff, 0xff, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0xcf, 0xff, 0xea, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf8
 };
 
 
@@ -5767,145 +316,29 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 198, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 207, .box_w = 7, .box_h = 36, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 126, .adv_w = 257, .box_w = 11, .box_h = 13, .ofs_x = 3, .ofs_y = 26},
-    {.bitmap_index = 198, .adv_w = 493, .box_w = 29, .box_h = 36, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 720, .adv_w = 450, .box_w = 24, .box_h = 47, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 1284, .adv_w = 586, .box_w = 33, .box_h = 36, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1878, .adv_w = 498, .box_w = 29, .box_h = 36, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2400, .adv_w = 140, .box_w = 5, .box_h = 12, .ofs_x = 2, .ofs_y = 26},
-    {.bitmap_index = 2430, .adv_w = 274, .box_w = 14, .box_h = 53, .ofs_x = 3, .ofs_y = -12},
-    {.bitmap_index = 2801, .adv_w = 279, .box_w = 14, .box_h = 53, .ofs_x = 0, .ofs_y = -12},
-    {.bitmap_index = 3172, .adv_w = 345, .box_w = 21, .box_h = 21, .ofs_x = 0, .ofs_y = 15},
-    {.bitmap_index = 3393, .adv_w = 430, .box_w = 25, .box_h = 27, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 3731, .adv_w = 157, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 3783, .adv_w = 221, .box_w = 13, .box_h = 4, .ofs_x = 0, .ofs_y = 13},
-    {.bitmap_index = 3809, .adv_w = 211, .box_w = 7, .box_h = 6, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 3830, .adv_w = 330, .box_w = 20, .box_h = 39, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 4220, .adv_w = 450, .box_w = 24, .box_h = 36, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4652, .adv_w = 450, .box_w = 14, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 4904, .adv_w = 450, .box_w = 25, .box_h = 36, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5354, .adv_w = 450, .box_w = 23, .box_h = 36, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5768, .adv_w = 450, .box_w = 26, .box_h = 36, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6236, .adv_w = 450, .box_w = 24, .box_h = 36, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6668, .adv_w = 450, .box_w = 23, .box_h = 36, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7082, .adv_w = 450, .box_w = 25, .box_h = 36, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7532, .adv_w = 450, .box_w = 24, .box_h = 36, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7964, .adv_w = 450, .box_w = 23, .box_h = 36, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8378, .adv_w = 195, .box_w = 6, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 8459, .adv_w = 170, .box_w = 8, .box_h = 34, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 8595, .adv_w = 430, .box_w = 21, .box_h = 23, .ofs_x = 3, .ofs_y = 4},
-    {.bitmap_index = 8837, .adv_w = 430, .box_w = 21, .box_h = 14, .ofs_x = 3, .ofs_y = 10},
-    {.bitmap_index = 8984, .adv_w = 430, .box_w = 21, .box_h = 23, .ofs_x = 3, .ofs_y = 4},
-    {.bitmap_index = 9226, .adv_w = 379, .box_w = 21, .box_h = 36, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9604, .adv_w = 718, .box_w = 41, .box_h = 47, .ofs_x = 2, .ofs_y = -11},
-    {.bitmap_index = 10568, .adv_w = 523, .box_w = 32, .box_h = 36, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11144, .adv_w = 498, .box_w = 25, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 11594, .adv_w = 521, .box_w = 29, .box_h = 36, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12116, .adv_w = 525, .box_w = 26, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 12584, .adv_w = 455, .box_w = 23, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 12998, .adv_w = 442, .box_w = 23, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 13412, .adv_w = 545, .box_w = 29, .box_h = 36, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13934, .adv_w = 571, .box_w = 28, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 14438, .adv_w = 218, .box_w = 6, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 14546, .adv_w = 441, .box_w = 23, .box_h = 36, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14960, .adv_w = 502, .box_w = 28, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 15464, .adv_w = 431, .box_w = 22, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 15860, .adv_w = 699, .box_w = 36, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 16508, .adv_w = 571, .box_w = 28, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 17012, .adv_w = 551, .box_w = 30, .box_h = 36, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17552, .adv_w = 505, .box_w = 26, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 18020, .adv_w = 551, .box_w = 30, .box_h = 42, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 18650, .adv_w = 493, .box_w = 26, .box_h = 36, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 19118, .adv_w = 475, .box_w = 27, .box_h = 36, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19604, .adv_w = 477, .box_w = 28, .box_h = 36, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20108, .adv_w = 519, .box_w = 27, .box_h = 36, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 20594, .adv_w = 510, .box_w = 32, .box_h = 36, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21170, .adv_w = 710, .box_w = 43, .box_h = 36, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 21944, .adv_w = 502, .box_w = 30, .box_h = 36, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22484, .adv_w = 480, .box_w = 30, .box_h = 36, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23024, .adv_w = 479, .box_w = 26, .box_h = 36, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 23492, .adv_w = 213, .box_w = 10, .box_h = 49, .ofs_x = 3, .ofs_y = -8},
-    {.bitmap_index = 23737, .adv_w = 329, .box_w = 20, .box_h = 39, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 24127, .adv_w = 213, .box_w = 10, .box_h = 49, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 24372, .adv_w = 430, .box_w = 19, .box_h = 18, .ofs_x = 4, .ofs_y = 18},
-    {.bitmap_index = 24543, .adv_w = 361, .box_w = 23, .box_h = 4, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 24589, .adv_w = 242, .box_w = 11, .box_h = 7, .ofs_x = 2, .ofs_y = 30},
-    {.bitmap_index = 24628, .adv_w = 436, .box_w = 23, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 24939, .adv_w = 449, .box_w = 23, .box_h = 38, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 25376, .adv_w = 419, .box_w = 23, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 25687, .adv_w = 452, .box_w = 23, .box_h = 38, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 26124, .adv_w = 425, .box_w = 23, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 26435, .adv_w = 278, .box_w = 17, .box_h = 38, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 26758, .adv_w = 449, .box_w = 23, .box_h = 38, .ofs_x = 2, .ofs_y = -11},
-    {.bitmap_index = 27195, .adv_w = 441, .box_w = 22, .box_h = 38, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 27613, .adv_w = 200, .box_w = 6, .box_h = 36, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 27721, .adv_w = 196, .box_w = 11, .box_h = 46, .ofs_x = -2, .ofs_y = -11},
-    {.bitmap_index = 27974, .adv_w = 406, .box_w = 23, .box_h = 38, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 28411, .adv_w = 195, .box_w = 6, .box_h = 38, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 28525, .adv_w = 701, .box_w = 38, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 29038, .adv_w = 442, .box_w = 22, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 29335, .adv_w = 457, .box_w = 25, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 29673, .adv_w = 449, .box_w = 23, .box_h = 37, .ofs_x = 3, .ofs_y = -10},
-    {.bitmap_index = 30099, .adv_w = 455, .box_w = 23, .box_h = 37, .ofs_x = 2, .ofs_y = -10},
-    {.bitmap_index = 30525, .adv_w = 271, .box_w = 14, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 30714, .adv_w = 413, .box_w = 22, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 31011, .adv_w = 262, .box_w = 15, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 31266, .adv_w = 441, .box_w = 22, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 31563, .adv_w = 388, .box_w = 24, .box_h = 27, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 31887, .adv_w = 601, .box_w = 36, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 32373, .adv_w = 397, .box_w = 23, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 32684, .adv_w = 379, .box_w = 24, .box_h = 38, .ofs_x = 0, .ofs_y = -11},
-    {.bitmap_index = 33140, .adv_w = 397, .box_w = 22, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 33437, .adv_w = 271, .box_w = 16, .box_h = 49, .ofs_x = 1, .ofs_y = -9},
-    {.bitmap_index = 33829, .adv_w = 196, .box_w = 4, .box_h = 43, .ofs_x = 4, .ofs_y = -7},
-    {.bitmap_index = 33915, .adv_w = 271, .box_w = 16, .box_h = 50, .ofs_x = 0, .ofs_y = -10},
-    {.bitmap_index = 34315, .adv_w = 508, .box_w = 28, .box_h = 10, .ofs_x = 2, .ofs_y = 10},
-    {.bitmap_index = 34455, .adv_w = 513, .box_w = 27, .box_h = 29, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 34847, .adv_w = 421, .box_w = 25, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 35210, .adv_w = 309, .box_w = 18, .box_h = 29, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 35471, .adv_w = 417, .box_w = 24, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 35819, .adv_w = 470, .box_w = 23, .box_h = 29, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 36153, .adv_w = 236, .box_w = 9, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 36284, .adv_w = 283, .box_w = 15, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 36502, .adv_w = 486, .box_w = 23, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 36836, .adv_w = 493, .box_w = 24, .box_h = 30, .ofs_x = 4, .ofs_y = -1},
-    {.bitmap_index = 37196, .adv_w = 241, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 37290, .adv_w = 396, .box_w = 20, .box_h = 39, .ofs_x = 1, .ofs_y = -10},
-    {.bitmap_index = 37680, .adv_w = 430, .box_w = 22, .box_h = 30, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 38010, .adv_w = 411, .box_w = 22, .box_h = 38, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 38428, .adv_w = 508, .box_w = 24, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 38776, .adv_w = 507, .box_w = 25, .box_h = 30, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 39151, .adv_w = 230, .box_w = 8, .box_h = 39, .ofs_x = 2, .ofs_y = -10},
-    {.bitmap_index = 39307, .adv_w = 290, .box_w = 13, .box_h = 30, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 39502, .adv_w = 510, .box_w = 27, .box_h = 31, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 39921, .adv_w = 463, .box_w = 24, .box_h = 30, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 40281, .adv_w = 475, .box_w = 23, .box_h = 39, .ofs_x = 3, .ofs_y = -10},
-    {.bitmap_index = 40730, .adv_w = 502, .box_w = 24, .box_h = 30, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 41090, .adv_w = 428, .box_w = 25, .box_h = 39, .ofs_x = 1, .ofs_y = -10},
-    {.bitmap_index = 41578, .adv_w = 437, .box_w = 25, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 41941, .adv_w = 497, .box_w = 23, .box_h = 39, .ofs_x = 4, .ofs_y = -10},
-    {.bitmap_index = 42390, .adv_w = 393, .box_w = 20, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 42680, .adv_w = 635, .box_w = 32, .box_h = 30, .ofs_x = 4, .ofs_y = -1},
-    {.bitmap_index = 43160, .adv_w = 500, .box_w = 28, .box_h = 29, .ofs_x = 0, .ofs_y = 0}
+    {.bitmap_index = 0, .adv_w = 513, .box_w = 27, .box_h = 29, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 392, .adv_w = 236, .box_w = 9, .box_h = 29, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 523, .adv_w = 241, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 12},
+    {.bitmap_index = 617, .adv_w = 411, .box_w = 22, .box_h = 38, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1035, .adv_w = 508, .box_w = 24, .box_h = 29, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 1383, .adv_w = 393, .box_w = 20, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1673, .adv_w = 635, .box_w = 32, .box_h = 30, .ofs_x = 4, .ofs_y = -1}
 };
 
 /*---------------------
  *  CHARACTER MAPPING
  *--------------------*/
 
-
+static const uint16_t unicode_list_0[] = {
+    0x0, 0x5b0, 0x5b5, 0x5b9, 0x5bc, 0x5bd, 0x5c8, 0x5c9,
+};
 
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 1488, .range_length = 27, .glyph_id_start = 96,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+        .range_start = 32, .range_length = 1482, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 8, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
@@ -5914,29 +347,7 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
  *----------------*/
 
 
-/*Pair left and right glyphs for kerning*/
-static const uint8_t kern_pair_glyph_ids[] =
-{
-    8, 8,
-    15, 8,
-    16, 16
-};
-
-/* Kerning between the respective left and right glyphs
- * 4.4 format which needs to scaled with `kern_scale`*/
-static const int8_t kern_pair_values[] =
-{
-    -17, -107, -96
-};
-
-/*Collect the kern pair's data in one place*/
-static const lv_font_fmt_txt_kern_pair_t kern_pairs =
-{
-    .glyph_ids = kern_pair_glyph_ids,
-    .values = kern_pair_values,
-    .pair_cnt = 3,
-    .glyph_ids_size = 0
-};
+/*No kerning pair between the kept glyphs*/
 
 /*--------------------
  *  ALL CUSTOM DATA
@@ -5955,9 +366,9 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .glyph_bitmap = glyph_bitmap,
     .glyph_dsc = glyph_dsc,
     .cmaps = cmaps,
-    .kern_dsc = &kern_pairs,
+    .kern_dsc = NULL,
     .kern_scale = 16,
-    .cmap_num = 2,
+    .cmap_num = 1,
     .bpp = 4,
     .kern_classes = 0,
     .bitmap_format = 0,
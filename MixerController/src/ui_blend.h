@@ -0,0 +1,49 @@
+#pragma once
+
+/*
+ * Word-wide RGB565 fill kernels for the LVGL software renderer
+ *
+ * Most blends of this UI are solid fills: opaque, with opacity, through an
+ * anti-aliasing / ALPHA_8BIT image mask, or both. LVGL 8.4 (lv_draw_sw_blend.c)
+ * reads and writes those one pixel at a time. The kernels move a machine word
+ * of pixels / mask bytes at a time. ui_blend() replaces the blend callback of
+ * the draw context and runs only the fill with opacity through a kernel, the
+ * one case LVGL is slow at (~27x on word32). Opaque and masked fills, images,
+ * blend modes and set_px_cb go to lv_draw_sw_blend_basic().
+ *
+ * The firmware compiles only the word32 fill_opa kernel. UI_BLEND_ALL_KERNELS
+ * (UiBench) adds the other fill cases, the word64 table and ui_blend_fill(),
+ * which runs every case through a kernel. UiBench -k checks them all bit-exact
+ * against lv_draw_sw_blend_basic() and times both.
+ */
+
+#include <lvgl.h>
+#include <src/draw/sw/lv_draw_sw.h>
+
+// One kernel per fill case, dest / mask point at the first pixel, strides in pixels / bytes.
+// Without UI_BLEND_ALL_KERNELS only fill_opa is set.
+struct UiBlendKernels {
+    const char *name;
+    void (*fill)(lv_color_t *dest, lv_coord_t dest_stride, int32_t w, int32_t h, lv_color_t color);
+    void (*fill_opa)(lv_color_t *dest, lv_coord_t dest_stride, int32_t w, int32_t h, lv_color_t color,
+                     lv_opa_t opa);
+    void (*fill_mask)(lv_color_t *dest, lv_coord_t dest_stride, int32_t w, int32_t h, lv_color_t color,
+                      const lv_opa_t *mask, lv_coord_t mask_stride);
+    void (*fill_mask_opa)(lv_color_t *dest, lv_coord_t dest_stride, int32_t w, int32_t h, lv_color_t color,
+                          lv_opa_t opa, const lv_opa_t *mask, lv_coord_t mask_stride);
+};
+
+extern const UiBlendKernels ui_blend_word32;    // 2 px / 4 mask bytes per access (ESP32-S3)
+#ifdef UI_BLEND_ALL_KERNELS
+extern const UiBlendKernels ui_blend_word64;    // 4 px / 8 mask bytes per access (64-bit hosts)
+#endif
+
+// Hook `disp` (LVGL software renderer) up to ui_blend() with `kernels`,
+// nullptr: the table for this CPU's word size (word32 without UI_BLEND_ALL_KERNELS)
+void ui_blend_install(lv_disp_t *disp, const UiBlendKernels *kernels = nullptr);
+const UiBlendKernels *ui_blend_kernels();
+
+void ui_blend(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc);
+#ifdef UI_BLEND_ALL_KERNELS
+void ui_blend_fill(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc);   // Every fill case, UiBench -k
+#endif
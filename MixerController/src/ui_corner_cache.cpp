@@ -0,0 +1,364 @@
+#include "ui_corner_cache.h"
+#include <src/draw/sw/lv_draw_sw.h>
+#include <src/misc/lv_gc.h>
+#include <stdlib.h>
+#include <string.h>
+
+// One corner shape: row cy is LVGL's circle row (0: the row where the corner
+// meets the straight edge, radius - 1: the top / bottom row of the shape)
+struct CornerSlot {
+    lv_coord_t radius;          // 0: free
+    uint32_t used;              // Last use, for eviction
+    uint8_t *len;               // Per row cy: pixels from the side edge the mask writes (malloc)
+    uint8_t *quad[4];           // Coverage of the corner blocks, radius x radius, in screen order
+};
+
+enum { TOP_LEFT, TOP_RIGHT, BOTTOM_LEFT, BOTTOM_RIGHT };
+
+// A radius mask of the mask stack, or the background's own
+struct RoundMask {
+    lv_area_t rect;
+    lv_coord_t radius;
+    const CornerSlot *corner;   // nullptr for radius 0
+};
+
+static CornerSlot slots[UI_CORNER_CACHE_SLOTS];
+static size_t cache_bytes = 0;
+static uint32_t use_clock = 0;
+static UiCornerCacheStats stats = {};
+
+static size_t corner_bytes(lv_coord_t radius)
+{
+    return (size_t)radius + 4 * (size_t)radius * radius;
+}
+
+static void corner_free(CornerSlot &slot)
+{
+    free(slot.len);
+    cache_bytes -= corner_bytes(slot.radius);
+    slot = {};
+}
+
+// lv_draw_mask.c mask_mix(): the coverage of a mask applied to the mask buffer
+static inline lv_opa_t mask_mix(lv_opa_t mask_act, lv_opa_t mask_new)
+{
+    if (mask_new >= LV_OPA_MAX) return mask_act;
+    if (mask_new <= LV_OPA_MIN) return 0;
+    return LV_UDIV255(mask_act * mask_new);
+}
+
+// The corner of `radius`, nullptr if it can't be cached: heap full, or no room
+// without evicting a corner used since `since` (by the rectangle being drawn)
+static const CornerSlot *corner_get(lv_coord_t radius, uint32_t since)
+{
+    for (CornerSlot &slot : slots) {
+        if (slot.radius == radius) {
+            slot.used = ++use_clock;
+            stats.hits++;
+            return &slot;
+        }
+    }
+
+    // Miss: make room, least recently used corners first
+    size_t size = corner_bytes(radius);
+    CornerSlot *slot;
+    for (;;) {
+        CornerSlot *lru = nullptr;
+        slot = nullptr;
+        for (CornerSlot &s : slots) {
+            if (!s.radius) slot = &s;
+            else if (!lru || s.used < lru->used) lru = &s;
+        }
+        if (slot && cache_bytes + size <= UI_CORNER_CACHE_BYTES) break;
+        if (!lru || lru->used > since) return nullptr;
+        corner_free(*lru);
+    }
+    uint8_t *data = (uint8_t *)malloc(size);
+    if (!data) return nullptr;
+    cache_bytes += size;
+    *slot = { radius, ++use_clock, data, { nullptr } };
+    for (int q = 0; q < 4; q++) slot->quad[q] = data + radius + q * radius * radius;
+    stats.misses++;
+
+    // LVGL's radius mask on a 2r x 2r square, one row at a time. A row of 0xFF
+    // gives the coverage; a row of 1 (mask_mix() makes it 0) which pixels it writes.
+    lv_area_t square = { 0, 0, (lv_coord_t)(2 * radius - 1), (lv_coord_t)(2 * radius - 1) };
+    lv_draw_mask_radius_param_t param;
+    lv_draw_mask_radius_init(&param, &square, radius, false);
+    lv_opa_t *row = (lv_opa_t *)lv_mem_buf_get(2 * radius);
+    lv_opa_t *written = (lv_opa_t *)lv_mem_buf_get(2 * radius);
+    for (lv_coord_t cy = 0; cy < radius; cy++) {
+        lv_memset(row, LV_OPA_COVER, 2 * radius);
+        lv_memset(written, 1, 2 * radius);
+        param.dsc.cb(row, 0, radius - 1 - cy, 2 * radius, &param);
+        param.dsc.cb(written, 0, radius - 1 - cy, 2 * radius, &param);
+        uint8_t len = 0;
+        for (lv_coord_t i = 0; i < radius; i++) {
+            if (written[i] != 1) len = i + 1;
+        }
+        slot->len[cy] = len;
+        // row[] is the top row cy of the square: left corner, then the right one
+        memcpy(slot->quad[TOP_LEFT] + (radius - 1 - cy) * radius, row, radius);
+        memcpy(slot->quad[TOP_RIGHT] + (radius - 1 - cy) * radius, row + radius, radius);
+        memcpy(slot->quad[BOTTOM_LEFT] + cy * radius, row, radius);
+        memcpy(slot->quad[BOTTOM_RIGHT] + cy * radius, row + radius, radius);
+    }
+    lv_mem_buf_release(written);
+    lv_mem_buf_release(row);
+    lv_draw_mask_free_param(&param);
+    return slot;
+}
+
+// Circle row of `m` at `y`, -1 between the corners
+static inline int32_t corner_row(const RoundMask &m, lv_coord_t y)
+{
+    if (!m.radius) return -1;
+    int32_t dy = y - m.rect.y1;
+    int32_t h = lv_area_get_height(&m.rect);
+    if (dy < m.radius) return m.radius - 1 - dy;
+    if (dy >= h - m.radius) return dy - (h - m.radius);
+    return -1;
+}
+
+// What the masks leave of row `y` in [lo, hi]: nothing (false), or [lo, hi] with
+// the corner pixels in [lo, left] and [right, hi]
+static bool row_spans(const RoundMask *masks, int n, lv_coord_t y, lv_coord_t &lo, lv_coord_t &hi,
+                      lv_coord_t &left, lv_coord_t &right)
+{
+    left = lo - 1;
+    right = hi + 1;
+    for (int i = 0; i < n; i++) {
+        const RoundMask &m = masks[i];
+        if (y < m.rect.y1 || y > m.rect.y2) return false;
+        lo = LV_MAX(lo, m.rect.x1);
+        hi = LV_MIN(hi, m.rect.x2);
+        int32_t cy = corner_row(m, y);
+        if (cy < 0) continue;
+        int32_t len = m.corner->len[cy];
+        left = LV_MAX(left, m.rect.x1 + len - 1);
+        right = LV_MIN(right, m.rect.x2 - len + 1);
+    }
+    left = LV_MIN(left, hi);
+    right = LV_MAX(right, lo);
+    return lo <= hi;
+}
+
+// The mask LVGL computes for [a, b] of row `y` (inside every mask's rect): opa, then
+// every mask in stack order
+static void row_mask(lv_opa_t *buf, lv_coord_t a, lv_coord_t b, lv_opa_t opa, const RoundMask *masks, int n,
+                     lv_coord_t y)
+{
+    lv_memset(buf, opa, b - a + 1);
+    for (int k = 0; k < n; k++) {
+        const RoundMask &m = masks[k];
+        int32_t cy = corner_row(m, y);
+        if (cy < 0) continue;
+        const uint8_t *cov = m.corner->quad[TOP_LEFT] + (m.radius - 1 - cy) * m.radius;
+        int32_t len = m.corner->len[cy];
+        for (int32_t i = LV_MAX(0, a - m.rect.x1); i < len && m.rect.x1 + i <= b; i++) {
+            lv_opa_t *p = &buf[m.rect.x1 + i - a];
+            *p = mask_mix(cov[i], *p);
+        }
+        for (int32_t i = LV_MAX(0, m.rect.x2 - b); i < len && m.rect.x2 - i >= a; i++) {
+            lv_opa_t *p = &buf[m.rect.x2 - i - a];
+            *p = mask_mix(cov[i], *p);
+        }
+    }
+}
+
+// lv_draw_sw_rect.c draw_bg() for a solid color under radius masks only; false: LVGL draws it
+static bool draw_bg(lv_draw_ctx_t *draw_ctx, const lv_draw_rect_dsc_t *dsc, const lv_area_t *coords)
+{
+    if (dsc->bg_opa <= LV_OPA_MIN) return false;
+
+    lv_area_t bg_coords;
+    lv_area_copy(&bg_coords, coords);
+    if (dsc->border_width > 1 && dsc->border_opa >= LV_OPA_MAX && dsc->radius != 0) {
+        bg_coords.x1 += (dsc->border_side & LV_BORDER_SIDE_LEFT) ? 1 : 0;
+        bg_coords.y1 += (dsc->border_side & LV_BORDER_SIDE_TOP) ? 1 : 0;
+        bg_coords.x2 -= (dsc->border_side & LV_BORDER_SIDE_RIGHT) ? 1 : 0;
+        bg_coords.y2 -= (dsc->border_side & LV_BORDER_SIDE_BOTTOM) ? 1 : 0;
+    }
+    lv_area_t clipped;
+    if (!_lv_area_intersect(&clipped, &bg_coords, draw_ctx->clip_area)) return false;
+
+    bool mask_any = lv_draw_mask_is_any(&bg_coords);
+    int32_t short_side = LV_MIN(lv_area_get_width(&bg_coords), lv_area_get_height(&bg_coords));
+    lv_coord_t rout = LV_MIN(dsc->radius, short_side >> 1);
+    if (!mask_any && rout <= 0) return false;      // Plain rectangle, one fill in LVGL too
+
+    // From here on LVGL builds masks row by row
+    lv_grad_dir_t grad_dir = dsc->bg_grad.dir;
+    lv_color_t color = grad_dir == LV_GRAD_DIR_NONE ? dsc->bg_color : dsc->bg_grad.stops[0].color;
+    if (color.full == dsc->bg_grad.stops[1].color.full) grad_dir = LV_GRAD_DIR_NONE;
+    bool lvgl = grad_dir != LV_GRAD_DIR_NONE || dsc->blend_mode != LV_BLEND_MODE_NORMAL ||
+                (dsc->shadow_width && dsc->shadow_opa > LV_OPA_MIN) || rout > UI_CORNER_MAX_RADIUS;
+
+    // The mask stack (what lv_draw_mask_apply() runs) and the background's own radius mask
+    RoundMask masks[_LV_MASK_MAX_NUM];
+    int n = 0;
+    for (int i = 0; i < _LV_MASK_MAX_NUM && !lvgl; i++) {
+        auto *param = (lv_draw_mask_radius_param_t *)LV_GC_ROOT(_lv_draw_mask_list[i]).param;
+        if (!param) {
+            // A hole: LVGL would add the background's mask there, and apply stops at it
+            for (int k = i + 1; k < _LV_MASK_MAX_NUM; k++) lvgl |= LV_GC_ROOT(_lv_draw_mask_list[k]).param != nullptr;
+            break;
+        }
+        // Other mask types, inverted (border) masks, no free entry for the background's own
+        if (param->dsc.type != LV_DRAW_MASK_TYPE_RADIUS || param->cfg.outer ||
+            param->cfg.radius > UI_CORNER_MAX_RADIUS || i == _LV_MASK_MAX_NUM - 1) {
+            lvgl = true;
+            break;
+        }
+        masks[n++] = { param->cfg.rect, param->cfg.radius, nullptr };
+    }
+    if (lvgl) {
+        stats.rects_lvgl++;
+        return false;
+    }
+    masks[n++] = { bg_coords, rout, nullptr };
+    uint32_t since = use_clock;
+    for (int i = 0; i < n; i++) {
+        if (!masks[i].radius) continue;
+        masks[i].corner = corner_get(masks[i].radius, since);
+        if (!masks[i].corner) {
+            stats.rects_lvgl++;
+            return false;
+        }
+    }
+    stats.rects++;
+
+    lv_opa_t opa = dsc->bg_opa >= LV_OPA_MAX ? (lv_opa_t)LV_OPA_COVER : dsc->bg_opa;
+    lv_area_t area;
+    lv_draw_sw_blend_dsc_t blend;
+    lv_memset_00(&blend, sizeof(blend));
+    blend.color = color;
+    blend.blend_area = &area;
+
+    auto fill = [&](lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2, lv_opa_t fill_opa) {
+        area = { x1, y1, x2, y2 };
+        blend.opa = fill_opa;
+        blend.mask_buf = nullptr;
+        blend.mask_res = LV_DRAW_MASK_RES_FULL_COVER;
+        lv_draw_sw_blend(draw_ctx, &blend);
+    };
+
+    if (n == 1 && opa == LV_OPA_COVER) {
+        // Only the background's own radius: the corner blocks through their
+        // coverage, the bands between them and the middle as fills
+        const lv_area_t &b = bg_coords;
+        const CornerSlot *c = masks[0].corner;
+        auto corner = [&](lv_coord_t x, lv_coord_t y, const uint8_t *quad) {
+            area = { x, y, (lv_coord_t)(x + rout - 1), (lv_coord_t)(y + rout - 1) };
+            blend.opa = LV_OPA_COVER;
+            blend.mask_buf = (lv_opa_t *)quad;
+            blend.mask_area = &area;
+            blend.mask_res = LV_DRAW_MASK_RES_CHANGED;
+            lv_draw_sw_blend(draw_ctx, &blend);
+        };
+        corner(b.x1, b.y1, c->quad[TOP_LEFT]);
+        corner(b.x2 - rout + 1, b.y1, c->quad[TOP_RIGHT]);
+        corner(b.x1, b.y2 - rout + 1, c->quad[BOTTOM_LEFT]);
+        corner(b.x2 - rout + 1, b.y2 - rout + 1, c->quad[BOTTOM_RIGHT]);
+        fill(b.x1 + rout, b.y1, b.x2 - rout, b.y1 + rout - 1, LV_OPA_COVER);
+        fill(b.x1 + rout, b.y2 - rout + 1, b.x2 - rout, b.y2, LV_OPA_COVER);
+        fill(b.x1, b.y1 + rout, b.x2, b.y2 - rout, LV_OPA_COVER);
+        return true;
+    }
+
+    // Otherwise row by row as LVGL, with the corner pixels from the cache
+    lv_opa_t *mask_buf = (lv_opa_t *)lv_mem_buf_get(lv_area_get_width(&clipped));
+    auto fill_masked = [&](lv_coord_t a, lv_coord_t b, lv_coord_t y, lv_coord_t mask_y) {
+        row_mask(mask_buf, a, b, opa, masks, n, mask_y);
+        area = { a, y, b, y };
+        blend.opa = LV_OPA_COVER;
+        blend.mask_buf = mask_buf;
+        blend.mask_area = &area;
+        blend.mask_res = LV_DRAW_MASK_RES_CHANGED;
+        lv_draw_sw_blend(draw_ctx, &blend);
+    };
+    // Without other masks LVGL computes the corner rows at the top and mirrors
+    // them to the bottom, the rows between are one fill
+    auto mask_row = [&](lv_coord_t y) -> lv_coord_t {
+        return (!mask_any && y > bg_coords.y2 - rout) ? bg_coords.y1 + (bg_coords.y2 - y) : y;
+    };
+
+    lv_coord_t y = clipped.y1;
+    while (y <= clipped.y2) {
+        if (!mask_any && y >= bg_coords.y1 + rout && y <= bg_coords.y2 - rout) {
+            lv_coord_t y2 = LV_MIN(clipped.y2, bg_coords.y2 - rout);
+            fill(clipped.x1, y, clipped.x2, y2, opa);
+            y = y2 + 1;
+            continue;
+        }
+
+        lv_coord_t lo = clipped.x1, hi = clipped.x2, left, right;
+        if (!row_spans(masks, n, mask_row(y), lo, hi, left, right)) {
+            y++;
+            continue;
+        }
+
+        if (opa == LV_OPA_COVER && left < lo && right > hi) {
+            // No corner pixel: one fill down to the last row that is the same
+            lv_coord_t y2 = y;
+            while (y2 < clipped.y2) {
+                lv_coord_t lo2 = clipped.x1, hi2 = clipped.x2, left2, right2;
+                if (!row_spans(masks, n, mask_row(y2 + 1), lo2, hi2, left2, right2) ||
+                    lo2 != lo || hi2 != hi || left2 >= lo2 || right2 <= hi2) break;
+                y2++;
+            }
+            fill(lo, y, hi, y2, LV_OPA_COVER);
+            y = y2 + 1;
+            continue;
+        }
+
+        if (opa != LV_OPA_COVER || right <= left + 1) {
+            fill_masked(lo, hi, y, mask_row(y));
+        } else {
+            // Only the corners through the mask, the straight part between them as a fill
+            if (left >= lo) fill_masked(lo, left, y, mask_row(y));
+            lv_coord_t mid1 = LV_MAX(lo, left + 1), mid2 = LV_MIN(hi, right - 1);
+            if (mid1 <= mid2) fill(mid1, y, mid2, y, LV_OPA_COVER);
+            if (right <= hi) fill_masked(right, hi, y, mask_row(y));
+        }
+        y++;
+    }
+
+    lv_mem_buf_release(mask_buf);
+    return true;
+}
+
+void ui_corner_draw_rect(lv_draw_ctx_t *draw_ctx, const lv_draw_rect_dsc_t *dsc, const lv_area_t *coords)
+{
+    if (!draw_bg(draw_ctx, dsc, coords)) {
+        lv_draw_sw_rect(draw_ctx, dsc, coords);
+        return;
+    }
+
+    // Background image, border, outline (no shadow) as LVGL, on top of the background
+    lv_draw_rect_dsc_t rest = *dsc;
+    rest.bg_opa = LV_OPA_TRANSP;
+    lv_draw_sw_rect(draw_ctx, &rest, coords);
+}
+
+void ui_corner_cache_install(lv_disp_t *disp)
+{
+    if (disp && disp->driver->draw_ctx) disp->driver->draw_ctx->draw_rect = ui_corner_draw_rect;
+}
+
+UiCornerCacheStats ui_corner_cache_stats()
+{
+    return stats;
+}
+
+void ui_corner_cache_reset_stats()
+{
+    stats = {};
+}
+
+void ui_corner_cache_clear()
+{
+    for (CornerSlot &slot : slots) {
+        if (slot.radius) corner_free(slot);
+    }
+}
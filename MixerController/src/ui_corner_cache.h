@@ -0,0 +1,40 @@
+#pragma once
+
+/*
+ * Rounded backgrounds from cached corner coverage
+ *
+ * LVGL 8.4 draws a rounded background (lv_draw_sw_rect.c) one row at a time
+ * through lv_draw_mask: every corner row rebuilds the radius mask across the
+ * whole width and blends the whole row through it, and a bar indicator (the
+ * sliders) does that for every row because the bar's own radius mask is
+ * active. ui_corner_draw_rect() replaces draw_rect of the draw context. It
+ * keeps the coverage of the four corner blocks per radius, rasterized once by
+ * LVGL's own radius mask: a plain rounded background is four masked blocks and
+ * three fills, under other radius masks only the corner pixels of a row go
+ * through a mask and runs of rows without corners are one fill.
+ *
+ * Shadows, gradients, blend modes and masks other than plain radius masks stay
+ * with lv_draw_sw_rect(). The pixels are the same as LVGL's (UiBench -r checks
+ * random rectangles against lv_draw_sw_rect and times the Screen1 ones).
+ */
+
+#include <lvgl.h>
+
+#define UI_CORNER_CACHE_SLOTS   (8)             // Radii, Screen1 uses 6, 25, 39, 44 and 45
+#define UI_CORNER_CACHE_BYTES   (32 * 1024)     // Heap (not lv_mem), a corner takes 4*r*r + r bytes
+#define UI_CORNER_MAX_RADIUS    (48)            // Larger corners are left to LVGL
+
+struct UiCornerCacheStats {
+    uint32_t hits;          // Corner found in the cache
+    uint32_t misses;        // Corner rasterized into the cache
+    uint32_t rects;         // Backgrounds drawn from cached corners
+    uint32_t rects_lvgl;    // Rounded / masked backgrounds left to LVGL
+};
+
+// Hook `disp` (LVGL software renderer) up to ui_corner_draw_rect()
+void ui_corner_cache_install(lv_disp_t *disp);
+UiCornerCacheStats ui_corner_cache_stats();
+void ui_corner_cache_reset_stats();
+void ui_corner_cache_clear();           // Free the corners (the next draws miss)
+
+void ui_corner_draw_rect(lv_draw_ctx_t *draw_ctx, const lv_draw_rect_dsc_t *dsc, const lv_area_t *coords);
@@ -1,95 +1,86 @@
 #include "ui/ui.h"
 #include "app_data.h"
 
-// Power sensing toggle switch (created dynamically on Screen 2)
-static lv_obj_t *ui_power_switch = NULL;
+// Power sensing toggle switch (created dynamically on Screen 2), NULL while
+// Screen 2 is not built
+lv_obj_t *ui_power_switch = NULL;
 
 extern "C" {
 
 void mic_V(lv_event_t * e) {
     lv_obj_t * slider = lv_event_get_target(e);
     int value = lv_slider_get_value(slider);
-    AppData.mic_volume = value;
-    AppData.sendUpdate();
+    AppData.post(APP_CMD_MIC_VOLUME, value);  // Applied and sent by loop()
 }
 
 void music_V(lv_event_t * e) {
     lv_obj_t * slider = lv_event_get_target(e);
     int value = lv_slider_get_value(slider);
-    AppData.music_volume = value;
-    AppData.sendUpdate();
+    AppData.post(APP_CMD_MUSIC_VOLUME, value);  // Applied and sent by loop()
 }
 
 void main_Volume(lv_event_t * e) {
     lv_obj_t * slider = lv_event_get_target(e);
     int value = lv_slider_get_value(slider);
-    AppData.main_fader = value;
-    AppData.sendUpdate();
+    AppData.post(APP_CMD_MAIN_FADER, value);  // Applied and sent by loop()
 }
 
 // Power sensing toggle callback
 static void toggle_power_sensing(lv_event_t * e) {
     lv_obj_t * sw = lv_event_get_target(e);
-    AppData.power_sensing_enabled = lv_obj_has_state(sw, LV_STATE_CHECKED);
-    AppData.sendUpdate();
-    AppData.saveState();  // Save immediately — this is a settings change
-    Serial.printf("Power sensing: %s\n", AppData.power_sensing_enabled ? "ON" : "OFF");
+    AppData.post(APP_CMD_POWER_SENSING, lv_obj_has_state(sw, LV_STATE_CHECKED));  // Saved by loop()
 }
 
 void mic_mode_toggle(lv_event_t * e) {
     lv_obj_t * obj = lv_event_get_target(e);
     
+    // Buttons are already toggled by the generated handler. The relay
+    // SAFETY SEQUENCE (volume 0, settle, switch) runs in loop(), so the
+    // LVGL task never waits here. If the command queue is full the relay
+    // stays as it is, and the buttons are toggled back.
+
     // Check which switch triggered the event
     if (obj == ui_mic_switch1) {
-        // SAFETY SEQUENCE: 
-        // 1. Reset Volume to 0 (Prevent Pop)
-        AppData.mic_volume = 0;
-        
-        // 2. Update UI Slider immediately
-        if (ui_Slider1) lv_slider_set_value(ui_Slider1, 0, LV_ANIM_ON);
-        
-        // 3. Send Update (Volume = 0, Relay = OLD)
-        AppData.sendUpdate();
-        
-        // 4. Wait for receiver to process volume drop
-        vTaskDelay(pdMS_TO_TICKS(50));
-        
-        // 5. Toggle Relay
-        AppData.mic_relay_state = !AppData.mic_relay_state;
-        
-        // 6. Sync UI (Updates Button State & Confirms Slider)
-        AppData.syncUI();
-        
-        // 7. Send Update (Relay = NEW)
-        AppData.sendUpdate();
+        if (AppData.post(APP_CMD_TOGGLE_MIC_RELAY)) {
+            // Reset Volume Slider to 0 (Prevent Pop)
+            if (ui_Slider1) lv_slider_set_value(ui_Slider1, 0, LV_ANIM_ON);
+        } else {
+            _ui_state_modify(ui_Button3, LV_STATE_CHECKED, _UI_MODIFY_STATE_TOGGLE);
+            _ui_state_modify(ui_Button4, LV_STATE_CHECKED, _UI_MODIFY_STATE_TOGGLE);
+        }
     }
     else if (obj == ui_music_switch) {
-        // SAFETY SEQUENCE:
-        // 1. Reset Volume to 0
-        AppData.music_volume = 0;
-        
-        // 2. Update UI Slider
-        if (ui_Slider2) lv_slider_set_value(ui_Slider2, 0, LV_ANIM_ON);
-        
-        // 3. Send Update (Volume = 0, Relay = OLD)
-        AppData.sendUpdate();
-        
-        // 4. Wait
-        vTaskDelay(pdMS_TO_TICKS(50));
-        
-        // 5. Toggle Relay
-        AppData.music_relay_state = !AppData.music_relay_state;
-        
-        // 6. Sync UI
-        AppData.syncUI();
-        
-        // 7. Send Update (Relay = NEW)
-        AppData.sendUpdate();
+        if (AppData.post(APP_CMD_TOGGLE_MUSIC_RELAY)) {
+            if (ui_Slider2) lv_slider_set_value(ui_Slider2, 0, LV_ANIM_ON);
+        } else {
+            _ui_state_modify(ui_Button1, LV_STATE_CHECKED, _UI_MODIFY_STATE_TOGGLE);
+            _ui_state_modify(ui_Button2, LV_STATE_CHECKED, _UI_MODIFY_STATE_TOGGLE);
+        }
     }
 }
 
+// Slider released: send the final value without waiting for the rate limit
+static void slider_released(lv_event_t * /*e*/) {
+    AppData.post(APP_CMD_SLIDER_RELEASED);
+}
+
 } // extern "C"
 
+// Called after each screen build to guarantee a final frame when a slider is
+// let go; sliders that already have it keep one
+void ui_sliders_add_release_flush(void) {
+    lv_obj_t *sliders[] = { ui_Slider1, ui_Slider2, ui_Slider3 };
+    for (lv_obj_t *slider : sliders) {
+        if (!slider) continue;
+        lv_obj_remove_event_cb(slider, slider_released);
+        lv_obj_add_event_cb(slider, slider_released, LV_EVENT_RELEASED, NULL);
+    }
+}
+
+static void power_switch_deleted(lv_event_t * /*e*/) {
+    ui_power_switch = NULL;     // Screen2 deleted (ui_screens_trim())
+}
+
 // Called after ui_Screen2_screen_init to add the power sensing toggle
 void ui_screen2_add_power_toggle(void) {
     if (!ui_Screen2) return;
@@ -129,4 +120,5 @@ void ui_screen2_add_power_toggle(void) {
     
     // Event
     lv_obj_add_event_cb(ui_power_switch, toggle_power_sensing, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_obj_add_event_cb(ui_power_switch, power_switch_deleted, LV_EVENT_DELETE, NULL);
 }
@@ -0,0 +1,40 @@
+#include "ui_font_cache.h"
+#include <string.h>
+
+struct GlyphSlot {
+    const lv_font_t *font;      // NULL: free
+    uint32_t letter;
+    uint32_t used;              // Last use, for eviction
+    uint8_t *bitmap;            // lv_mem
+};
+
+static GlyphSlot slots[UI_FONT_CACHE_SLOTS];
+static uint32_t use_clock = 0;
+
+extern "C" const uint8_t * ui_font_cache_get_bitmap(const lv_font_t * font, uint32_t letter) {
+    if (letter == '\t') letter = ' ';
+
+    GlyphSlot *victim = &slots[0];
+    for (GlyphSlot &slot : slots) {
+        if (slot.font == font && slot.letter == letter) {
+            slot.used = ++use_clock;
+            return slot.bitmap;
+        }
+        if (slot.used < victim->used) victim = &slot;
+    }
+
+    // Miss: LVGL decompresses into its shared buffer, valid until the next glyph
+    const uint8_t *bitmap = lv_font_get_bitmap_fmt_txt(font, letter);
+    if (!bitmap) return NULL;
+
+    lv_font_glyph_dsc_t g;
+    if (!lv_font_get_glyph_dsc_fmt_txt(font, &g, letter, 0)) return bitmap;
+    uint32_t bits = (g.bpp == 3) ? 4 : g.bpp;      // 3 bpp is decompressed as 4
+    size_t size = ((size_t)g.box_w * g.box_h * bits + 7) / 8;
+
+    uint8_t *copy = victim->bitmap ? (uint8_t *)lv_mem_realloc(victim->bitmap, size) : (uint8_t *)lv_mem_alloc(size);
+    if (!copy) return bitmap;       // lv_mem full: uncached, as without this
+    memcpy(copy, bitmap, size);
+    *victim = { font, letter, ++use_clock, copy };
+    return copy;
+}
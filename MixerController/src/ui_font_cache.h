@@ -0,0 +1,23 @@
+#pragma once
+
+/*
+ * Decompressed glyphs of the RLE compressed UI fonts
+ *
+ * tools/ui_fonts.py points get_glyph_bitmap of a compressed font here.
+ * LVGL itself decompresses the glyph on every draw; this keeps the last
+ * UI_FONT_CACHE_SLOTS glyphs (any font) in lv_mem and returns them as they are.
+ */
+
+#include <lvgl.h>
+
+#define UI_FONT_CACHE_SLOTS    (16)     // 50 px glyph: up to ~600 bytes
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+const uint8_t * ui_font_cache_get_bitmap(const lv_font_t * font, uint32_t letter);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,226 @@
+#include "ui_mem.h"
+#include <stdlib.h>
+#include <string.h>
+#ifdef ESP_PLATFORM
+#include <esp_heap_caps.h>
+#endif
+
+#define PAGES       (UI_MEM_SLAB_BYTES / UI_MEM_PAGE_BYTES)
+#define CLASS_MIN   (16)        // Smallest block, keeps every block 16-byte aligned
+
+static_assert(PAGES <= 64, "ui_mem: the page masks are 64 bits");
+static_assert(UI_MEM_PAGE_BYTES % (CLASS_MIN << (UI_MEM_CLASSES - 1)) == 0, "ui_mem: pages must hold whole blocks");
+
+struct FreeBlock {
+    FreeBlock *next;
+};
+
+struct Page {
+    FreeBlock *free;        // Blocks freed in this page
+    uint16_t carved;        // Bytes handed out from the start of the page so far
+    uint16_t used;          // Blocks in use
+    uint8_t cls;            // Size class + 1, 0: page not in use
+};
+
+// Heap blocks: the size in front, keeping the block aligned as malloc() does
+union HeapHeader {
+    struct {
+        uint32_t size;
+        uint32_t psram;
+    } h;
+    max_align_t align;
+};
+
+alignas(16) static uint8_t slab[UI_MEM_SLAB_BYTES];
+static Page pages[PAGES];
+static uint64_t free_pages = (PAGES == 64) ? ~0ULL : ((1ULL << PAGES) - 1);
+static uint64_t avail[UI_MEM_CLASSES];      // Pages of a class with a block to give
+static UiMemStats stats = {};
+
+static inline uint32_t block_size(uint32_t cls)
+{
+    return CLASS_MIN << cls;
+}
+
+static inline uint32_t size_class(size_t size)
+{
+    return size <= CLASS_MIN ? 0 : 32 - __builtin_clz((uint32_t)size - 1) - 4;
+}
+
+static inline bool in_slab(const void *p)
+{
+    return (const uint8_t *)p >= slab && (const uint8_t *)p < slab + sizeof(slab);
+}
+
+// ----------------------------------------------------------------------
+// Slab
+// ----------------------------------------------------------------------
+
+static void *slab_alloc(uint32_t cls)
+{
+    uint32_t block = block_size(cls);
+    uint32_t pi;
+    if (avail[cls]) {
+        pi = __builtin_ctzll(avail[cls]);
+    } else if (free_pages) {
+        pi = __builtin_ctzll(free_pages);
+        free_pages &= ~(1ULL << pi);
+        avail[cls] |= 1ULL << pi;
+        pages[pi] = { nullptr, 0, 0, (uint8_t)(cls + 1) };
+        stats.classes[cls].pages++;
+        if (++stats.pages > stats.pages_peak) stats.pages_peak = stats.pages;
+        stats.slab_free += UI_MEM_PAGE_BYTES;
+    } else {
+        return nullptr;
+    }
+
+    Page &page = pages[pi];
+    void *p;
+    if (page.free) {
+        p = page.free;
+        page.free = page.free->next;
+    } else {
+        p = slab + pi * UI_MEM_PAGE_BYTES + page.carved;
+        page.carved += block;
+    }
+    page.used++;
+    if (!page.free && page.carved + block > UI_MEM_PAGE_BYTES) avail[cls] &= ~(1ULL << pi);
+
+    UiMemClassStats &cs = stats.classes[cls];
+    if (++cs.used > cs.peak) cs.peak = cs.used;
+    stats.slab_free -= block;
+    return p;
+}
+
+static void slab_free(void *p)
+{
+    uint32_t pi = ((uint8_t *)p - slab) / UI_MEM_PAGE_BYTES;
+    Page &page = pages[pi];
+    uint32_t cls = page.cls - 1;
+    FreeBlock *b = (FreeBlock *)p;
+    b->next = page.free;
+    page.free = b;
+    page.used--;
+    avail[cls] |= 1ULL << pi;
+    stats.classes[cls].used--;
+    stats.slab_free += block_size(cls);
+
+    // The page back for any class
+    if (!page.used) {
+        page = {};
+        avail[cls] &= ~(1ULL << pi);
+        free_pages |= 1ULL << pi;
+        stats.classes[cls].pages--;
+        stats.pages--;
+        stats.slab_free -= UI_MEM_PAGE_BYTES;
+    }
+}
+
+// ----------------------------------------------------------------------
+// Heap
+// ----------------------------------------------------------------------
+
+static void *heap_raw(size_t n, bool &psram)
+{
+#ifdef ESP_PLATFORM
+    const uint32_t internal = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+    void *p = heap_caps_malloc(n, psram ? MALLOC_CAP_SPIRAM : internal);
+    if (!p) {
+        psram = !psram;
+        p = heap_caps_malloc(n, psram ? MALLOC_CAP_SPIRAM : internal);
+    }
+    return p;
+#else
+    (void)psram;
+    return malloc(n);       // Host: one heap, the tier is counted by size
+#endif
+}
+
+static void *heap_alloc(size_t size)
+{
+    bool psram = size >= UI_MEM_PSRAM_MIN;
+    HeapHeader *hdr = (HeapHeader *)heap_raw(sizeof(HeapHeader) + size, psram);
+    if (!hdr) return nullptr;
+    hdr->h.size = (uint32_t)size;
+    hdr->h.psram = psram;
+
+    UiMemHeapStats &hs = psram ? stats.psram : stats.internal;
+    hs.used += size;
+    if (hs.used > hs.peak) hs.peak = hs.used;
+    hs.blocks++;
+    hs.allocs++;
+    return hdr + 1;
+}
+
+static void heap_free(void *p)
+{
+    HeapHeader *hdr = (HeapHeader *)p - 1;
+    UiMemHeapStats &hs = hdr->h.psram ? stats.psram : stats.internal;
+    hs.used -= hdr->h.size;
+    hs.blocks--;
+#ifdef ESP_PLATFORM
+    heap_caps_free(hdr);
+#else
+    free(hdr);
+#endif
+}
+
+// ----------------------------------------------------------------------
+// LV_MEM_CUSTOM_ALLOC / FREE / REALLOC
+// ----------------------------------------------------------------------
+
+void *ui_mem_alloc(size_t size)
+{
+    void *p = nullptr;
+    uint32_t cls = size_class(size);
+    if (cls < UI_MEM_CLASSES) {
+        stats.classes[cls].allocs++;
+        p = slab_alloc(cls);
+        if (!p) stats.classes[cls].overflows++;
+    }
+    if (!p) p = heap_alloc(size);
+    if (!p) stats.failures++;
+    return p;
+}
+
+void ui_mem_free(void *p)
+{
+    if (!p) return;
+    if (in_slab(p)) slab_free(p);
+    else heap_free(p);
+}
+
+void *ui_mem_realloc(void *p, size_t size)
+{
+    if (!p) return ui_mem_alloc(size);
+    size_t old = in_slab(p) ? block_size(pages[((uint8_t *)p - slab) / UI_MEM_PAGE_BYTES].cls - 1) :
+                              ((HeapHeader *)p - 1)->h.size;
+    if (size <= old) return p;
+
+    void *q = ui_mem_alloc(size);
+    if (!q) return nullptr;
+    memcpy(q, p, old);
+    ui_mem_free(p);
+    return q;
+}
+
+void ui_mem_get_stats(UiMemStats *out)
+{
+    *out = stats;
+    for (uint32_t i = 0; i < UI_MEM_CLASSES; i++) out->classes[i].block = block_size(i);
+}
+
+void ui_mem_reset_stats(void)
+{
+    for (UiMemClassStats &cs : stats.classes) {
+        cs.peak = cs.used;
+        cs.allocs = 0;
+        cs.overflows = 0;
+    }
+    stats.pages_peak = stats.pages;
+    stats.internal.peak = stats.internal.used;
+    stats.internal.allocs = 0;
+    stats.psram.peak = stats.psram.used;
+    stats.psram.allocs = 0;
+    stats.failures = 0;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+/*
+ * LVGL heap (LV_MEM_CUSTOM in lv_conf.h)
+ *
+ * Small blocks (objects, style lists, style values, animations, timers) come
+ * from a slab in internal SRAM: pages of UI_MEM_PAGE_BYTES, each carved into
+ * blocks of one size class and given back when its last block is freed.
+ * Larger blocks, and small ones when the slab is full, come from the heap:
+ * internal SRAM below UI_MEM_PSRAM_MIN (the renderer's row and mask buffers of
+ * lv_mem_buf_get() are hot), PSRAM from there on (layer buffers, next to the
+ * PSRAM frame buffers), each falling back to the other.
+ *
+ * Called by LVGL only, under the LVGL lock, like LVGL's own allocator. The
+ * statistics are plain counters, read from any task ("mem" on the USB
+ * console, UiBench -a).
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define UI_MEM_SLAB_BYTES   (32 * 1024)     // Internal SRAM (.bss), LV_MEM_SIZE was 64 KB
+#define UI_MEM_PAGE_BYTES   (1024)          // At most 64 pages
+#define UI_MEM_CLASSES      (5)             // Blocks of 16, 32, 64, 128 and 256 bytes
+#define UI_MEM_PSRAM_MIN    (16 * 1024)     // Heap blocks this large go to PSRAM
+
+typedef struct {
+    uint32_t block;         // Block size
+    uint32_t used;          // Blocks in use
+    uint32_t peak;          // Most blocks in use
+    uint32_t pages;         // Pages of this class
+    uint32_t allocs;        // Allocations
+    uint32_t overflows;     // Allocations sent to the heap, the slab being full
+} UiMemClassStats;
+
+typedef struct {
+    uint32_t used;          // Bytes in use
+    uint32_t peak;          // Most bytes in use
+    uint32_t blocks;        // Blocks in use
+    uint32_t allocs;        // Allocations
+} UiMemHeapStats;
+
+typedef struct {
+    UiMemClassStats classes[UI_MEM_CLASSES];
+    uint32_t pages;         // Slab pages in use, of UI_MEM_SLAB_BYTES / UI_MEM_PAGE_BYTES
+    uint32_t pages_peak;
+    uint32_t slab_free;     // Bytes of free blocks in the pages in use (fragmentation)
+    UiMemHeapStats internal;
+    UiMemHeapStats psram;
+    uint32_t failures;      // Allocations that returned NULL
+} UiMemStats;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void *ui_mem_alloc(size_t size);
+void ui_mem_free(void *p);
+void *ui_mem_realloc(void *p, size_t size);
+
+void ui_mem_get_stats(UiMemStats *stats);
+void ui_mem_reset_stats(void);      // Peaks to the current use, counts to 0
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,178 @@
+#include "ui_screens.h"
+#include "ui_mem.h"
+#include "ui/ui.h"
+#include <Arduino.h>
+
+#define SCREEN_TRIMMABLE    (1 << 0)    // Deleted once replaced if memory runs short
+#define SCREEN_SPLASH       (1 << 1)    // Deleted once replaced, leaves by itself after UI_SCREENS_SPLASH_MS
+
+struct ScreenDef {
+    lv_obj_t **obj;
+    void (*init)(void);
+    void (*destroy)(void);
+    lv_event_cb_t event;        // Splash: the generated event handler, replaced
+    uint8_t flags;
+};
+
+static const ScreenDef screens[UI_SCREEN_COUNT] = {
+    { &ui_Screen1, ui_Screen1_screen_init, ui_Screen1_screen_destroy, nullptr, 0 },
+    { &ui_Screen2, ui_Screen2_screen_init, ui_Screen2_screen_destroy, nullptr, SCREEN_TRIMMABLE },
+    { &ui_Screen3, ui_Screen3_screen_init, ui_Screen3_screen_destroy, ui_event_Screen3, SCREEN_SPLASH },
+};
+
+// The generated handlers that call _ui_screen_change(): a callback in front
+// of each builds the target first, so that it gets on_build
+struct Nav {
+    lv_obj_t **obj;
+    lv_event_cb_t event;
+    lv_event_code_t code;
+    UiScreenId to;
+};
+
+static const Nav navs[] = {
+    { &ui_Button6, ui_event_Button6, LV_EVENT_LONG_PRESSED, UI_SCREEN_2 },
+    { &ui_Button5, ui_event_Button5, LV_EVENT_CLICKED, UI_SCREEN_1 },
+};
+
+static UiScreenBuilt built_cb = nullptr;
+static uint32_t prebuild_pending = 0;
+static UiScreensStats stats = {};
+
+// Shown, or on the way in or out of a screen load animation
+static bool shown(lv_obj_t *scr)
+{
+    lv_disp_t *disp = lv_obj_get_disp(scr);
+    return scr == disp->act_scr || scr == disp->scr_to_load || scr == disp->prev_scr;
+}
+
+static void nav_event(lv_event_t *e)
+{
+    ui_screens_get(((const Nav *)lv_event_get_user_data(e))->to);
+}
+
+static void splash_done(lv_timer_t *timer)
+{
+    (void)timer;
+    ui_screens_load(UI_SCREEN_1, LV_SCR_LOAD_ANIM_FADE_ON, UI_SCREENS_FADE_MS, 0);
+}
+
+static void splash_delete(void *user_data)
+{
+    const ScreenDef &def = screens[(uintptr_t)user_data];
+    if (*def.obj && !shown(*def.obj)) def.destroy();
+}
+
+// Short of slab pages: delete the trimmable screens not shown
+static void trim_if_short(void *user_data)
+{
+    (void)user_data;
+    UiMemStats mem;
+    ui_mem_get_stats(&mem);
+    if (mem.pages + UI_SCREENS_TRIM_PAGES > UI_MEM_SLAB_BYTES / UI_MEM_PAGE_BYTES) ui_screens_trim();
+}
+
+static void trimmable_event(lv_event_t *e)
+{
+    (void)e;
+    lv_async_call(trim_if_short, nullptr);     // After the animation let go of it
+}
+
+// Instead of the generated handler, whose fade needs Screen1 built when the splash loads
+static void splash_event(lv_event_t *e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    if (code == LV_EVENT_SCREEN_LOADED) {
+        lv_timer_t *timer = lv_timer_create(splash_done, UI_SCREENS_SPLASH_MS, nullptr);
+        lv_timer_set_repeat_count(timer, 1);
+    } else if (code == LV_EVENT_SCREEN_UNLOADED) {
+        lv_async_call(splash_delete, lv_event_get_user_data(e));    // After the animation let go of it
+    }
+}
+
+static void build(UiScreenId id)
+{
+    const ScreenDef &def = screens[id];
+    uint32_t t0 = micros();
+    def.init();
+    lv_obj_t *scr = *def.obj;
+
+    if (def.flags & SCREEN_SPLASH) {
+        lv_obj_remove_event_cb(scr, def.event);
+        lv_obj_add_event_cb(scr, splash_event, LV_EVENT_ALL, (void *)(uintptr_t)id);
+    }
+    if (def.flags & SCREEN_TRIMMABLE) {
+        lv_obj_add_event_cb(scr, trimmable_event, LV_EVENT_SCREEN_UNLOADED, nullptr);
+    }
+    for (const Nav &nav : navs) {
+        lv_obj_t *obj = *nav.obj;
+        if (!obj || lv_obj_get_screen(obj) != scr) continue;
+        lv_obj_remove_event_cb(obj, nav.event);
+        lv_obj_add_event_cb(obj, nav_event, nav.code, (void *)&nav);
+        lv_obj_add_event_cb(obj, nav.event, LV_EVENT_ALL, nullptr);
+    }
+    if (built_cb) built_cb(id, scr);
+
+    stats.builds[id]++;
+    stats.build_us[id] = micros() - t0;
+}
+
+static void prebuild_timer(lv_timer_t *timer)
+{
+    // One screen per idle tick, the frames in between stay short
+    if (lv_disp_get_inactive_time(nullptr) < UI_SCREENS_IDLE_MS) return;
+    UiScreenId id = (UiScreenId)__builtin_ctz(prebuild_pending);
+    prebuild_pending &= ~(1u << id);
+    if (!*screens[id].obj) {
+        build(id);
+        stats.prebuilds++;
+    }
+
+    // Nothing left: no more wake-ups, the LVGL task can sleep (LV_NO_TIMER_READY)
+    if (!prebuild_pending) lv_timer_pause(timer);
+}
+
+void ui_screens_init(UiScreenBuilt on_build, uint32_t prebuild)
+{
+    // ui_init() without the screens (nor its empty ui____initial_actions0 screen)
+    lv_disp_t *disp = lv_disp_get_default();
+    lv_theme_t *theme = lv_theme_default_init(disp, lv_palette_main(LV_PALETTE_BLUE), lv_palette_main(LV_PALETTE_RED),
+                                              false, LV_FONT_DEFAULT);
+    lv_disp_set_theme(disp, theme);
+
+    built_cb = on_build;
+    prebuild_pending = prebuild;
+    if (prebuild_pending) lv_timer_create(prebuild_timer, UI_SCREENS_TIMER_MS, nullptr);
+    ui_screens_load(UI_SCREEN_3, LV_SCR_LOAD_ANIM_NONE, 0, 0);
+}
+
+lv_obj_t *ui_screens_get(UiScreenId id)
+{
+    if (!*screens[id].obj) build(id);
+    return *screens[id].obj;
+}
+
+void ui_screens_load(UiScreenId id, lv_scr_load_anim_t anim, uint32_t time, uint32_t delay)
+{
+    lv_scr_load_anim(ui_screens_get(id), anim, time, delay, false);
+}
+
+uint32_t ui_screens_trim()
+{
+    uint32_t n = 0;
+    for (const ScreenDef &def : screens) {
+        if (!(def.flags & SCREEN_TRIMMABLE) || !*def.obj || shown(*def.obj)) continue;
+        def.destroy();
+        n++;
+    }
+    stats.trims += n;
+    return n;
+}
+
+UiScreensStats ui_screens_stats()
+{
+    UiScreensStats st = stats;
+    for (uint32_t i = 0; i < UI_SCREEN_COUNT; i++) {
+        if (*screens[i].obj) st.built |= 1u << i;
+    }
+    return st;
+}
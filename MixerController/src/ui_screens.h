@@ -0,0 +1,52 @@
+#pragma once
+
+/*
+ * SquareLine screens built when first needed
+ *
+ * ui_init() builds Screen3 (splash), Screen1 and Screen2 with all their
+ * widgets before the first frame and keeps them for good. ui_screens_init()
+ * replaces it: the theme and the splash only. A screen is built when a
+ * navigation (the generated _ui_screen_change() calls) first goes there, or
+ * before that by a timer while there is no input, for the screens asked for.
+ * Each build calls `on_build` for what used to be added after ui_init():
+ * extra widgets, event callbacks, AppData.syncUI().
+ *
+ * The splash is deleted once another screen has replaced it, and built again
+ * when it is shown again (wake from power off). Screen2 (settings) is deleted
+ * when it is replaced and the LVGL heap runs short (fewer than
+ * UI_SCREENS_TRIM_PAGES free slab pages, ui_mem.h), or on ui_screens_trim(),
+ * and built again, with the current AppData values, on the next visit.
+ *
+ * LVGL task or under the LVGL lock.
+ */
+
+#include <lvgl.h>
+
+#define UI_SCREENS_TIMER_MS     (100)   // Pre-build checks, paused once every screen asked for is built
+#define UI_SCREENS_IDLE_MS      (300)   // No input this long: pre-build one screen
+#define UI_SCREENS_TRIM_PAGES   (4)     // Free slab pages below this: trim
+#define UI_SCREENS_SPLASH_MS    (2000)  // Splash shown, then a fade to Screen1 (ui_Screen3.c)
+#define UI_SCREENS_FADE_MS      (300)
+
+enum UiScreenId {
+    UI_SCREEN_1,            // Mic and music volumes, relays
+    UI_SCREEN_2,            // Main fader, power sensing
+    UI_SCREEN_3,            // Splash
+    UI_SCREEN_COUNT
+};
+
+struct UiScreensStats {
+    uint32_t built;                         // Bit per UiScreenId: screens alive now
+    uint32_t builds[UI_SCREEN_COUNT];
+    uint32_t build_us[UI_SCREEN_COUNT];     // Last build, on_build included
+    uint32_t prebuilds;                     // Builds by the idle timer
+    uint32_t trims;                         // Screens deleted by ui_screens_trim()
+};
+
+typedef void (*UiScreenBuilt)(UiScreenId id, lv_obj_t *screen);
+
+void ui_screens_init(UiScreenBuilt on_build, uint32_t prebuild);    // prebuild: bit per UiScreenId
+lv_obj_t *ui_screens_get(UiScreenId id);                            // Built if needed
+void ui_screens_load(UiScreenId id, lv_scr_load_anim_t anim, uint32_t time, uint32_t delay);
+uint32_t ui_screens_trim();                                         // Screens deleted
+UiScreensStats ui_screens_stats();
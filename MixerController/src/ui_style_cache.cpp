@@ -0,0 +1,144 @@
+#include "ui_style_cache.h"
+#include <src/misc/lv_gc.h>
+#include <string.h>
+
+#define CACHED_FLAG     LV_OBJ_FLAG_USER_1     // obj->user_data is the object's StyleTable
+#define PROBES          (4)                    // Slots tried from a key's own
+
+// A resolved value, valid while `epoch` is the table's
+struct StyleSlot {
+    lv_style_value_t value;
+    uint16_t prop;              // lv_style_prop_t
+    lv_state_t state;
+    uint8_t part;               // lv_part_t >> 16
+    uint8_t epoch;              // 0: never valid
+};
+
+// 1 << UI_STYLE_CACHE_MIN_BITS slots at first, doubled when a key finds its probes taken
+struct StyleTable {
+    uint8_t epoch;              // Emptying the table is a new epoch
+    uint8_t bits;               // 1 << bits slots
+    StyleSlot slots[];
+};
+
+static UiStyleCacheStats stats = {};
+static void (*trace_cb)(const lv_obj_t *, lv_part_t, lv_style_prop_t) = nullptr;
+
+extern "C" lv_style_value_t __real_lv_obj_get_style_prop(const lv_obj_t *obj, lv_part_t part, lv_style_prop_t prop);
+extern "C" void __real_lv_obj_invalidate(const lv_obj_t *obj);
+
+static StyleTable *table_alloc(StyleTable *old, uint8_t bits)
+{
+    size_t size = sizeof(StyleTable) + ((size_t)1 << bits) * sizeof(StyleSlot);
+    StyleTable *t = (StyleTable *)lv_mem_realloc(old, size);
+    if (!t) return nullptr;
+    memset(t, 0, size);
+    t->epoch = 1;
+    t->bits = bits;
+    return t;
+}
+
+static inline uint32_t slot_home(uint32_t prop, uint32_t part_idx, uint8_t bits)
+{
+    return ((prop | part_idx << 16) * 0x9E3779B1u) >> (32 - bits);
+}
+
+static void table_empty(StyleTable *t)
+{
+    if (++t->epoch == 0) {      // Wrapped: slots of an old epoch 1 would be valid again
+        memset(t->slots, 0, sizeof(StyleSlot) << t->bits);
+        t->epoch = 1;
+    }
+}
+
+static void drop_tree(const lv_obj_t *obj)
+{
+    if (obj->flags & CACHED_FLAG) {
+        table_empty((StyleTable *)obj->user_data);
+        stats.drops++;
+    }
+    uint32_t cnt = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < cnt; i++) drop_tree(obj->spec_attr->children[i]);
+}
+
+static void table_deleted(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_target(e);
+    lv_obj_clear_flag(obj, CACHED_FLAG);
+    lv_mem_free(obj->user_data);
+    obj->user_data = nullptr;
+}
+
+extern "C" lv_style_value_t __wrap_lv_obj_get_style_prop(const lv_obj_t *obj, lv_part_t part, lv_style_prop_t prop)
+{
+    stats.lookups++;
+    if (trace_cb) trace_cb(obj, part, prop);
+    if (!obj || !(obj->flags & CACHED_FLAG) || LV_GC_ROOT(_lv_obj_style_trans_ll).head) {
+        return __real_lv_obj_get_style_prop(obj, part, prop);
+    }
+
+    StyleTable *t = (StyleTable *)obj->user_data;
+    uint8_t part_idx = (uint8_t)(part >> 16);
+    uint32_t mask = (1u << t->bits) - 1;
+    uint32_t home = slot_home(prop, part_idx, t->bits);
+    StyleSlot *free_slot = nullptr;
+    for (uint32_t i = 0; i < PROBES; i++) {
+        StyleSlot &slot = t->slots[(home + i) & mask];
+        if (slot.epoch != t->epoch) {
+            free_slot = &slot;
+            break;
+        }
+        if (slot.prop == prop && slot.part == part_idx && slot.state == obj->state) {
+            stats.hits++;
+            return slot.value;
+        }
+    }
+
+    stats.misses++;
+    lv_style_value_t value = __real_lv_obj_get_style_prop(obj, part, prop);
+    if (!free_slot) {
+        // Probes taken: a larger table, else the key's own slot
+        StyleTable *grown = t->bits < UI_STYLE_CACHE_MAX_BITS ? table_alloc(t, t->bits + 1) : nullptr;
+        if (grown) {
+            ((lv_obj_t *)obj)->user_data = t = grown;
+            home = slot_home(prop, part_idx, t->bits);
+        }
+        free_slot = &t->slots[home];
+    }
+    *free_slot = { value, (uint16_t)prop, obj->state, part_idx, t->epoch };
+    return value;
+}
+
+extern "C" void __wrap_lv_obj_invalidate(const lv_obj_t *obj)
+{
+    drop_tree(obj);
+    __real_lv_obj_invalidate(obj);
+}
+
+void ui_style_cache_enable(lv_obj_t *obj)
+{
+    if (!(obj->flags & CACHED_FLAG)) {
+        StyleTable *t = table_alloc(nullptr, UI_STYLE_CACHE_MIN_BITS);
+        if (!t) return;
+        obj->user_data = t;
+        lv_obj_add_flag(obj, CACHED_FLAG);
+        lv_obj_add_event_cb(obj, table_deleted, LV_EVENT_DELETE, nullptr);
+    }
+    uint32_t cnt = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < cnt; i++) ui_style_cache_enable(lv_obj_get_child(obj, i));
+}
+
+UiStyleCacheStats ui_style_cache_stats()
+{
+    return stats;
+}
+
+void ui_style_cache_reset_stats()
+{
+    stats = {};
+}
+
+void ui_style_cache_set_trace(void (*trace)(const lv_obj_t *obj, lv_part_t part, lv_style_prop_t prop))
+{
+    trace_cb = trace;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+/*
+ * Resolved style properties per object
+ *
+ * LVGL 8.4 resolves a style property (lv_obj_get_style_prop()) at every draw
+ * by walking the object's style list, and its parents' for inherited
+ * properties: a Screen1 frame makes ~460 lookups that give what the frame
+ * before got. ui_style_cache_enable() gives the objects of a screen a hash
+ * table of resolved values, keyed by part, property and the object's state:
+ * a lookup reads a few slots of it.
+ *
+ * Linked with -Wl,--wrap=lv_obj_get_style_prop -Wl,--wrap=lv_obj_invalidate.
+ * Every style change ends in lv_obj_invalidate() of the object
+ * (lv_obj_refresh_style(), so lv_obj_report_style_change() and the local /
+ * added styles, a state change to other styles, a transition step, a new
+ * parent), which empties the tables of the object and its children. While a
+ * style transition runs anywhere, lookups go to LVGL: it starts with a value
+ * it does not report. Lookups inside lv_obj_style.c are not wrapped and always
+ * go to LVGL. UiBench -s checks cached against resolved values and times both.
+ */
+
+#include <lvgl.h>
+
+#define UI_STYLE_CACHE_MIN_BITS (4)     // 16 slots per object, most Screen1 objects look up 10..23 properties
+#define UI_STYLE_CACHE_MAX_BITS (6)     // 64, the sliders look up 32 (3 parts)
+
+struct UiStyleCacheStats {
+    uint32_t lookups;       // lv_obj_get_style_prop() calls (wrapped)
+    uint32_t hits;          // Answered from a table
+    uint32_t misses;        // Resolved by LVGL into a table
+    uint32_t drops;         // Tables emptied by lv_obj_invalidate()
+};
+
+// Give `obj` and its children a table (lv_mem, freed with the object);
+// objects created later look up through LVGL
+void ui_style_cache_enable(lv_obj_t *obj);
+UiStyleCacheStats ui_style_cache_stats();
+void ui_style_cache_reset_stats();
+
+// UiBench -s: called with every wrapped lookup, nullptr: none
+void ui_style_cache_set_trace(void (*trace)(const lv_obj_t *obj, lv_part_t part, lv_style_prop_t prop));
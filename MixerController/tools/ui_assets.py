@@ -0,0 +1,138 @@
+"""
+ui_assets.py - converts the SquareLine image exports to the cheapest LVGL 8.4 format
+
+SquareLine writes every image in src/ui/images as LV_IMG_CF_TRUE_COLOR_ALPHA
+(RGB565 + alpha, 3 bytes/px). LVGL draws that format through its generic
+path: each chunk is unpacked into a color buffer and a mask buffer before it
+is blended. Per image the converter picks a format LVGL blends straight from
+flash, without changing a single pixel on screen:
+
+  LV_IMG_CF_TRUE_COLOR   every pixel opaque                2 bytes/px, copied
+  LV_IMG_CF_ALPHA_8BIT   one color, black (the recolor     1 byte/px, one color
+                         color of an image without            filled through the
+                         img_recolor style)                   alpha as a mask
+  LV_IMG_CF_RGB565A8     anything else, if the image is    3 bytes/px, color and
+                         not used with ADV_HITTEST            mask planes
+
+Indexed and 1/2/4-bit alpha formats are smaller, but LVGL 8.4 decodes them
+line by line on every draw, and RLE does not exist before LVGL 9; none of them
+is chosen. RGB565A8 has no per-pixel hit test in lv_img_buf_get_px_alpha(),
+so images with LV_OBJ_FLAG_ADV_HITTEST (the SquareLine default) stay as they are.
+
+Runs before every firmware build (extra_scripts in platformio.ini), so a fresh
+SquareLine export is converted without a manual step. Converted files are
+marked and skipped on the next run. Standalone:
+
+    python tools/ui_assets.py [src/ui]      convert, print the table
+    python tools/ui_assets.py --check       only print what would change
+"""
+
+import glob
+import os
+import re
+import sys
+
+MARK = "// ui_assets.py:"
+
+
+def parse(text):
+    """Width, height, color format and data bytes of a SquareLine image file"""
+    w = int(re.search(r"\.header\.w\s*=\s*(\d+)", text).group(1))
+    h = int(re.search(r"\.header\.h\s*=\s*(\d+)", text).group(1))
+    cf = re.search(r"\.header\.cf\s*=\s*(\w+)", text).group(1)
+    start = text.index("_data[] = {")
+    end = text.index("};", start)
+    data = [int(x, 16) for x in re.findall(r"0x([0-9A-Fa-f]{2})", text[start:end])]
+    return w, h, cf, data
+
+
+def hittest_images(ui_dir):
+    """Image descriptors shown by an lv_img with LV_OBJ_FLAG_ADV_HITTEST"""
+    names = set()
+    for path in glob.glob(os.path.join(ui_dir, "screens", "*.c")):
+        text = open(path, encoding="utf-8").read()
+        hit_objs = set(re.findall(r"lv_obj_add_flag\((\w+),[^)]*LV_OBJ_FLAG_ADV_HITTEST", text))
+        for obj, img in re.findall(r"lv_img_set_src\((\w+),\s*&(\w+)\)", text):
+            if obj in hit_objs:
+                names.add(img)
+    return names
+
+
+def uses_recolor(ui_dir):
+    for path in glob.glob(os.path.join(ui_dir, "screens", "*.c")):
+        if "img_recolor" in open(path, encoding="utf-8").read():
+            return True
+    return False
+
+
+def choose(w, h, data, hittest, recolor):
+    """Cheapest lossless format and its data for TRUE_COLOR_ALPHA pixels"""
+    px = [(data[i] | data[i + 1] << 8, data[i + 2]) for i in range(0, w * h * 3, 3)]
+    colors = [b for c, _ in px for b in (c & 0xFF, c >> 8)]    # RGB565, little endian
+    alpha = [a for _, a in px]
+    if all(a == 0xFF for a in alpha):
+        return "LV_IMG_CF_TRUE_COLOR", colors
+    if not recolor and all(c == 0 for c, a in px if a):
+        return "LV_IMG_CF_ALPHA_8BIT", alpha
+    if not hittest:
+        return "LV_IMG_CF_RGB565A8", colors + alpha
+    return "LV_IMG_CF_TRUE_COLOR_ALPHA", data
+
+
+def data_lines(data, row_bytes):
+    lines = []
+    for i in range(0, len(data), row_bytes):
+        lines.append("    " + "".join("0x%02X," % b for b in data[i:i + row_bytes]))
+    return "\n".join(lines)
+
+
+def convert(path, hittest, recolor, check):
+    """Returns (name, w, h, old format, new format, old bytes, new bytes)"""
+    text = open(path, encoding="utf-8").read()
+    name = os.path.splitext(os.path.basename(path))[0]
+    w, h, cf, data = parse(text)
+    if MARK in text or cf != "LV_IMG_CF_TRUE_COLOR_ALPHA" or len(data) != w * h * 3:
+        return name, w, h, cf, cf, len(data), len(data)
+
+    new_cf, new_data = choose(w, h, data, name in hittest, recolor)
+    if new_cf != cf and not check:
+        start = text.index("_data[] = {") + len("_data[] = {")
+        end = text.index("};", start)
+        row = w * (1 if new_cf == "LV_IMG_CF_ALPHA_8BIT" else 2)
+        text = text[:start] + "\n" + data_lines(new_data, row) + "\n" + text[end:]
+        text = text.replace("cf = " + cf, "cf = " + new_cf, 1)
+        text = re.sub(r"(// IMAGE DATA: .*\n)",
+                      r"\g<1>%s %s, was %s (%d -> %d bytes)\n" % (MARK, new_cf, cf, len(data), len(new_data)),
+                      text, count=1)
+        with open(path, "w", encoding="utf-8", newline="\n") as f:
+            f.write(text)
+    return name, w, h, cf, new_cf, len(data), len(new_data)
+
+
+def run(ui_dir, check=False):
+    images = sorted(glob.glob(os.path.join(ui_dir, "images", "*.c")))
+    hittest = hittest_images(ui_dir)
+    recolor = uses_recolor(ui_dir)
+    rows = [convert(p, hittest, recolor, check) for p in images]
+    changed = [r for r in rows if r[3] != r[4]]
+    if changed or check:
+        print("ui_assets: %s" % ("would convert" if check else "converted"))
+        for name, w, h, old, new, old_b, new_b in rows:
+            print("  %-20s %3dx%-3d %-28s -> %-28s %6d -> %6d bytes" % (name, w, h, old, new, old_b, new_b))
+        print("  flash: %d -> %d bytes" % (sum(r[5] for r in rows), sum(r[6] for r in rows)))
+    return rows
+
+
+def main():
+    args = [a for a in sys.argv[1:] if a != "--check"]
+    here = os.path.dirname(os.path.abspath(__file__))
+    run(args[0] if args else os.path.join(here, "..", "src", "ui"), check="--check" in sys.argv)
+
+
+try:
+    Import  # noqa: F821 - defined when PlatformIO runs this as an extra script (SCons)
+except NameError:
+    main()
+else:
+    Import("env")  # noqa: F821
+    run(os.path.join(env.subst("$PROJECT_SRC_DIR"), "ui"))  # noqa: F821
@@ -0,0 +1,421 @@
+"""
+ui_fonts.py - subsets the SquareLine Hebrew fonts to the text the UI shows
+
+SquareLine converts every font with the whole ASCII range and the Hebrew
+alphabet (122 glyphs), while each font only draws a few strings. The full
+exports are kept in UI/fonts; this script writes src/ui/fonts from them with
+only the glyphs of those strings:
+
+  - lv_label_set_text(label, "...") in src/ui/screens/*.c and src/*.cpp, with
+    the font of lv_obj_set_style_text_font(label, &font, ...) in the same file
+    (a label without one adds its text to every font, it may inherit any)
+  - the glyphs of EXTRA_CHARS, for text that is built at run time
+
+Glyph bitmaps, metrics and kerning are copied from the export as they are,
+so the text renders pixel for pixel as before. The characters are mapped
+with one sparse cmap.
+
+Fonts listed in COMPRESS_FONTS are also RLE compressed in LVGL's format
+(LV_USE_FONT_COMPRESSED must be 1). LVGL decompresses a glyph on every draw,
+so those fonts get their bitmaps through ui_font_cache_get_bitmap()
+(src/ui_font_cache.cpp), which keeps the last decompressed glyphs. After
+subsetting both fonts are ~5.5 KB plain and ~2.9 KB compressed, so none is
+compressed by default.
+
+Runs before every firmware build (extra_scripts in platformio.ini); a file is
+only written when its content changes. Standalone:
+
+    python tools/ui_fonts.py            regenerate, print the table
+    python tools/ui_fonts.py --check    only print the table
+"""
+
+import glob
+import os
+import re
+import sys
+
+# Characters kept in a font even if no literal uses them (run-time text),
+# e.g. {"ui_font_Hebrew30": "0123456789%"}
+EXTRA_CHARS = {}
+
+# Fonts stored RLE compressed, e.g. ["ui_font_Hebrew50"]: smaller flash, each
+# glyph decompressed once into the glyph cache (a font should not keep more
+# glyphs than UI_FONT_CACHE_SLOTS)
+COMPRESS_FONTS = []
+
+MARK = " * ui_fonts.py:"
+
+GLYPH_RE = re.compile(r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), "
+                      r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}")
+
+
+class FontError(Exception):
+    pass
+
+
+# ----------------------------------------------------------------------
+# Text used by the UI
+# ----------------------------------------------------------------------
+
+def c_string(lit):
+    out = []
+    i = 0
+    while i < len(lit):
+        c = lit[i]
+        if c == "\\" and i + 1 < len(lit):
+            i += 1
+            out.append({"n": "\n", "t": "\t", "r": "\r", "0": "\0"}.get(lit[i], lit[i]))
+        else:
+            out.append(c)
+        i += 1
+    return "".join(out)
+
+
+def used_text(src_dir, fonts):
+    """Characters per font name"""
+    chars = {f: set(EXTRA_CHARS.get(f, "")) for f in fonts}
+    files = glob.glob(os.path.join(src_dir, "ui", "screens", "*.c")) + glob.glob(os.path.join(src_dir, "*.cpp"))
+    for path in sorted(files):
+        text = open(path, encoding="utf-8").read()
+        font_of = dict(re.findall(r"lv_obj_set_style_text_font\((\w+),\s*&(\w+)", text))
+        for label, lit in re.findall(r"lv_label_set_text(?:_static)?\((\w+),\s*\"((?:[^\"\\]|\\.)*)\"", text):
+            s = set(c_string(lit)) - {"\n", "\r"}
+            s = {" " if c == "\t" else c for c in s}
+            font = font_of.get(label)
+            for f in ([font] if font in chars else fonts if font is None else []):
+                chars[f] |= s
+    return chars
+
+
+# ----------------------------------------------------------------------
+# lv_font_conv C output
+# ----------------------------------------------------------------------
+
+def array_body(text, decl):
+    start = text.index(decl)
+    start = text.index("{", start) + 1
+    end = text.index("};", start)
+    return start, end
+
+
+def parse(text):
+    start, end = array_body(text, "glyph_bitmap[] =")
+    codes = []
+    data = []
+    for line in text[start:end].splitlines():
+        line = line.strip()
+        m = re.match(r"/\* U\+([0-9A-Fa-f]+) ", line)
+        if m:
+            codes.append(int(m.group(1), 16))
+        elif line:
+            data += [int(x, 16) for x in re.findall(r"0x([0-9a-fA-F]+)", line)]
+
+    start, end = array_body(text, "glyph_dsc[] =")
+    glyphs = [tuple(int(x) for x in m) for m in GLYPH_RE.findall(text[start:end])][1:]   # id 0 reserved
+    if len(glyphs) != len(codes):
+        raise FontError("%d glyph descriptors for %d bitmaps" % (len(glyphs), len(codes)))
+
+    bpp = int(re.search(r"\.bpp = (\d+)", text).group(1))
+    fmt = int(re.search(r"\.bitmap_format = (\d+)", text).group(1))
+    if fmt != 0 or re.search(r"\.kern_classes = 1", text):
+        raise FontError("only plain bitmaps and kerning pairs are supported")
+
+    kern = []
+    if "kern_pair_glyph_ids[] =" in text:
+        s, e = array_body(text, "kern_pair_glyph_ids[] =")
+        ids = [int(x) for x in re.findall(r"\d+", text[s:e])]
+        s, e = array_body(text, "kern_pair_values[] =")
+        values = [int(x) for x in re.findall(r"-?\d+", text[s:e])]
+        kern = [(ids[2 * i], ids[2 * i + 1], v) for i, v in enumerate(values)]
+
+    # Plain bitmaps: box_w * box_h pixels, rows not padded
+    bitmaps = []
+    for i, g in enumerate(glyphs):
+        size = (g[2] * g[3] * bpp + 7) // 8
+        bitmaps.append(data[g[0]:g[0] + size])
+    return codes, glyphs, bitmaps, kern, bpp
+
+
+# ----------------------------------------------------------------------
+# LVGL RLE compression (lv_font_fmt_txt.c, decompress())
+# ----------------------------------------------------------------------
+
+class BitWriter:
+    def __init__(self):
+        self.bits = []
+
+    def put(self, value, n):
+        self.bits += [(value >> (n - 1 - i)) & 1 for i in range(n)]
+
+    def bytes(self):
+        b = self.bits + [0] * (-len(self.bits) % 8)
+        return [int("".join(map(str, b[i:i + 8])), 2) for i in range(0, len(b), 8)]
+
+
+def unpack(bitmap, count, bpp):
+    bits = "".join("{:08b}".format(b) for b in bitmap)
+    return [int(bits[i * bpp:(i + 1) * bpp], 2) for i in range(count)]
+
+
+def rle_encode(px, bpp):
+    """Mirror of rle_next(): literal, then after a repeated value 1 bit per
+    pixel (1 = same again), after 11 of those a 6-bit counter"""
+    w = BitWriter()
+    n = len(px)
+    w.put(px[0], bpp)
+    prev = px[0]
+    i = 1
+    repeat = False
+    while i < n:
+        if not repeat:
+            w.put(px[i], bpp)
+            repeat = px[i] == prev
+            prev = px[i]
+            i += 1
+            cnt = 0
+            continue
+        cnt += 1
+        if px[i] != prev:
+            w.put(0, 1)
+            w.put(px[i], bpp)
+            prev = px[i]
+            i += 1
+            repeat = False
+            continue
+        w.put(1, 1)
+        if cnt < 11:
+            i += 1
+            continue
+        run = 1
+        while i + run < n and px[i + run] == prev and run < 63:
+            run += 1
+        w.put(run, 6)          # This pixel and run - 1 more, then a literal
+        i += run
+        if i < n:
+            w.put(px[i], bpp)
+            prev = px[i]
+            i += 1
+        repeat = False
+    return w.bytes()
+
+
+def rle_decode(data, count, bpp):
+    bits = "".join("{:08b}".format(b) for b in data) + "0" * 16
+    rdp = 0
+
+    def get(n):
+        nonlocal rdp
+        v = int(bits[rdp:rdp + n], 2)
+        rdp += n
+        return v
+
+    out = []
+    state, prev, cnt = "single", 0, 0
+    for _ in range(count):
+        if state == "single":
+            ret = get(bpp)
+            if rdp != bpp and prev == ret:
+                cnt, state = 0, "repeat"
+            prev = ret
+        elif state == "repeat":
+            cnt += 1
+            if get(1):
+                ret = prev
+                if cnt == 11:
+                    cnt = get(6)
+                    if cnt:
+                        state = "counter"
+                    else:
+                        ret = prev = get(bpp)
+                        state = "single"
+            else:
+                ret = prev = get(bpp)
+                state = "single"
+        else:
+            ret = prev
+            cnt -= 1
+            if cnt == 0:
+                ret = prev = get(bpp)
+                state = "single"
+        out.append(ret)
+    return out
+
+
+def compress(glyphs, bitmaps, bpp, prefilter):
+    out = []
+    for g, bitmap in zip(glyphs, bitmaps):
+        w, h = g[2], g[3]
+        px = unpack(bitmap, w * h, bpp)
+        if not px:
+            out.append([])
+            continue
+        rows = [px[y * w:(y + 1) * w] for y in range(h)]
+        if prefilter:
+            rows = [rows[0]] + [[a ^ b for a, b in zip(rows[y], rows[y - 1])] for y in range(1, h)]
+        flat = [v for row in rows for v in row]
+        data = rle_encode(flat, bpp)
+        if rle_decode(data, len(flat), bpp) != flat:
+            raise FontError("RLE self-check failed")
+        out.append(data)
+    return out
+
+
+# ----------------------------------------------------------------------
+# Subset font file
+# ----------------------------------------------------------------------
+
+def glyph_comment(code):
+    c = chr(code)
+    return '/* U+%04X "%s" */' % (code, "\\\"" if c == '"' else "\\\\" if c == "\\" else c)
+
+
+def hex_lines(data, indent="    ", per_line=16):
+    return [indent + ", ".join("0x%x" % b for b in data[i:i + per_line]) + ","
+            for i in range(0, len(data), per_line)]
+
+
+def subset(text, name, keep, compress_font):
+    codes, glyphs, bitmaps, kern, bpp = parse(text)
+    missing = sorted(c for c in keep if ord(c) not in codes)
+    if missing:
+        raise FontError("%s has no glyph for %s" % (name, ", ".join("U+%04X" % ord(c) for c in missing)))
+    ids = sorted(codes.index(ord(c)) for c in keep)
+    new_codes = [codes[i] for i in ids]
+    new_glyphs = [glyphs[i] for i in ids]
+    new_bitmaps = [bitmaps[i] for i in ids]
+
+    fmt = 0
+    if compress_font:
+        with_pre = compress(new_glyphs, new_bitmaps, bpp, True)
+        without = compress(new_glyphs, new_bitmaps, bpp, False)
+        fmt, new_bitmaps = min((1, with_pre), (2, without), key=lambda f: sum(map(len, f[1])))
+        new_bitmaps[-1] = new_bitmaps[-1] + [0]    # get_bits() reads one byte ahead
+
+    # Bitmaps
+    lines = []
+    index = []
+    pos = 0
+    for code, bitmap in zip(new_codes, new_bitmaps):
+        lines += ["    " + glyph_comment(code)] + hex_lines(bitmap, per_line=8) + [""]
+        index.append(pos)
+        pos += len(bitmap)
+    start, end = array_body(text, "glyph_bitmap[] =")
+    text = text[:start] + "\n" + "\n".join(lines[:-1]) + "\n" + text[end:]
+
+    # Descriptors
+    dsc = ["    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */"]
+    for i, g in zip(index, new_glyphs):
+        dsc.append("    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}"
+                   % ((i,) + g[1:]))
+    start, end = array_body(text, "glyph_dsc[] =")
+    text = text[:start] + "\n" + ",\n".join(dsc) + "\n" + text[end:]
+
+    # One sparse cmap
+    first = new_codes[0]
+    cmap = ("static const uint16_t unicode_list_0[] = {\n" +
+            "\n".join(hex_lines([c - first for c in new_codes], per_line=8)) + "\n};\n\n"
+            "/*Collect the unicode lists and glyph_id offsets*/\n"
+            "static const lv_font_fmt_txt_cmap_t cmaps[] =\n{\n    {\n"
+            "        .range_start = %d, .range_length = %d, .glyph_id_start = 1,\n"
+            "        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = %d, "
+            ".type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY\n    }\n};"
+            % (first, new_codes[-1] - first + 1, len(new_codes)))
+    start = text.index("/*Collect the unicode lists")
+    while text[start - 1] == "\n":
+        start -= 1
+    start += 2
+    end = text.index("};", text.index("cmaps[] =")) + 2
+    text = text[:start] + cmap + text[end:]
+    text = re.sub(r"\.cmap_num = \d+", ".cmap_num = 1", text)
+
+    # Kerning pairs between the kept glyphs
+    new_id = {old: new + 1 for new, old in enumerate(ids)}      # glyph ids start at 1
+    pairs = [(new_id[l - 1], new_id[r - 1], v) for l, r, v in kern if l - 1 in new_id and r - 1 in new_id]
+    if kern:
+        start = text.index("/*Pair left and right glyphs for kerning*/")
+        end = text.index("};", text.index("lv_font_fmt_txt_kern_pair_t kern_pairs")) + 2
+        if pairs:
+            text = text[:start] + (
+                "/*Pair left and right glyphs for kerning*/\nstatic const uint8_t kern_pair_glyph_ids[] =\n{\n" +
+                ",\n".join("    %d, %d" % (l, r) for l, r, _ in pairs) + "\n};\n\n"
+                "/* Kerning between the respective left and right glyphs\n"
+                " * 4.4 format which needs to scaled with `kern_scale`*/\n"
+                "static const int8_t kern_pair_values[] =\n{\n    " + ", ".join(str(v) for _, _, v in pairs) +
+                "\n};\n\n/*Collect the kern pair's data in one place*/\n"
+                "static const lv_font_fmt_txt_kern_pair_t kern_pairs =\n{\n"
+                "    .glyph_ids = kern_pair_glyph_ids,\n    .values = kern_pair_values,\n"
+                "    .pair_cnt = %d,\n    .glyph_ids_size = 0\n};" % len(pairs)) + text[end:]
+        else:
+            text = text[:start] + "/*No kerning pair between the kept glyphs*/" + text[end:]
+            text = text.replace(".kern_dsc = &kern_pairs,", ".kern_dsc = NULL,")
+
+    text = re.sub(r"\.bitmap_format = \d+", ".bitmap_format = %d" % fmt, text)
+    if fmt:
+        text = text.replace('#include "../ui.h"\n', '#include "../ui.h"\n#include "ui_font_cache.h"\n', 1)
+        text = text.replace(".get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,",
+                            ".get_glyph_bitmap = ui_font_cache_get_bitmap,")
+
+    shown = "".join(chr(c) for c in new_codes).replace("*/", "* /")
+    note = "%s %d of %d glyphs%s: \"%s\"\n" % (MARK, len(ids), len(codes), ", RLE compressed" if fmt else "", shown)
+    text = text.replace(" ******************************************************************************/",
+                        note + " ******************************************************************************/", 1)
+    flash_before = sum(map(len, bitmaps)) + 8 * len(glyphs)
+    flash_after = sum(map(len, new_bitmaps)) + 8 * len(ids) + 2 * len(ids)
+    return text, (name, len(codes), len(ids), fmt, flash_before, flash_after)
+
+
+def run(project_dir, check=False):
+    src_dir = os.path.join(project_dir, "src")
+    full_dir = os.path.join(project_dir, "..", "UI", "fonts")
+    out_paths = sorted(glob.glob(os.path.join(src_dir, "ui", "fonts", "*.c")))
+    names = [os.path.splitext(os.path.basename(p))[0] for p in out_paths]
+    if COMPRESS_FONTS and "#define LV_USE_FONT_COMPRESSED 1" not in open(os.path.join(src_dir, "lv_conf.h")).read():
+        raise FontError("COMPRESS_FONTS needs LV_USE_FONT_COMPRESSED 1 in lv_conf.h")
+    chars = used_text(src_dir, names)
+    slots = int(re.search(r"#define UI_FONT_CACHE_SLOTS\s+\((\d+)\)",
+                          open(os.path.join(src_dir, "ui_font_cache.h")).read()).group(1))
+
+    rows = []
+    changed = False
+    for path, name in zip(out_paths, names):
+        full = os.path.join(full_dir, name + ".c")
+        text = open(full if os.path.exists(full) else path, encoding="utf-8").read()
+        if MARK in text:
+            raise FontError("no full export of %s in UI/fonts" % name)
+        new_text, row = subset(text, name, chars[name], name in COMPRESS_FONTS)
+        rows.append(row)
+        if name in COMPRESS_FONTS and row[2] > slots:
+            print("ui_fonts: warning: %s keeps %d glyphs, more than the %d cache slots; a label using "
+                  "all of them decompresses every glyph on every draw" % (name, row[2], slots))
+        if new_text != open(path, encoding="utf-8").read():
+            changed = True
+            if not check:
+                with open(path, "w", encoding="utf-8", newline="\n") as f:
+                    f.write(new_text)
+
+    if changed or check:
+        print("ui_fonts: %s" % ("would write" if check and changed else "up to date" if check else "written"))
+        for name, total, kept, fmt, before, after in rows:
+            print("  %-18s %3d -> %3d glyphs  %-10s %6d -> %6d bytes" %
+                  (name, total, kept, "compressed" if fmt else "plain", before, after))
+    return rows
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    try:
+        run(os.path.join(here, ".."), check="--check" in sys.argv)
+    except FontError as e:
+        sys.exit("ui_fonts: %s" % e)
+
+
+try:
+    Import  # noqa: F821 - defined when PlatformIO runs this as an extra script (SCons)
+except NameError:
+    main()
+else:
+    Import("env")  # noqa: F821
+    try:
+        run(env.subst("$PROJECT_DIR"))  # noqa: F821
+    except FontError as e:
+        sys.exit("ui_fonts: %s" % e)
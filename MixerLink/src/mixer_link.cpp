@@ -0,0 +1,247 @@
+#include "mixer_link.h"
+#include <string.h>
+
+// ======================================================================
+// CRC-16/CCITT-FALSE (table-less, 8 bits per step)
+// ======================================================================
+
+uint16_t mixer_link_crc16(const uint8_t *data, size_t len, uint16_t crc)
+{
+    for (size_t i = 0; i < len; i++) {
+        uint8_t x = (uint8_t)((crc >> 8) ^ data[i]);
+        x ^= x >> 4;
+        crc = (uint16_t)((crc << 8) ^ ((uint16_t)x << 12) ^ ((uint16_t)x << 5) ^ x);
+    }
+    return crc;
+}
+
+// ======================================================================
+// Encode / Decode
+// ======================================================================
+
+size_t mixer_link_encode(const MixerLinkFrame &frame, uint8_t *out, size_t out_size)
+{
+    if (frame.len > MIXER_LINK_MAX_PAYLOAD) return 0;
+
+    size_t total = MIXER_LINK_HEADER_SIZE + frame.len + MIXER_LINK_CRC_SIZE;
+    if (!out || out_size < total) return 0;
+
+    out[0] = MIXER_LINK_SYNC;
+    out[1] = MIXER_LINK_VERSION;
+    out[2] = frame.type;
+    out[3] = frame.seq;
+    out[4] = frame.len;
+    memcpy(&out[MIXER_LINK_HEADER_SIZE], frame.payload, frame.len);
+
+    // CRC covers everything after the sync byte
+    uint16_t crc = mixer_link_crc16(&out[1], MIXER_LINK_HEADER_SIZE - 1 + frame.len);
+    out[total - 2] = (uint8_t)(crc & 0xFF);
+    out[total - 1] = (uint8_t)(crc >> 8);
+
+    return total;
+}
+
+MixerLinkResult mixer_link_decode(const uint8_t *in, size_t len, MixerLinkFrame &frame, size_t *consumed)
+{
+    if (len < 1) return MIXER_LINK_ERR_SHORT;
+    if (in[0] != MIXER_LINK_SYNC) return MIXER_LINK_ERR_SYNC;
+    if (len < 2) return MIXER_LINK_ERR_SHORT;
+    if (in[1] != MIXER_LINK_VERSION) return MIXER_LINK_ERR_VERSION;
+    if (len < MIXER_LINK_HEADER_SIZE) return MIXER_LINK_ERR_SHORT;
+
+    uint8_t payload_len = in[4];
+    if (payload_len > MIXER_LINK_MAX_PAYLOAD) return MIXER_LINK_ERR_LENGTH;
+
+    size_t total = MIXER_LINK_HEADER_SIZE + payload_len + MIXER_LINK_CRC_SIZE;
+    if (len < total) return MIXER_LINK_ERR_SHORT;
+
+    uint16_t expected = mixer_link_crc16(&in[1], MIXER_LINK_HEADER_SIZE - 1 + payload_len);
+    uint16_t received = (uint16_t)(in[total - 2] | (in[total - 1] << 8));
+    if (expected != received) return MIXER_LINK_ERR_CRC;
+
+    frame.type = in[2];
+    frame.seq = in[3];
+    frame.len = payload_len;
+    memcpy(frame.payload, &in[MIXER_LINK_HEADER_SIZE], payload_len);
+
+    if (consumed) *consumed = total;
+    return MIXER_LINK_OK;
+}
+
+const char *mixer_link_result_str(MixerLinkResult result)
+{
+    switch (result) {
+        case MIXER_LINK_OK:          return "OK";
+        case MIXER_LINK_ERR_SHORT:   return "short";
+        case MIXER_LINK_ERR_SYNC:    return "bad sync";
+        case MIXER_LINK_ERR_VERSION: return "bad version";
+        case MIXER_LINK_ERR_LENGTH:  return "bad length";
+        case MIXER_LINK_ERR_CRC:     return "bad CRC";
+    }
+    return "?";
+}
+
+// ======================================================================
+// Payload helpers
+// ======================================================================
+
+void mixer_link_make_state(MixerLinkFrame &frame, uint8_t seq, const MixerLinkState &state)
+{
+    frame.type = MIXER_LINK_TYPE_STATE;
+    frame.seq = seq;
+    frame.len = 3;
+    frame.payload[0] = state.music_volume;
+    frame.payload[1] = state.mic_volume;
+    frame.payload[2] = (state.music_relay ? MIXER_LINK_RELAY_MUSIC : 0) |
+                       (state.mic_relay ? MIXER_LINK_RELAY_MIC : 0);
+}
+
+bool mixer_link_parse_state(const MixerLinkFrame &frame, MixerLinkState &state)
+{
+    if (frame.type != MIXER_LINK_TYPE_STATE || frame.len < 3) return false;
+    // Clamp: a valid CRC does not make the sender's values sane
+    state.music_volume = frame.payload[0] > 100 ? 100 : frame.payload[0];
+    state.mic_volume = frame.payload[1] > 100 ? 100 : frame.payload[1];
+    state.music_relay = (frame.payload[2] & MIXER_LINK_RELAY_MUSIC) != 0;
+    state.mic_relay = (frame.payload[2] & MIXER_LINK_RELAY_MIC) != 0;
+    return true;
+}
+
+void mixer_link_make_power(MixerLinkFrame &frame, uint8_t seq, bool on)
+{
+    frame.type = MIXER_LINK_TYPE_POWER;
+    frame.seq = seq;
+    frame.len = 1;
+    frame.payload[0] = on ? 1 : 0;
+}
+
+bool mixer_link_parse_power(const MixerLinkFrame &frame, bool &on)
+{
+    if (frame.type != MIXER_LINK_TYPE_POWER || frame.len < 1) return false;
+    on = frame.payload[0] != 0;
+    return true;
+}
+
+void mixer_link_make_get(MixerLinkFrame &frame, uint8_t seq)
+{
+    frame.type = MIXER_LINK_TYPE_GET;
+    frame.seq = seq;
+    frame.len = 0;
+}
+
+void mixer_link_make_delta(MixerLinkFrame &frame, uint8_t seq, uint8_t mask, const MixerLinkState &state)
+{
+    frame.type = MIXER_LINK_TYPE_DELTA;
+    frame.seq = seq;
+    frame.len = 0;
+    frame.payload[frame.len++] = mask & MIXER_LINK_FIELD_ALL;
+    if (mask & MIXER_LINK_FIELD_MUSIC_VOL) frame.payload[frame.len++] = state.music_volume;
+    if (mask & MIXER_LINK_FIELD_MIC_VOL) frame.payload[frame.len++] = state.mic_volume;
+    if (mask & MIXER_LINK_FIELD_RELAYS) {
+        frame.payload[frame.len++] = (state.music_relay ? MIXER_LINK_RELAY_MUSIC : 0) |
+                                     (state.mic_relay ? MIXER_LINK_RELAY_MIC : 0);
+    }
+}
+
+bool mixer_link_parse_delta(const MixerLinkFrame &frame, uint8_t &mask, MixerLinkState &state)
+{
+    if (frame.type != MIXER_LINK_TYPE_DELTA || frame.len < 1) return false;
+    mask = frame.payload[0];
+    if (mask & ~MIXER_LINK_FIELD_ALL) return false;   // Unknown field, layout unknown too
+
+    uint8_t pos = 1;
+    if (mask & MIXER_LINK_FIELD_MUSIC_VOL) {
+        if (pos >= frame.len) return false;
+        state.music_volume = frame.payload[pos] > 100 ? 100 : frame.payload[pos];
+        pos++;
+    }
+    if (mask & MIXER_LINK_FIELD_MIC_VOL) {
+        if (pos >= frame.len) return false;
+        state.mic_volume = frame.payload[pos] > 100 ? 100 : frame.payload[pos];
+        pos++;
+    }
+    if (mask & MIXER_LINK_FIELD_RELAYS) {
+        if (pos >= frame.len) return false;
+        state.music_relay = (frame.payload[pos] & MIXER_LINK_RELAY_MUSIC) != 0;
+        state.mic_relay = (frame.payload[pos] & MIXER_LINK_RELAY_MIC) != 0;
+        pos++;
+    }
+    return true;
+}
+
+uint8_t mixer_link_state_diff(const MixerLinkState &a, const MixerLinkState &b)
+{
+    uint8_t mask = 0;
+    if (a.music_volume != b.music_volume) mask |= MIXER_LINK_FIELD_MUSIC_VOL;
+    if (a.mic_volume != b.mic_volume) mask |= MIXER_LINK_FIELD_MIC_VOL;
+    if (a.music_relay != b.music_relay || a.mic_relay != b.mic_relay) mask |= MIXER_LINK_FIELD_RELAYS;
+    return mask;
+}
+
+void mixer_link_make_ack(MixerLinkFrame &frame, uint8_t seq)
+{
+    frame.type = MIXER_LINK_TYPE_ACK;
+    frame.seq = seq;
+    frame.len = 0;
+}
+
+void mixer_link_make_nak(MixerLinkFrame &frame, uint8_t first_missing, uint8_t count)
+{
+    frame.type = MIXER_LINK_TYPE_NAK;
+    frame.seq = first_missing;
+    frame.len = 1;
+    frame.payload[0] = count;
+}
+
+bool mixer_link_parse_nak(const MixerLinkFrame &frame, uint8_t &first_missing, uint8_t &count)
+{
+    if (frame.type != MIXER_LINK_TYPE_NAK || frame.len < 1) return false;
+    first_missing = frame.seq;
+    count = frame.payload[0];
+    return true;
+}
+
+// TELEMETRY payload: [applied seq][mv][cv][relays][flags][i2c L H][loop max L H][loop avg L H]
+#define MIXER_LINK_TELEMETRY_LEN (11)
+
+static void put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static uint16_t get_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+void mixer_link_make_telemetry(MixerLinkFrame &frame, uint8_t seq, const MixerLinkTelemetry &tlm)
+{
+    frame.type = MIXER_LINK_TYPE_TELEMETRY;
+    frame.seq = seq;
+    frame.len = MIXER_LINK_TELEMETRY_LEN;
+    frame.payload[0] = tlm.applied_seq;
+    frame.payload[1] = tlm.state.music_volume;
+    frame.payload[2] = tlm.state.mic_volume;
+    frame.payload[3] = (tlm.state.music_relay ? MIXER_LINK_RELAY_MUSIC : 0) |
+                       (tlm.state.mic_relay ? MIXER_LINK_RELAY_MIC : 0);
+    frame.payload[4] = tlm.flags;
+    put_u16(&frame.payload[5], tlm.i2c_errors);
+    put_u16(&frame.payload[7], tlm.loop_max_us);
+    put_u16(&frame.payload[9], tlm.loop_avg_us);
+}
+
+bool mixer_link_parse_telemetry(const MixerLinkFrame &frame, MixerLinkTelemetry &tlm)
+{
+    if (frame.type != MIXER_LINK_TYPE_TELEMETRY || frame.len < MIXER_LINK_TELEMETRY_LEN) return false;
+    tlm.applied_seq = frame.payload[0];
+    tlm.state.music_volume = frame.payload[1];
+    tlm.state.mic_volume = frame.payload[2];
+    tlm.state.music_relay = (frame.payload[3] & MIXER_LINK_RELAY_MUSIC) != 0;
+    tlm.state.mic_relay = (frame.payload[3] & MIXER_LINK_RELAY_MIC) != 0;
+    tlm.flags = frame.payload[4];
+    tlm.i2c_errors = get_u16(&frame.payload[5]);
+    tlm.loop_max_us = get_u16(&frame.payload[7]);
+    tlm.loop_avg_us = get_u16(&frame.payload[9]);
+    return true;
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+/*
+ * MixerLink - binary RS485 frame codec (Controller <-> Body)
+ *
+ * Wire layout (little-endian CRC):
+ *   [SYNC 0xA5][VER][TYPE][SEQ][LEN][PAYLOAD 0..LEN-1][CRC16 L][CRC16 H]
+ *
+ * CRC16 is CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) over VER..PAYLOAD.
+ * Plain C++ with no Arduino dependencies so it also builds on the host.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ---- Frame layout ----
+#define MIXER_LINK_SYNC          (0xA5)
+#define MIXER_LINK_VERSION       (1)
+#define MIXER_LINK_HEADER_SIZE   (5)     // SYNC, VER, TYPE, SEQ, LEN
+#define MIXER_LINK_CRC_SIZE      (2)
+#define MIXER_LINK_MAX_PAYLOAD   (16)
+#define MIXER_LINK_MAX_FRAME     (MIXER_LINK_HEADER_SIZE + MIXER_LINK_MAX_PAYLOAD + MIXER_LINK_CRC_SIZE)
+
+// ---- Frame types ----
+enum MixerLinkType : uint8_t {
+    MIXER_LINK_TYPE_STATE = 0x01,   // Full state: music vol, mic vol, relay bits
+    MIXER_LINK_TYPE_POWER = 0x02,   // Power command: 0 = shutdown
+    MIXER_LINK_TYPE_GET   = 0x03,   // Body: request a full state frame, controller: request TELEMETRY
+    MIXER_LINK_TYPE_DELTA = 0x04,   // Changed fields only: [mask][fields in mask bit order]
+    MIXER_LINK_TYPE_ACK   = 0x05,   // Body -> controller, SEQ = accepted frame, no payload
+    MIXER_LINK_TYPE_NAK   = 0x06,   // Body -> controller, SEQ = first missing frame, [count]
+    MIXER_LINK_TYPE_TELEMETRY = 0x07,   // Body -> controller, applied hardware state (see below)
+};
+
+// ---- Decode results ----
+enum MixerLinkResult {
+    MIXER_LINK_OK = 0,
+    MIXER_LINK_ERR_SHORT,     // Not enough bytes for a complete frame (yet)
+    MIXER_LINK_ERR_SYNC,      // First byte is not MIXER_LINK_SYNC
+    MIXER_LINK_ERR_VERSION,   // Unknown protocol version
+    MIXER_LINK_ERR_LENGTH,    // LEN exceeds MIXER_LINK_MAX_PAYLOAD
+    MIXER_LINK_ERR_CRC,       // CRC mismatch
+};
+
+// Relay bits in the STATE payload
+#define MIXER_LINK_RELAY_MUSIC   (1 << 0)
+#define MIXER_LINK_RELAY_MIC     (1 << 1)
+
+// Field bits in the DELTA mask
+#define MIXER_LINK_FIELD_MUSIC_VOL  (1 << 0)
+#define MIXER_LINK_FIELD_MIC_VOL    (1 << 1)
+#define MIXER_LINK_FIELD_RELAYS     (1 << 2)
+#define MIXER_LINK_FIELD_ALL        (MIXER_LINK_FIELD_MUSIC_VOL | MIXER_LINK_FIELD_MIC_VOL | MIXER_LINK_FIELD_RELAYS)
+#define MIXER_LINK_FIELD_COUNT      (3)
+
+// Flag bits in the TELEMETRY payload
+#define MIXER_LINK_TLM_BT_ACTIVE    (1 << 0)    // A2DP sink started (music relay on Bluetooth)
+#define MIXER_LINK_TLM_BT_CONNECTED (1 << 1)    // A2DP source connected
+#define MIXER_LINK_TLM_SLEEPING     (1 << 2)    // Shut down by a POWER frame
+#define MIXER_LINK_TLM_RAMPING      (1 << 3)    // Volume ramp or relay fade in progress
+#define MIXER_LINK_TLM_RELAY_FADE   (1 << 4)    // Body fades relay switches itself: no controller mute sequence
+
+// ---- Half-duplex reply slot ----
+// The body only transmits in reply to a controller frame: it may start up to
+// MIXER_LINK_REPLY_START_US after that frame was received, and the controller
+// keeps the bus free for MIXER_LINK_REPLY_SLOT_US after each frame it sends.
+#define MIXER_LINK_REPLY_START_US   (5000)
+#define MIXER_LINK_REPLY_SLOT_US    (10000)
+
+struct MixerLinkFrame {
+    uint8_t type;
+    uint8_t seq;
+    uint8_t len;
+    uint8_t payload[MIXER_LINK_MAX_PAYLOAD];
+};
+
+// Decoded STATE payload (volumes are final values 0-100, after the main fader)
+struct MixerLinkState {
+    uint8_t music_volume;
+    uint8_t mic_volume;
+    bool music_relay;
+    bool mic_relay;
+};
+
+// Decoded TELEMETRY payload: what the body hardware actually does
+struct MixerLinkTelemetry {
+    uint8_t applied_seq;        // Last controller frame applied
+    MixerLinkState state;       // Relays as driven, volumes the PT2258 is at or ramping to
+    uint8_t flags;              // MIXER_LINK_TLM_*
+    uint16_t i2c_errors;        // PT2258 writes not acknowledged, since boot (saturating)
+    uint16_t loop_max_us;       // Longest loop() pass since the previous telemetry
+    uint16_t loop_avg_us;
+};
+
+// ---- Codec ----
+uint16_t mixer_link_crc16(const uint8_t *data, size_t len, uint16_t crc = 0xFFFF);
+
+// Returns the number of bytes written to `out`, or 0 if it does not fit / LEN is invalid
+size_t mixer_link_encode(const MixerLinkFrame &frame, uint8_t *out, size_t out_size);
+
+// Decodes one frame starting at `in[0]`. On success `*consumed` is the frame size.
+MixerLinkResult mixer_link_decode(const uint8_t *in, size_t len, MixerLinkFrame &frame, size_t *consumed = nullptr);
+
+const char *mixer_link_result_str(MixerLinkResult result);
+
+// ---- Payload helpers ----
+void mixer_link_make_state(MixerLinkFrame &frame, uint8_t seq, const MixerLinkState &state);
+bool mixer_link_parse_state(const MixerLinkFrame &frame, MixerLinkState &state);
+void mixer_link_make_power(MixerLinkFrame &frame, uint8_t seq, bool on);
+bool mixer_link_parse_power(const MixerLinkFrame &frame, bool &on);
+void mixer_link_make_get(MixerLinkFrame &frame, uint8_t seq);
+
+// DELTA: only the fields in `mask` are sent / valid in `state`
+void mixer_link_make_delta(MixerLinkFrame &frame, uint8_t seq, uint8_t mask, const MixerLinkState &state);
+bool mixer_link_parse_delta(const MixerLinkFrame &frame, uint8_t &mask, MixerLinkState &state);
+uint8_t mixer_link_state_diff(const MixerLinkState &a, const MixerLinkState &b);
+
+void mixer_link_make_ack(MixerLinkFrame &frame, uint8_t seq);
+void mixer_link_make_nak(MixerLinkFrame &frame, uint8_t first_missing, uint8_t count);
+bool mixer_link_parse_nak(const MixerLinkFrame &frame, uint8_t &first_missing, uint8_t &count);
+
+void mixer_link_make_telemetry(MixerLinkFrame &frame, uint8_t seq, const MixerLinkTelemetry &tlm);
+bool mixer_link_parse_telemetry(const MixerLinkFrame &frame, MixerLinkTelemetry &tlm);
+
+// ---- Sequence numbers (8-bit, wrap-around) ----
+// True if `a` was sent after `b`, valid while they are less than 128 frames apart
+inline bool mixer_link_seq_newer(uint8_t a, uint8_t b) { return (int8_t)(a - b) > 0; }
@@ -0,0 +1,41 @@
+#pragma once
+
+/*
+ * MixerLinkHistogram - fixed-bucket latency histogram (microseconds)
+ * Header-only, no allocation, safe to record from a single task.
+ */
+
+#include <stdint.h>
+
+#define MIXER_LINK_HIST_BUCKETS  (10)
+
+class MixerLinkHistogram {
+public:
+    // Upper bound (exclusive) of bucket `i` in microseconds, the last bucket is open-ended
+    static uint32_t bound(uint32_t i)
+    {
+        static const uint32_t bounds[MIXER_LINK_HIST_BUCKETS - 1] = {
+            100, 250, 500, 1000, 2000, 5000, 10000, 20000, 50000
+        };
+        return i < MIXER_LINK_HIST_BUCKETS - 1 ? bounds[i] : UINT32_MAX;
+    }
+
+    void record(uint32_t us)
+    {
+        uint32_t i = 0;
+        while (i < MIXER_LINK_HIST_BUCKETS - 1 && us >= bound(i)) i++;
+        counts[i]++;
+        total++;
+        sum_us += us;
+        if (us > max_us) max_us = us;
+    }
+
+    void reset() { *this = MixerLinkHistogram(); }
+
+    uint32_t avg_us() const { return total ? (uint32_t)(sum_us / total) : 0; }
+
+    uint32_t counts[MIXER_LINK_HIST_BUCKETS] = {};
+    uint32_t total = 0;
+    uint32_t max_us = 0;
+    uint64_t sum_us = 0;
+};
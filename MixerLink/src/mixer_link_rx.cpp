@@ -0,0 +1,192 @@
+#include "mixer_link_rx.h"
+#include <string.h>
+
+static_assert((MIXER_LINK_RX_RING_SIZE & (MIXER_LINK_RX_RING_SIZE - 1)) == 0,
+              "MIXER_LINK_RX_RING_SIZE must be a power of two");
+
+// ======================================================================
+// Producer side
+// ======================================================================
+
+size_t MixerLinkRx::feed(const uint8_t *data, size_t len)
+{
+    size_t produced = 0;
+    for (size_t i = 0; i < len; i++) {
+        produced += feedByte(data[i]);
+    }
+    return produced;
+}
+
+size_t MixerLinkRx::feedByte(uint8_t byte)
+{
+    // ---- Binary frame (in progress, or a new SYNC) ----
+    if (_pos > 0 || byte == MIXER_LINK_SYNC) {
+        if (_in_line) {
+            // A SYNC in the middle of a text line: the line was noise
+            _stats.dropped_bytes += _line_len;
+            _in_line = false;
+        }
+        _buf[_pos++] = byte;
+        return checkCandidate();
+    }
+
+    return lineByte(byte);
+}
+
+// JSON fallback line, bytes outside any binary candidate
+size_t MixerLinkRx::lineByte(uint8_t byte)
+{
+    if (byte == '\n') {
+        size_t produced = 0;
+        if (_in_line && _line_overflow) {
+            _stats.line_overflows++;
+        } else if (_in_line && _line_len > 0) {
+            MixerLinkMessage *msg = beginPush();
+            if (msg) {
+                msg->kind = MIXER_LINK_MSG_LINE;
+                memcpy(msg->line, _line, _line_len);
+                msg->line[_line_len] = '\0';
+                commitPush();
+                _stats.lines++;
+                produced = 1;
+            }
+        }
+        _in_line = false;
+        return produced;
+    }
+    if (byte == '\r') return 0;
+
+    if (!_in_line) {
+        // Lines start on printable ASCII only, anything else is noise
+        if (byte < 0x20 || byte > 0x7E) {
+            _stats.dropped_bytes++;
+            return 0;
+        }
+        _in_line = true;
+        _line_len = 0;
+        _line_overflow = false;
+    }
+    if (_line_len < MIXER_LINK_MAX_LINE) {
+        _line[_line_len++] = (char)byte;
+    } else {
+        _line_overflow = true;
+    }
+    return 0;
+}
+
+// Validates the candidate prefix in _buf, emits complete frames and
+// rescans after failures. Bounded by MIXER_LINK_MAX_FRAME per byte fed.
+size_t MixerLinkRx::checkCandidate()
+{
+    size_t produced = 0;
+
+    while (_pos > 0) {
+        if (_buf[0] != MIXER_LINK_SYNC) {
+            produced += releaseCandidate(0);
+            continue;
+        }
+        if (_pos >= 2 && _buf[1] != MIXER_LINK_VERSION) {
+            _stats.header_errors++;
+            produced += releaseCandidate(1);
+            continue;
+        }
+        if (_pos < MIXER_LINK_HEADER_SIZE) break;
+
+        if (_buf[4] > MIXER_LINK_MAX_PAYLOAD) {
+            _stats.header_errors++;
+            produced += releaseCandidate(1);
+            continue;
+        }
+
+        size_t total = MIXER_LINK_HEADER_SIZE + _buf[4] + MIXER_LINK_CRC_SIZE;
+        if (_pos < total) break;
+
+        MixerLinkMessage *msg = beginPush();
+        MixerLinkFrame scratch;
+        MixerLinkFrame &frame = msg ? msg->frame : scratch;
+        if (mixer_link_decode(_buf, total, frame) != MIXER_LINK_OK) {
+            _stats.crc_errors++;
+            produced += releaseCandidate(1);
+            continue;
+        }
+        if (msg) {
+            msg->kind = MIXER_LINK_MSG_FRAME;
+            commitPush();
+            produced++;
+        }
+        _stats.frames++;
+
+        // Keep whatever followed the frame (only happens after a rescan)
+        _pos -= total;
+        memmove(_buf, &_buf[total], _pos);
+    }
+
+    return produced;
+}
+
+// Drops the first `from` bytes of the candidate (the false SYNC) and hands
+// the bytes up to the next SYNC back to the line parser: a line may start
+// there, right after a torn frame or noise
+size_t MixerLinkRx::releaseCandidate(size_t from)
+{
+    size_t next = from;
+    while (next < _pos && _buf[next] != MIXER_LINK_SYNC) next++;
+
+    _stats.dropped_bytes += from;
+    size_t produced = 0;
+    for (size_t i = from; i < next; i++) produced += lineByte(_buf[i]);
+    if (next < _pos && _in_line) {
+        _stats.dropped_bytes += _line_len;      // A SYNC follows: that line was noise
+        _in_line = false;
+    }
+
+    _pos -= next;
+    memmove(_buf, &_buf[next], _pos);
+    return produced;
+}
+
+MixerLinkMessage *MixerLinkRx::beginPush()
+{
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    uint32_t tail = _tail.load(std::memory_order_acquire);
+    if (head - tail >= MIXER_LINK_RX_RING_SIZE) {
+        _stats.ring_overruns++;
+        return nullptr;
+    }
+    return &_ring[head & (MIXER_LINK_RX_RING_SIZE - 1)];
+}
+
+void MixerLinkRx::commitPush()
+{
+    _head.store(_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+// ======================================================================
+// Consumer side
+// ======================================================================
+
+bool MixerLinkRx::pop(MixerLinkMessage &msg)
+{
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head.load(std::memory_order_acquire)) return false;
+
+    msg = _ring[tail & (MIXER_LINK_RX_RING_SIZE - 1)];
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool MixerLinkRx::empty() const
+{
+    return _tail.load(std::memory_order_acquire) == _head.load(std::memory_order_acquire);
+}
+
+void MixerLinkRx::reset()
+{
+    _pos = 0;
+    _in_line = false;
+    _line_len = 0;
+    _line_overflow = false;
+    _head.store(0, std::memory_order_relaxed);
+    _tail.store(0, std::memory_order_relaxed);
+    _stats = {};
+}
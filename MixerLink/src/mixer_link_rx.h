@@ -0,0 +1,81 @@
+#pragma once
+
+/*
+ * MixerLinkRx - incremental RS485 receiver
+ *
+ * Bytes are fed in any chunking (single bytes, torn or split frames,
+ * line noise). Complete binary frames and JSON fallback lines are pushed
+ * into a fixed single-producer/single-consumer ring, so the UART side
+ * (loop or an event task) and the application side never block each
+ * other and nothing is allocated.
+ *
+ * Resync: a binary candidate that fails validation is rescanned from the
+ * next SYNC byte inside it, so a false SYNC in noise cannot swallow a
+ * real frame that follows. The bytes before that SYNC go back to the line
+ * parser, so it cannot swallow the start of a line either.
+ */
+
+#include <atomic>
+#include "mixer_link.h"
+
+#define MIXER_LINK_MAX_LINE      (64)    // JSON fallback line, without '\n'
+#define MIXER_LINK_RX_RING_SIZE  (8)     // Messages, must be a power of two
+
+enum MixerLinkMessageKind : uint8_t {
+    MIXER_LINK_MSG_FRAME = 0,
+    MIXER_LINK_MSG_LINE,
+};
+
+struct MixerLinkMessage {
+    MixerLinkMessageKind kind;
+    MixerLinkFrame frame;                 // Valid when kind == MIXER_LINK_MSG_FRAME
+    char line[MIXER_LINK_MAX_LINE + 1];   // NUL-terminated, valid when kind == MIXER_LINK_MSG_LINE
+};
+
+struct MixerLinkRxStats {
+    uint32_t frames;          // Valid binary frames
+    uint32_t lines;           // JSON fallback lines
+    uint32_t crc_errors;
+    uint32_t header_errors;   // Bad version or length
+    uint32_t dropped_bytes;   // Noise outside any frame/line
+    uint32_t line_overflows;
+    uint32_t ring_overruns;   // Messages lost because the consumer fell behind
+};
+
+class MixerLinkRx {
+public:
+    // Producer side (UART reader). Returns the number of messages queued.
+    size_t feed(const uint8_t *data, size_t len);
+    size_t feed(uint8_t byte) { return feed(&byte, 1); }
+
+    // Consumer side (application)
+    bool pop(MixerLinkMessage &msg);
+    bool empty() const;
+
+    void reset();
+    const MixerLinkRxStats &stats() const { return _stats; }
+
+private:
+    // Binary candidate being assembled (linear, so it can be rescanned)
+    uint8_t _buf[MIXER_LINK_MAX_FRAME];
+    size_t _pos = 0;
+
+    // JSON fallback line being assembled
+    char _line[MIXER_LINK_MAX_LINE + 1];
+    size_t _line_len = 0;
+    bool _in_line = false;
+    bool _line_overflow = false;
+
+    MixerLinkMessage _ring[MIXER_LINK_RX_RING_SIZE];
+    std::atomic<uint32_t> _head{0};   // Written by producer
+    std::atomic<uint32_t> _tail{0};   // Written by consumer
+
+    MixerLinkRxStats _stats = {};
+
+    size_t feedByte(uint8_t byte);
+    size_t lineByte(uint8_t byte);
+    size_t checkCandidate();
+    size_t releaseCandidate(size_t from);
+    MixerLinkMessage *beginPush();
+    void commitPush();
+};
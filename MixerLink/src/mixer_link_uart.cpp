@@ -0,0 +1,146 @@
+#include "mixer_link_uart.h"
+
+#if defined(ESP_PLATFORM)
+
+#include <esp_timer.h>
+#include <esp_idf_version.h>
+
+// ======================================================================
+// Setup
+// ======================================================================
+
+bool MixerLinkUart::begin(uart_port_t port, int baud, int rx_pin, int tx_pin, BaseType_t core,
+                          int de_pin)
+{
+    _port = port;
+
+    uart_config_t config = {};
+    config.baud_rate = baud;
+    config.data_bits = UART_DATA_8_BITS;
+    config.parity = UART_PARITY_DISABLE;
+    config.stop_bits = UART_STOP_BITS_1;
+    config.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
+#if ESP_IDF_VERSION_MAJOR >= 5
+    config.source_clk = UART_SCLK_DEFAULT;
+#else
+    config.source_clk = UART_SCLK_APB;
+#endif
+
+    if (uart_driver_install(port, MIXER_LINK_UART_RX_BUF, MIXER_LINK_UART_TX_BUF,
+                            MIXER_LINK_UART_EVENT_QUEUE, &_events, 0) != ESP_OK) {
+        return false;
+    }
+    uart_param_config(port, &config);
+    uart_set_pin(port, tx_pin, rx_pin, de_pin, UART_PIN_NO_CHANGE);   // RTS drives DE
+    if (de_pin != UART_PIN_NO_CHANGE) {
+        uart_set_mode(port, UART_MODE_RS485_HALF_DUPLEX);
+    }
+
+    // End-of-burst event for binary frames
+    uart_set_rx_timeout(port, MIXER_LINK_UART_RX_TIMEOUT);
+
+    // Immediate wake on the JSON line delimiter
+    uart_enable_pattern_det_baud_intr(port, '\n', 1, 9, 0, 0);
+    uart_pattern_queue_reset(port, MIXER_LINK_UART_EVENT_QUEUE);
+
+    _messages = xQueueCreate(MIXER_LINK_UART_MSG_QUEUE, sizeof(MixerLinkRxItem));
+    if (!_messages) return false;
+
+    return xTaskCreatePinnedToCore(taskEntry, "link_rx", MIXER_LINK_UART_TASK_STACK, this,
+                                   MIXER_LINK_UART_TASK_PRIORITY, &_task, core) == pdPASS;
+}
+
+size_t MixerLinkUart::write(const uint8_t *data, size_t len)
+{
+    int written = uart_write_bytes(_port, (const char *)data, len);
+    return written > 0 ? (size_t)written : 0;
+}
+
+// ======================================================================
+// Application side
+// ======================================================================
+
+bool MixerLinkUart::receive(MixerLinkRxItem &item, TickType_t timeout)
+{
+    if (!_messages) return false;
+    return xQueueReceive(_messages, &item, timeout) == pdTRUE;
+}
+
+void MixerLinkUart::markHandled(const MixerLinkRxItem &item)
+{
+    _latency.record((uint32_t)(esp_timer_get_time() - item.rx_time_us));
+}
+
+// ======================================================================
+// RX task
+// ======================================================================
+
+void MixerLinkUart::taskEntry(void *arg)
+{
+    static_cast<MixerLinkUart *>(arg)->taskLoop();
+}
+
+void MixerLinkUart::taskLoop()
+{
+    uart_event_t event;
+
+    while (1) {
+        if (xQueueReceive(_events, &event, portMAX_DELAY) != pdTRUE) continue;
+        int64_t now = esp_timer_get_time();
+        _stats.events++;
+
+        switch (event.type) {
+            case UART_PATTERN_DET:
+                // Positions are not needed (the parser finds the '\n'), just keep the queue empty
+                uart_pattern_pop_pos(_port);
+                drain(now);
+                break;
+            case UART_DATA:
+                drain(now);
+                break;
+            case UART_FIFO_OVF:
+            case UART_BUFFER_FULL:
+                _stats.fifo_overflows++;
+                uart_flush_input(_port);
+                xQueueReset(_events);
+                uart_pattern_queue_reset(_port, MIXER_LINK_UART_EVENT_QUEUE);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void MixerLinkUart::drain(int64_t now)
+{
+    uint8_t chunk[64];
+    size_t buffered = 0;
+    uart_get_buffered_data_len(_port, &buffered);
+
+    while (buffered > 0) {
+        int n = uart_read_bytes(_port, chunk, buffered < sizeof(chunk) ? buffered : sizeof(chunk), 0);
+        if (n <= 0) break;
+
+        int64_t t0 = esp_timer_get_time();
+        _parser.feed(chunk, n);
+        uint32_t dt = (uint32_t)(esp_timer_get_time() - t0);
+        if (dt > _stats.worst_feed_us) _stats.worst_feed_us = dt;
+
+        buffered -= n;
+    }
+
+    MixerLinkRxItem item;
+    bool posted = false;
+    while (_parser.pop(item.msg)) {
+        item.rx_time_us = now;
+        if (xQueueSend(_messages, &item, 0) != pdTRUE) {
+            _stats.queue_drops++;
+        } else {
+            posted = true;
+        }
+    }
+
+    if (posted && _notify) xTaskNotifyGive(_notify);
+}
+
+#endif // ESP_PLATFORM
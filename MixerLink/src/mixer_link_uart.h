@@ -0,0 +1,87 @@
+#pragma once
+
+/*
+ * MixerLinkUart - event-driven RS485 receiver for ESP32 (ESP-IDF UART driver)
+ *
+ * A dedicated RX task blocks on the UART driver event queue and wakes on:
+ *   - UART_PATTERN_DET: '\n' terminating a JSON fallback line
+ *   - UART_DATA:        RX timeout after a burst (2 symbol times), which ends
+ *                       a binary frame since it has no delimiter byte
+ * Received bytes go through MixerLinkRx; complete messages are posted to a
+ * FreeRTOS queue with their RX timestamp. The application blocks on
+ * receive() instead of polling, so wire-to-action latency no longer
+ * depends on a loop tick.
+ */
+
+#if defined(ESP_PLATFORM)
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <driver/uart.h>
+#include "mixer_link_rx.h"
+#include "mixer_link_histogram.h"
+
+#define MIXER_LINK_UART_RX_BUF        (512)
+#define MIXER_LINK_UART_TX_BUF        (256)
+#define MIXER_LINK_UART_EVENT_QUEUE   (16)
+#define MIXER_LINK_UART_MSG_QUEUE     (8)
+#define MIXER_LINK_UART_RX_TIMEOUT    (2)      // Symbols of idle that end a burst
+#define MIXER_LINK_UART_TASK_STACK    (3 * 1024)
+#define MIXER_LINK_UART_TASK_PRIORITY (5)      // Above loop() and LVGL
+
+struct MixerLinkRxItem {
+    MixerLinkMessage msg;
+    int64_t rx_time_us;     // esp_timer time of the UART event that completed it
+};
+
+struct MixerLinkUartStats {
+    uint32_t events;
+    uint32_t fifo_overflows;
+    uint32_t queue_drops;       // Messages lost because the application queue was full
+    uint32_t worst_feed_us;     // Longest MixerLinkRx::feed() call
+};
+
+class MixerLinkUart {
+public:
+    // Installs the UART driver and starts the RX task on `core`. With `de_pin`
+    // the driver switches the transceiver direction itself (RS485 half duplex).
+    bool begin(uart_port_t port, int baud, int rx_pin, int tx_pin, BaseType_t core = 0,
+               int de_pin = UART_PIN_NO_CHANGE);
+
+    size_t write(const uint8_t *data, size_t len);
+
+    // Blocks up to `timeout` for the next message
+    bool receive(MixerLinkRxItem &item, TickType_t timeout);
+
+    // Optional: also give `task` a notification when messages are queued, so a
+    // task that waits on several sources can sleep in ulTaskNotifyTake()
+    void setNotifyTask(TaskHandle_t task) { _notify = task; }
+
+    // Records RX-event -> now into the latency histogram (call once the message is applied)
+    void markHandled(const MixerLinkRxItem &item);
+
+    const MixerLinkRxStats &parserStats() const { return _parser.stats(); }
+    const MixerLinkUartStats &stats() const { return _stats; }
+    const MixerLinkHistogram &latency() const { return _latency; }
+    void resetLatency() { _latency.reset(); }
+
+    uart_port_t port() const { return _port; }
+
+private:
+    uart_port_t _port = UART_NUM_MAX;
+    QueueHandle_t _events = nullptr;
+    QueueHandle_t _messages = nullptr;
+    TaskHandle_t _task = nullptr;
+    TaskHandle_t _notify = nullptr;
+
+    MixerLinkRx _parser;
+    MixerLinkUartStats _stats = {};
+    MixerLinkHistogram _latency;
+
+    static void taskEntry(void *arg);
+    void taskLoop();
+    void drain(int64_t now);
+};
+
+#endif // ESP_PLATFORM
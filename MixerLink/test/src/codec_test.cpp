@@ -0,0 +1,316 @@
+/*
+ * codec: mixer_link.cpp
+ *
+ * Round trips: every frame type built by its make_* helper, encoded with
+ * bytes after it, decoded and parsed back to the same values. Rejection:
+ * truncated frames, bad SYNC, version and LEN, all 1- and 2-bit errors,
+ * wrong type or short payload in the parse helpers. Fuzz: random bytes and
+ * frames with one byte changed, fed to the decoder.
+ */
+
+#include "link_test.h"
+#include <stdio.h>
+#include <string.h>
+#include <random>
+
+#define TRAILER_BYTES   (4)     // Noise after the frame, must not be consumed
+
+static bool same_frame(const MixerLinkFrame &a, const MixerLinkFrame &b)
+{
+    return a.type == b.type && a.seq == b.seq && a.len == b.len && !memcmp(a.payload, b.payload, a.len);
+}
+
+static bool same_state(const MixerLinkState &a, const MixerLinkState &b)
+{
+    return a.music_volume == b.music_volume && a.mic_volume == b.mic_volume && a.music_relay == b.music_relay &&
+           a.mic_relay == b.mic_relay;
+}
+
+static MixerLinkState random_state(std::mt19937 &rng)
+{
+    return { (uint8_t)(rng() % 101), (uint8_t)(rng() % 101), (rng() & 1) != 0, (rng() & 2) != 0 };
+}
+
+// Encoded, with noise after it, decoded to the same frame and size
+static bool round_trip(const MixerLinkFrame &frame, MixerLinkFrame &out)
+{
+    uint8_t buf[MIXER_LINK_MAX_FRAME + TRAILER_BYTES];
+    size_t size = mixer_link_encode(frame, buf, sizeof(buf));
+    if (size != (size_t)(MIXER_LINK_HEADER_SIZE + frame.len + MIXER_LINK_CRC_SIZE)) return false;
+    memset(&buf[size], MIXER_LINK_SYNC, TRAILER_BYTES);
+
+    size_t consumed = 0;
+    memset(&out, 0xEE, sizeof(out));
+    return mixer_link_decode(buf, size + TRAILER_BYTES, out, &consumed) == MIXER_LINK_OK && consumed == size &&
+           same_frame(frame, out);
+}
+
+static int round_trips(std::mt19937 &rng)
+{
+    int failed = 0;
+    MixerLinkFrame frame, out;
+
+    uint32_t n = 0, bad = 0;
+    for (uint32_t seq = 0; seq < 256; seq++) {
+        for (uint32_t relays = 0; relays < 4; relays++) {
+            MixerLinkState state = { (uint8_t)(seq % 101), (uint8_t)(100 - seq % 101), (relays & 1) != 0,
+                                     (relays & 2) != 0 };
+            MixerLinkState parsed;
+            mixer_link_make_state(frame, (uint8_t)seq, state);
+            bad += !round_trip(frame, out) || !mixer_link_parse_state(out, parsed) || !same_state(state, parsed) ||
+                   out.seq != seq;
+            n++;
+        }
+    }
+    failed += !check(!bad, "STATE: %u frames, every SEQ and relay pair (%u wrong)", n, bad);
+
+    n = bad = 0;
+    for (bool on : { false, true }) {
+        bool parsed = !on;
+        mixer_link_make_power(frame, 7, on);
+        bad += !round_trip(frame, out) || !mixer_link_parse_power(out, parsed) || parsed != on;
+        n++;
+    }
+    mixer_link_make_get(frame, 9);
+    bad += !round_trip(frame, out) || out.type != MIXER_LINK_TYPE_GET || out.len != 0;
+    mixer_link_make_ack(frame, 200);
+    bad += !round_trip(frame, out) || out.type != MIXER_LINK_TYPE_ACK || out.seq != 200 || out.len != 0;
+    n += 2;
+    failed += !check(!bad, "POWER, GET, ACK: %u frames (%u wrong)", n, bad);
+
+    n = bad = 0;
+    for (uint32_t count = 0; count < 256; count++) {
+        uint8_t first = 0, parsed = 0;
+        mixer_link_make_nak(frame, (uint8_t)(count * 7), (uint8_t)count);
+        bad += !round_trip(frame, out) || !mixer_link_parse_nak(out, first, parsed) || first != (uint8_t)(count * 7) ||
+               parsed != count;
+        n++;
+    }
+    failed += !check(!bad, "NAK: %u frames, every count (%u wrong)", n, bad);
+
+    // Fields not in the mask keep what the receiver had
+    n = bad = 0;
+    for (uint32_t i = 0; i < 1000; i++) {
+        uint8_t mask = (uint8_t)(i % 8), parsed_mask = 0xFF;
+        MixerLinkState state = random_state(rng), before = random_state(rng), parsed = before;
+        mixer_link_make_delta(frame, (uint8_t)i, mask, state);
+        bool ok = round_trip(frame, out) && mixer_link_parse_delta(out, parsed_mask, parsed) && parsed_mask == mask;
+        MixerLinkState want = before;
+        if (mask & MIXER_LINK_FIELD_MUSIC_VOL) want.music_volume = state.music_volume;
+        if (mask & MIXER_LINK_FIELD_MIC_VOL) want.mic_volume = state.mic_volume;
+        if (mask & MIXER_LINK_FIELD_RELAYS) {
+            want.music_relay = state.music_relay;
+            want.mic_relay = state.mic_relay;
+        }
+        bad += !ok || !same_state(want, parsed) || out.len != 1 + __builtin_popcount(mask);
+        n++;
+    }
+    failed += !check(!bad, "DELTA: %u frames, every mask, other fields untouched (%u wrong)", n, bad);
+
+    n = bad = 0;
+    for (uint32_t i = 0; i < 1000; i++) {
+        MixerLinkTelemetry tlm = {};
+        tlm.applied_seq = (uint8_t)rng();
+        tlm.state = random_state(rng);
+        tlm.flags = (uint8_t)rng();
+        tlm.i2c_errors = i == 0 ? 0xFFFF : (uint16_t)rng();
+        tlm.loop_max_us = i == 0 ? 0xFFFF : (uint16_t)rng();
+        tlm.loop_avg_us = (uint16_t)rng();
+        MixerLinkTelemetry parsed = {};
+        mixer_link_make_telemetry(frame, (uint8_t)i, tlm);
+        bad += !round_trip(frame, out) || !mixer_link_parse_telemetry(out, parsed) ||
+               parsed.applied_seq != tlm.applied_seq || !same_state(parsed.state, tlm.state) ||
+               parsed.flags != tlm.flags || parsed.i2c_errors != tlm.i2c_errors ||
+               parsed.loop_max_us != tlm.loop_max_us || parsed.loop_avg_us != tlm.loop_avg_us;
+        n++;
+    }
+    failed += !check(!bad, "TELEMETRY: %u frames (%u wrong)", n, bad);
+
+    // Types the codec does not know yet travel as well
+    n = bad = 0;
+    for (uint32_t i = 0; i < 10000; i++) {
+        frame.type = (uint8_t)rng();
+        frame.seq = (uint8_t)rng();
+        frame.len = (uint8_t)(i % (MIXER_LINK_MAX_PAYLOAD + 1));
+        for (uint32_t k = 0; k < frame.len; k++) frame.payload[k] = (uint8_t)rng();
+        bad += !round_trip(frame, out);
+        n++;
+    }
+    failed += !check(!bad, "any type, LEN 0-%u: %u frames (%u wrong)", MIXER_LINK_MAX_PAYLOAD, n, bad);
+    return failed;
+}
+
+static int rejection(std::mt19937 &rng)
+{
+    int failed = 0;
+    uint8_t buf[MIXER_LINK_MAX_FRAME];
+    MixerLinkFrame frame, out;
+
+    uint8_t crc_in[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    uint16_t crc = mixer_link_crc16(crc_in, sizeof(crc_in));
+    failed += !check(crc == 0x29B1, "CRC-16/CCITT-FALSE check value 0x%04X", crc);
+
+    frame.type = MIXER_LINK_TYPE_STATE;
+    frame.seq = 1;
+    frame.len = MIXER_LINK_MAX_PAYLOAD + 1;
+    bool enc_len = mixer_link_encode(frame, buf, sizeof(buf)) == 0;
+    frame.len = MIXER_LINK_MAX_PAYLOAD;
+    memset(frame.payload, 0x5A, sizeof(frame.payload));
+    bool enc_room = mixer_link_encode(frame, buf, MIXER_LINK_MAX_FRAME - 1) == 0 &&
+                    mixer_link_encode(frame, nullptr, MIXER_LINK_MAX_FRAME) == 0 &&
+                    mixer_link_encode(frame, buf, MIXER_LINK_MAX_FRAME) == MIXER_LINK_MAX_FRAME;
+    failed += !check(enc_len && enc_room, "encode: LEN over %u and a short buffer give 0", MIXER_LINK_MAX_PAYLOAD);
+
+    // A full-size frame: every prefix is short, every header error is named
+    size_t size = mixer_link_encode(frame, buf, sizeof(buf));
+    uint32_t bad = 0;
+    for (size_t len = 0; len < size; len++) bad += mixer_link_decode(buf, len, out) != MIXER_LINK_ERR_SHORT;
+    failed += !check(!bad, "every truncation of a %zu-byte frame: short (%u wrong)", size, bad);
+
+    bad = 0;
+    uint8_t bytes[MIXER_LINK_MAX_FRAME];
+    for (uint32_t v = 0; v < 256; v++) {
+        memcpy(bytes, buf, size);
+        bytes[0] = (uint8_t)v;
+        if (v != MIXER_LINK_SYNC) bad += mixer_link_decode(bytes, size, out) != MIXER_LINK_ERR_SYNC;
+        memcpy(bytes, buf, size);
+        bytes[1] = (uint8_t)v;
+        if (v != MIXER_LINK_VERSION) bad += mixer_link_decode(bytes, size, out) != MIXER_LINK_ERR_VERSION;
+        memcpy(bytes, buf, size);
+        bytes[4] = (uint8_t)v;
+        if (v > MIXER_LINK_MAX_PAYLOAD) bad += mixer_link_decode(bytes, size, out) != MIXER_LINK_ERR_LENGTH;
+    }
+    failed += !check(!bad, "every other SYNC, VER, and LEN over %u rejected as such (%u wrong)",
+                     MIXER_LINK_MAX_PAYLOAD, bad);
+
+    // CRC-16 finds all 1- and 2-bit errors in a frame this short
+    uint32_t flips = 0;
+    bad = 0;
+    for (size_t a = 8; a < size * 8; a++) {
+        for (size_t b = a; b < size * 8; b++) {
+            memcpy(bytes, buf, size);
+            bytes[a / 8] ^= (uint8_t)(1 << (a % 8));
+            if (b != a) bytes[b / 8] ^= (uint8_t)(1 << (b % 8));
+            bad += mixer_link_decode(bytes, size, out) == MIXER_LINK_OK;
+            flips++;
+        }
+    }
+    failed += !check(!bad, "%u 1- and 2-bit errors after SYNC: none accepted (%u accepted)", flips, bad);
+
+    // Parse helpers: a valid CRC is not a valid payload
+    MixerLinkState state = random_state(rng);
+    MixerLinkTelemetry tlm = {};
+    uint8_t mask, first, count;
+    bool on;
+    bad = 0;
+    mixer_link_make_delta(frame, 1, MIXER_LINK_FIELD_ALL, state);
+    bad += mixer_link_parse_state(frame, state) || mixer_link_parse_power(frame, on) ||
+           mixer_link_parse_nak(frame, first, count) || mixer_link_parse_telemetry(frame, tlm);
+    mixer_link_make_state(frame, 1, state);
+    bad += mixer_link_parse_delta(frame, mask, state);
+    frame.len = 2;
+    bad += mixer_link_parse_state(frame, state);
+    mixer_link_make_telemetry(frame, 1, tlm);
+    frame.len--;
+    bad += mixer_link_parse_telemetry(frame, tlm);
+    mixer_link_make_power(frame, 1, true);
+    frame.len = 0;
+    bad += mixer_link_parse_power(frame, on);
+    mixer_link_make_nak(frame, 1, 1);
+    frame.len = 0;
+    bad += mixer_link_parse_nak(frame, first, count);
+    for (uint8_t m = 1; m <= MIXER_LINK_FIELD_ALL; m++) {
+        mixer_link_make_delta(frame, 1, m, state);
+        frame.len--;
+        bad += mixer_link_parse_delta(frame, mask, state);
+    }
+    mixer_link_make_delta(frame, 1, MIXER_LINK_FIELD_ALL, state);
+    frame.payload[0] |= 1 << MIXER_LINK_FIELD_COUNT;
+    bad += mixer_link_parse_delta(frame, mask, state);
+    failed += !check(!bad, "parse: wrong type, short payload, unknown DELTA field rejected (%u accepted)", bad);
+
+    bad = 0;
+    frame.type = MIXER_LINK_TYPE_STATE;
+    frame.len = 3;
+    frame.payload[0] = 101;
+    frame.payload[1] = 255;
+    frame.payload[2] = 0xFF;
+    bad += !mixer_link_parse_state(frame, state) || state.music_volume != 100 || state.mic_volume != 100 ||
+           !state.music_relay || !state.mic_relay;
+    frame.type = MIXER_LINK_TYPE_DELTA;
+    frame.len = 3;
+    frame.payload[0] = MIXER_LINK_FIELD_MUSIC_VOL | MIXER_LINK_FIELD_MIC_VOL;
+    frame.payload[1] = 200;
+    frame.payload[2] = 101;
+    bad += !mixer_link_parse_delta(frame, mask, state) || state.music_volume != 100 || state.mic_volume != 100;
+    failed += !check(!bad, "parse: volumes over 100 clamped");
+    return failed;
+}
+
+static int fuzz(std::mt19937 &rng)
+{
+    int failed = 0;
+    uint8_t in[MIXER_LINK_MAX_FRAME + 8], again[MIXER_LINK_MAX_FRAME];
+    MixerLinkFrame frame;
+
+    // Random bytes, half of them behind a valid SYNC / VER so that LEN and CRC get checked
+    uint32_t accepted = 0, bad = 0;
+    uint32_t results[MIXER_LINK_ERR_CRC + 1] = {};
+    for (uint32_t i = 0; i < test_fuzz_runs; i++) {
+        size_t len = rng() % sizeof(in);
+        for (size_t k = 0; k < len; k++) in[k] = (uint8_t)rng();
+        if (len > 0 && (i & 1)) in[0] = MIXER_LINK_SYNC;
+        if (len > 1 && (i & 2)) in[1] = MIXER_LINK_VERSION;
+        if (len > 4 && (i & 4)) in[4] %= MIXER_LINK_MAX_PAYLOAD + 1;
+
+        size_t consumed = 0;
+        MixerLinkResult r = mixer_link_decode(in, len, frame, &consumed);
+        results[r]++;
+        if (r != MIXER_LINK_OK) continue;
+
+        // A lucky CRC: still a well-formed frame of the input's own bytes
+        accepted++;
+        MixerLinkState state;
+        MixerLinkTelemetry tlm;
+        uint8_t mask, first, count;
+        bool on;
+        mixer_link_parse_state(frame, state);
+        mixer_link_parse_delta(frame, mask, state);
+        mixer_link_parse_power(frame, on);
+        mixer_link_parse_nak(frame, first, count);
+        mixer_link_parse_telemetry(frame, tlm);
+        bad += consumed > len || frame.len > MIXER_LINK_MAX_PAYLOAD ||
+               mixer_link_encode(frame, again, sizeof(again)) != consumed || memcmp(in, again, consumed);
+    }
+    failed += !check(!bad, "%u random inputs: %u short, %u sync, %u version, %u length, %u CRC, %u accepted "
+                     "(%u not re-encoding to the input)", test_fuzz_runs, results[MIXER_LINK_ERR_SHORT],
+                     results[MIXER_LINK_ERR_SYNC], results[MIXER_LINK_ERR_VERSION], results[MIXER_LINK_ERR_LENGTH],
+                     results[MIXER_LINK_ERR_CRC], accepted, bad);
+
+    // One byte other than SYNC and LEN changed: a burst the CRC always finds
+    bad = 0;
+    for (uint32_t i = 0; i < test_fuzz_runs; i++) {
+        frame.type = (uint8_t)rng();
+        frame.seq = (uint8_t)rng();
+        frame.len = (uint8_t)(rng() % (MIXER_LINK_MAX_PAYLOAD + 1));
+        for (uint32_t k = 0; k < frame.len; k++) frame.payload[k] = (uint8_t)rng();
+        size_t size = mixer_link_encode(frame, in, sizeof(in));
+        size_t pos;
+        do {
+            pos = 1 + rng() % (size - 1);
+        } while (pos == 4);
+        in[pos] ^= (uint8_t)(1 + rng() % 255);
+        bad += mixer_link_decode(in, size, frame) == MIXER_LINK_OK;
+    }
+    failed += !check(!bad, "%u frames with one byte changed: none accepted (%u accepted)", test_fuzz_runs, bad);
+    return failed;
+}
+
+int codec_test()
+{
+    std::mt19937 rng(test_seed);
+    int failed = round_trips(rng);
+    failed += rejection(rng);
+    failed += fuzz(rng);
+    return failed;
+}
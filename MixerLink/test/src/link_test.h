@@ -0,0 +1,24 @@
+#pragma once
+
+/*
+ * MixerLinkTest - host checks of the MixerLink library
+ *
+ * codec_test.cpp: encode / decode round trips of every frame type, the
+ * rejection of bad SYNC, version, length and CRC, and random bytes fed to
+ * the decoder. rx_test.cpp: MixerLinkRx fed split, torn and noisy streams,
+ * and the time of its slowest call.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <mixer_link.h>
+
+extern uint32_t test_seed;          // -s: random frames and noise
+extern uint32_t test_fuzz_runs;     // -n: random inputs per fuzz check
+
+// Prints an "ok" / "FAIL" line, returns `ok`
+bool check(bool ok, const char *what, ...);
+
+// Each returns the number of failed checks
+int codec_test();
+int rx_test();
@@ -0,0 +1,75 @@
+/*
+ * MixerLinkTest - host checks of the MixerLink frame codec and receiver
+ *
+ * Usage: mixer_link_test [-s seed] [-n runs] [test ...]     (no test = all of them)
+ *
+ * Exit status is non-zero if any check fails.
+ */
+
+#include "link_test.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+uint32_t test_seed = 1;
+uint32_t test_fuzz_runs = 200000;
+
+struct Test {
+    const char *name;
+    const char *description;
+    int (*run)();
+};
+
+static const Test tests[] = {
+    { "codec", "frame encode / decode", codec_test },
+    { "rx", "incremental receiver", rx_test },
+};
+
+bool check(bool ok, const char *what, ...) {
+    char buf[160];
+    va_list args;
+    va_start(args, what);
+    vsnprintf(buf, sizeof(buf), what, args);
+    va_end(args);
+    printf("  %s %s\n", ok ? "ok  " : "FAIL", buf);
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    std::vector<const Test *> selected;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+            test_seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+            continue;
+        }
+        if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+            test_fuzz_runs = (uint32_t)strtoul(argv[++i], nullptr, 0);
+            continue;
+        }
+        const Test *found = nullptr;
+        for (const Test &t : tests) {
+            if (!strcmp(t.name, argv[i])) found = &t;
+        }
+        if (!found) {
+            fprintf(stderr, "unknown test '%s', have:", argv[i]);
+            for (const Test &t : tests) fprintf(stderr, " %s", t.name);
+            fprintf(stderr, "\n");
+            return 2;
+        }
+        selected.push_back(found);
+    }
+    if (selected.empty()) {
+        for (const Test &t : tests) selected.push_back(&t);
+    }
+
+    int failed = 0;
+    for (const Test *t : selected) {
+        printf("== %s: %s ==\n", t->name, t->description);
+        failed += t->run();
+        printf("\n");
+    }
+    printf("%d checks failed\n", failed);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,301 @@
+/*
+ * rx: mixer_link_rx.cpp
+ *
+ * Streams of frames and JSON lines fed in random chunks (single bytes up to
+ * a UART FIFO), with torn frames and noise between messages: every complete
+ * message must come out in order, unless noise that passed its CRC took its
+ * first bytes (at most once a stream). Then the ring and line
+ * limits, and the time of the slowest feed() call on streams built to make
+ * the parser rescan as much as it can.
+ */
+
+#include "link_test.h"
+#include <mixer_link_rx.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+#define RX_MESSAGES     (5000)      // Per stream
+#define RX_CHUNK_MAX    (48)        // Bytes per feed(): at most 7 messages, the ring holds 8
+#define RX_TIME_REPEATS (7)         // Per call, the fastest of these counts (host noise)
+#define RX_BYTE_MAX_US  (2.0)       // Host limit for feed() of one byte
+#define RX_CHUNK_MAX_US (20.0)      // Host limit for feed() of RX_CHUNK_MAX bytes
+
+struct Message {
+    bool line;
+    MixerLinkFrame frame;
+    std::string text;
+};
+
+struct Stream {
+    std::vector<uint8_t> bytes;
+    std::vector<Message> sent;      // Complete messages, in order
+};
+
+static MixerLinkFrame random_frame(std::mt19937 &rng)
+{
+    MixerLinkFrame frame;
+    frame.type = (uint8_t)(1 + rng() % MIXER_LINK_TYPE_TELEMETRY);
+    frame.seq = (uint8_t)rng();
+    frame.len = (uint8_t)(rng() % (MIXER_LINK_MAX_PAYLOAD + 1));
+    for (uint32_t k = 0; k < frame.len; k++) frame.payload[k] = (uint8_t)rng();
+    return frame;
+}
+
+static void add_frame(Stream &s, const MixerLinkFrame &frame, size_t keep = MIXER_LINK_MAX_FRAME)
+{
+    uint8_t buf[MIXER_LINK_MAX_FRAME];
+    size_t size = mixer_link_encode(frame, buf, sizeof(buf));
+    s.bytes.insert(s.bytes.end(), buf, buf + std::min(size, keep));
+    if (keep >= size) s.sent.push_back({ false, frame, "" });
+}
+
+static void add_line(Stream &s, std::mt19937 &rng)
+{
+    char text[MIXER_LINK_MAX_LINE + 1];
+    snprintf(text, sizeof(text), "{\"mv\":%u,\"cv\":%u,\"mr\":%u,\"cr\":%u}", (unsigned)(rng() % 101),
+             (unsigned)(rng() % 101), (unsigned)(rng() & 1), (unsigned)(rng() & 1));
+    s.bytes.insert(s.bytes.end(), text, text + strlen(text));
+    s.bytes.push_back(rng() & 1 ? '\n' : '\r');
+    if (s.bytes.back() == '\r') s.bytes.push_back('\n');
+    s.sent.push_back({ true, {}, text });
+}
+
+// Frames and lines; `torn`: some frames cut short in front of a frame,
+// `noise`: random bytes (no '\n') in front of frames
+static Stream make_stream(std::mt19937 &rng, bool torn, bool noise)
+{
+    Stream s;
+    for (uint32_t i = 0; i < RX_MESSAGES; i++) {
+        if (rng() % 5 == 0) {
+            add_line(s, rng);
+            continue;
+        }
+        MixerLinkFrame frame = random_frame(rng);
+        // Cut before its CRC: a frame short of one CRC byte would take the
+        // next SYNC for it, and be taken for a frame 1 time in 256
+        if (torn && rng() % 3 == 0) {
+            MixerLinkFrame lost = random_frame(rng);
+            add_frame(s, lost, 1 + rng() % (MIXER_LINK_HEADER_SIZE + lost.len));
+        }
+        if (noise && rng() % 2 == 0) {
+            uint32_t n = 1 + rng() % 32;
+            for (uint32_t k = 0; k < n; k++) {
+                uint8_t b = (uint8_t)rng();
+                if (k % 8 == 0) b = MIXER_LINK_SYNC;        // False starts
+                if (k % 8 == 1) b = MIXER_LINK_VERSION;
+                s.bytes.push_back(b == '\n' ? 0 : b);
+            }
+        }
+        add_frame(s, frame);
+    }
+    // Idle bytes: a false start in the noise may still be waiting for more
+    s.bytes.insert(s.bytes.end(), MIXER_LINK_MAX_FRAME, 0);
+    return s;
+}
+
+// Fed in chunks of 1..`chunk_max` bytes, popping after each
+static std::vector<Message> feed_stream(MixerLinkRx &rx, const Stream &s, std::mt19937 &rng, size_t chunk_max)
+{
+    std::vector<Message> got;
+    MixerLinkMessage msg;
+    for (size_t pos = 0; pos < s.bytes.size();) {
+        size_t n = std::min(s.bytes.size() - pos, 1 + rng() % chunk_max);
+        rx.feed(&s.bytes[pos], n);
+        pos += n;
+        while (rx.pop(msg)) {
+            if (msg.kind == MIXER_LINK_MSG_LINE) got.push_back({ true, {}, msg.line });
+            else got.push_back({ false, msg.frame, "" });
+        }
+    }
+    return got;
+}
+
+static bool same_message(const Message &x, const Message &y)
+{
+    if (x.line != y.line) return false;
+    if (x.line) return x.text == y.text;
+    return x.frame.type == y.frame.type && x.frame.seq == y.frame.seq && x.frame.len == y.frame.len &&
+           !memcmp(x.frame.payload, y.frame.payload, x.frame.len);
+}
+
+struct Match {
+    uint32_t lost;      // Sent, not received
+    uint32_t junk;      // Lines never sent: bytes of torn frames, the body's JSON parser rejects them
+    uint32_t lucky;     // Frames never sent: noise that passed its CRC, each can swallow the start of a real frame
+};
+
+static Match match(const std::vector<Message> &sent, const std::vector<Message> &got)
+{
+    Match r = {};
+    size_t next = 0;
+    for (const Message &m : got) {
+        size_t j = next;
+        while (j < sent.size() && j < next + MIXER_LINK_RX_RING_SIZE && !same_message(sent[j], m)) j++;
+        if (j < sent.size() && same_message(sent[j], m)) {
+            r.lost += (uint32_t)(j - next);
+            next = j + 1;
+        } else {
+            (m.line ? r.junk : r.lucky)++;
+        }
+    }
+    r.lost += (uint32_t)(sent.size() - next);
+    return r;
+}
+
+static int streams(std::mt19937 &rng)
+{
+    struct Kind {
+        const char *name;
+        bool torn, noise;
+    };
+    static const Kind kinds[] = {
+        { "clean", false, false },
+        { "torn frames", true, false },
+        { "noise between", false, true },
+        { "torn and noise", true, true },
+    };
+
+    int failed = 0;
+    MixerLinkRx rx;
+    for (const Kind &k : kinds) {
+        Stream s = make_stream(rng, k.torn, k.noise);
+        for (size_t chunk_max : { (size_t)1, (size_t)RX_CHUNK_MAX }) {
+            rx.reset();
+            std::vector<Message> got = feed_stream(rx, s, rng, chunk_max);
+            const MixerLinkRxStats &st = rx.stats();
+            Match m = match(s.sent, got);
+            failed += !check(m.lost <= 2 * m.lucky && m.lucky <= 1 && !st.ring_overruns && !st.line_overflows,
+                             "%-14s %s: %zu messages, %u lost, %u bytes dropped, %u CRC / %u header errors, "
+                             "%u junk lines, %u frames of noise", k.name, chunk_max == 1 ? "by byte " : "in chunks",
+                             s.sent.size(), m.lost, st.dropped_bytes, st.crc_errors, st.header_errors, m.junk,
+                             m.lucky);
+        }
+    }
+
+    // Noise only: no line without a '\n', a frame only with a lucky CRC
+    std::vector<uint8_t> noise(1 << 20);
+    for (uint8_t &b : noise) b = (uint8_t)(rng() % 4 == 0 ? MIXER_LINK_SYNC : rng());
+    rx.reset();
+    MixerLinkMessage msg;
+    uint32_t frames = 0, lines = 0;
+    for (size_t pos = 0; pos < noise.size(); pos += RX_CHUNK_MAX) {
+        rx.feed(&noise[pos], std::min((size_t)RX_CHUNK_MAX, noise.size() - pos));
+        while (rx.pop(msg)) (msg.kind == MIXER_LINK_MSG_FRAME ? frames : lines)++;
+    }
+    failed += !check(frames < 4 && !rx.stats().ring_overruns, "%zu bytes of noise: %u frames, %u lines",
+                     noise.size(), frames, lines);
+    return failed;
+}
+
+static int limits(std::mt19937 &rng)
+{
+    int failed = 0;
+    MixerLinkRx rx;
+    Stream s;
+    for (uint32_t i = 0; i < MIXER_LINK_RX_RING_SIZE + 3; i++) add_frame(s, random_frame(rng));
+    size_t queued = rx.feed(s.bytes.data(), s.bytes.size());
+    std::vector<Message> got;
+    MixerLinkMessage msg;
+    while (rx.pop(msg)) got.push_back({ false, msg.frame, "" });
+    s.sent.resize(MIXER_LINK_RX_RING_SIZE);
+    failed += !check(queued == MIXER_LINK_RX_RING_SIZE && !match(s.sent, got).lost && rx.stats().ring_overruns == 3 &&
+                     rx.empty(), "ring full: the first %u frames kept, %u overruns counted", MIXER_LINK_RX_RING_SIZE,
+                     rx.stats().ring_overruns);
+
+    rx.reset();
+    std::string longest(MIXER_LINK_MAX_LINE, 'x'), over(MIXER_LINK_MAX_LINE + 1, 'y');
+    std::string text = over + "\n" + longest + "\n";
+    rx.feed((const uint8_t *)text.data(), text.size());
+    bool ok = rx.pop(msg) && msg.kind == MIXER_LINK_MSG_LINE && longest == msg.line && !rx.pop(msg);
+    failed += !check(ok && rx.stats().line_overflows == 1, "line of %u chars kept, one longer dropped",
+                     MIXER_LINK_MAX_LINE);
+
+    // A SYNC inside a line: the line was noise, the frame counts
+    rx.reset();
+    s = {};
+    s.bytes = { '{', '"', 'm', 'v' };
+    MixerLinkFrame frame = random_frame(rng);
+    add_frame(s, frame);
+    s.bytes.push_back('\n');
+    rx.feed(s.bytes.data(), s.bytes.size());
+    got.clear();
+    while (rx.pop(msg)) got.push_back({ msg.kind == MIXER_LINK_MSG_LINE, msg.frame, "" });
+    failed += !check(got.size() == 1 && !match(s.sent, got).lost && rx.stats().dropped_bytes == 4, "frame inside a line: line dropped");
+    return failed;
+}
+
+// Every candidate at a SYNC complete and failing its CRC on the same byte:
+// LEN 16 at 0, 11 at 5, 6 at 10, 1 at 15 all end at byte 22
+static void stacked(std::vector<uint8_t> &out, std::mt19937 &rng)
+{
+    for (uint32_t i = 0; i < 4; i++) {
+        uint8_t head[] = { MIXER_LINK_SYNC, MIXER_LINK_VERSION, (uint8_t)rng(), (uint8_t)rng(),
+                           (uint8_t)(MIXER_LINK_MAX_PAYLOAD - 5 * i) };
+        out.insert(out.end(), head, head + sizeof(head));
+    }
+    out.push_back(0x00);
+    out.push_back(0x00);
+    out.push_back(0x00);
+}
+
+// The slowest call, each call timed RX_TIME_REPEATS times and the fastest taken
+static double worst_call_us(const std::vector<uint8_t> &bytes, size_t chunk)
+{
+    size_t calls = (bytes.size() + chunk - 1) / chunk;
+    std::vector<double> best(calls, 1e9);
+    MixerLinkRx rx;
+    MixerLinkMessage msg;
+    for (uint32_t r = 0; r < RX_TIME_REPEATS; r++) {
+        rx.reset();
+        for (size_t c = 0; c < calls; c++) {
+            size_t pos = c * chunk, n = std::min(chunk, bytes.size() - pos);
+            auto t0 = std::chrono::steady_clock::now();
+            rx.feed(&bytes[pos], n);
+            double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+            best[c] = std::min(best[c], t * 1e6);
+            while (rx.pop(msg)) {}
+        }
+    }
+    return *std::max_element(best.begin(), best.end());
+}
+
+static int timing(std::mt19937 &rng)
+{
+    std::vector<uint8_t> rescans, noise(20000), frames;
+    while (rescans.size() < 20000) stacked(rescans, rng);
+    for (uint8_t &b : noise) b = (uint8_t)(rng() % 4 == 0 ? MIXER_LINK_SYNC : rng());
+    while (frames.size() < 20000) {
+        Stream s;
+        add_frame(s, random_frame(rng));
+        frames.insert(frames.end(), s.bytes.begin(), s.bytes.end());
+    }
+
+    struct Input {
+        const char *name;
+        const std::vector<uint8_t> &bytes;
+    };
+    const Input inputs[] = { { "stacked rescans", rescans }, { "noise", noise }, { "frames", frames } };
+
+    int failed = 0;
+    for (const Input &in : inputs) {
+        double one = worst_call_us(in.bytes, 1), chunk = worst_call_us(in.bytes, RX_CHUNK_MAX);
+        failed += !check(one < RX_BYTE_MAX_US && chunk < RX_CHUNK_MAX_US,
+                         "slowest feed() (host), %-15s 1 byte %.3fus (limit %.1f), %u bytes %.3fus (limit %.1f)",
+                         in.name, one, RX_BYTE_MAX_US, RX_CHUNK_MAX, chunk, RX_CHUNK_MAX_US);
+    }
+    return failed;
+}
+
+int rx_test()
+{
+    std::mt19937 rng(test_seed);
+    int failed = streams(rng);
+    failed += limits(rng);
+    failed += timing(rng);
+    return failed;
+}
@@ -0,0 +1,555 @@
+/*
+ * MixerSim - runs the controller and body link code against a virtual RS485 bus
+ *
+ * Usage: mixer_sim [-v] [-s seed] [scenario ...]     (no scenario = all of them)
+ *
+ * Each scenario drives the controller with timed UI commands, as the LVGL
+ * task would post them, and reports:
+ *   - bus throughput and occupancy, collisions
+ *   - UI change -> body volume target latency, values coalesced away
+ *   - volume ramps on the PT2258: step size, spacing, longest ramp
+ *   - checks: final body state, volume order, 1 dB ramps, relay and
+ *     Bluetooth anti-pop, no busy loop, telemetry period
+ * Exit status is non-zero if any check fails.
+ */
+
+#include "sim.h"
+#include <controller_link.h>
+#include <body_logic.h>
+#include <body_hal.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define SIM_HEARTBEAT_MS    (2000)    // main.cpp heartbeat
+#define SIM_TLM_GAP_MS      (1050)    // Telemetry at least once a second, a few loop passes late at most
+#define SIM_DRAIN_MS        (3000)    // After the last UI command, covers one heartbeat
+#define SIM_BODY_WAIT_MS    (10)      // Body loop(): rs485.receive() timeout
+#define SIM_CTRL_WAIT_MS    (10)      // Controller loop(): txWaitMs(10)
+#define SIM_MAX_SPINS       (1000)    // Zero waits in a row = busy loop
+
+// ----------------------------------------------------------------------
+// Controller side: AppDataManager's state and command handling, without
+// Preferences / LVGL
+// ----------------------------------------------------------------------
+
+enum SimUiType : uint8_t {
+    UI_MIC_VOLUME = 0,
+    UI_MUSIC_VOLUME,
+    UI_MAIN_FADER,
+    UI_SLIDER_RELEASED,
+    UI_TOGGLE_MIC_RELAY,
+    UI_TOGGLE_MUSIC_RELAY,
+    UI_POWER_OFF,
+};
+
+struct SimUi {
+    int64_t t_us;
+    SimUiType type;
+    int value;
+};
+
+class SimControllerIo : public ControllerLinkIo {
+public:
+    void write(const uint8_t *data, size_t len) override { sim_bus.write(SIM_CONTROLLER, data, len); }
+    uint32_t nowMs() override { return (uint32_t)(sim_now_us / 1000); }
+    uint32_t nowUs() override { return (uint32_t)sim_now_us; }
+    void log(const char *fmt, ...) override {
+        if (!sim_verbose) return;
+        char buf[160];
+        va_list args;
+        va_start(args, fmt);
+        vsnprintf(buf, sizeof(buf), fmt, args);
+        va_end(args);
+        sim_trace("ctrl", "%s", buf);
+    }
+};
+
+struct SimController {
+    int music_volume = 80;
+    int mic_volume = 50;
+    int main_fader = 100;
+    bool music_relay_state = true;
+    bool mic_relay_state = true;
+
+    MixerLinkState currentState() const {
+        MixerLinkState state;
+        state.music_volume = (music_volume * main_fader) / 100;
+        state.mic_volume = (mic_volume * main_fader) / 100;
+        state.music_relay = music_relay_state;
+        state.mic_relay = mic_relay_state;
+        return state;
+    }
+
+    // Same as AppDataManager::applyCommand()
+    void apply(const SimUi &ui, ControllerLink &session) {
+        switch (ui.type) {
+            case UI_MIC_VOLUME:
+                mic_volume = ui.value;
+                session.requestUpdate();
+                break;
+            case UI_MUSIC_VOLUME:
+                music_volume = ui.value;
+                session.requestUpdate();
+                break;
+            case UI_MAIN_FADER:
+                main_fader = ui.value;
+                session.requestUpdate();
+                break;
+            case UI_SLIDER_RELEASED:
+                session.requestFlush();
+                break;
+            case UI_TOGGLE_MIC_RELAY:
+                mic_volume = 0;
+                session.requestRelaySwitch(music_relay_state, mic_relay_state);
+                mic_relay_state = !mic_relay_state;
+                break;
+            case UI_TOGGLE_MUSIC_RELAY:
+                music_volume = 0;
+                session.requestRelaySwitch(music_relay_state, mic_relay_state);
+                music_relay_state = !music_relay_state;
+                break;
+            case UI_POWER_OFF:
+                session.requestShutdown();   // The heartbeat after it wakes the body again
+                break;
+        }
+    }
+};
+
+// ----------------------------------------------------------------------
+// UI -> body target latency and order (music / mic volume), and the ramps
+// the PT2258 then runs on Ch1 (music) and Ch3 (mic)
+// ----------------------------------------------------------------------
+
+static uint8_t attenuation(int volume) {
+    return (uint8_t)(79 - (volume * 79) / 100);   // body_logic.cpp setChannelVolume()
+}
+
+struct ChannelTrack {
+    struct Request {
+        int64_t t_us;
+        uint8_t att;
+    };
+    std::vector<Request> req;   // Distinct consecutive values the UI asked for
+    int matched = -1;           // Newest request the hardware has reached
+    std::vector<int64_t> latency_us;
+    uint32_t coalesced = 0;     // Requests skipped by a newer value
+    uint32_t out_of_order = 0;  // Body went to a value older than one already reached
+
+    void request(uint8_t att) {
+        if (req.empty() || req.back().att != att) req.push_back({sim_now_us, att});
+    }
+
+    void applied(uint8_t att) {
+        if (matched >= 0 && req[matched].att == att) return;   // Other fields changed
+        int found = -1;
+        for (int k = (int)req.size() - 1; k >= 0 && k >= matched; k--) {
+            if (req[k].att == att) {
+                found = k;
+                break;
+            }
+        }
+        if (found < 0 && att == 79) return;   // Relay switch mute, checked by the anti-pop test
+        if (found < 0) {
+            out_of_order++;
+            sim_trace("sim", "order: -%udB applied, not requested since request #%d\n", att, matched);
+            return;
+        }
+        coalesced += found - matched - 1;
+        if (found > 0) latency_us.push_back(sim_now_us - req[found].t_us);   // #0 = boot state
+        matched = found;
+    }
+};
+
+static ChannelTrack track_music;
+static ChannelTrack track_mic;
+
+// Body targets after each loop() pass
+static void on_body_pass() {
+    track_music.applied(attenuation(currentMusicVol));
+    track_mic.applied(attenuation(currentMicVol));
+}
+
+struct RampTrack {
+    uint8_t att = 79;           // After the 0xC0 clear
+    int64_t last_us = -1;       // Start of the last step's I2C transaction
+    int dir = 0;
+    uint32_t steps = 0;
+    uint32_t jumps = 0;         // More than 1 dB at once (zipper)
+    uint32_t early = 0;         // Less than rampStepUs after the previous step
+    uint32_t reversals = 0;     // Direction changed mid-ramp (new target)
+    int64_t ramp_start_us = 0;
+    uint32_t ramp_steps = 0;
+    int64_t longest_us = 0;     // Longest run of back-to-back steps
+    uint32_t longest_steps = 0;
+
+    void written(uint8_t value, int64_t t_us) {
+        if (value == att) return;
+        int step = (int)value - (int)att;
+        int step_dir = step > 0 ? 1 : -1;
+        if (step * step_dir > 1) jumps++;
+        bool continued = last_us >= 0 && t_us - last_us <= (int64_t)rampStepUs * 3 / 2;
+        if (last_us >= 0 && t_us - last_us < (int64_t)rampStepUs) early++;
+        if (continued && step_dir != dir) reversals++;
+        if (!continued || step_dir != dir) {
+            ramp_start_us = t_us;
+            ramp_steps = 0;
+        }
+        ramp_steps++;
+        if (ramp_steps > longest_steps) {
+            longest_steps = ramp_steps;
+            longest_us = t_us - ramp_start_us;
+        }
+        steps++;
+        dir = step_dir;
+        att = value;
+        last_us = t_us;
+    }
+};
+
+static RampTrack ramp_music;
+static RampTrack ramp_mic;
+
+static void on_channel_write(int ch, uint8_t att, int64_t start_us) {
+    if (ch == 0) ramp_music.written(att, start_us);
+    if (ch == 2) ramp_mic.written(att, start_us);
+}
+
+// ----------------------------------------------------------------------
+// Scenarios
+// ----------------------------------------------------------------------
+
+struct Scenario {
+    const char *name;
+    const char *description;
+    bool delta;
+    double loss;
+    void (*build)(std::vector<SimUi> &ui);
+    bool single_ramp = false;   // One target per channel: monotonic ramps, exact timing
+};
+
+// Slider drag as LVGL reports it: one value per display refresh
+static void drag(std::vector<SimUi> &ui, int64_t t_us, SimUiType type, int from, int to, int64_t step_us) {
+    int dir = to > from ? 1 : -1;
+    for (int v = from; v != to + dir; v += dir) {
+        ui.push_back({t_us, type, v});
+        t_us += step_us;
+    }
+    ui.push_back({t_us, UI_SLIDER_RELEASED, 0});
+}
+
+static void build_drag(std::vector<SimUi> &ui) {
+    drag(ui, 100000, UI_MUSIC_VOLUME, 80, 20, 16000);
+    drag(ui, 1500000, UI_MIC_VOLUME, 50, 90, 16000);
+    drag(ui, 2500000, UI_MAIN_FADER, 100, 60, 16000);
+}
+
+static void build_fast(std::vector<SimUi> &ui) {
+    // Touch events faster than the frame rate limit
+    drag(ui, 100000, UI_MUSIC_VOLUME, 0, 100, 1000);
+    drag(ui, 400000, UI_MIC_VOLUME, 100, 0, 1000);
+}
+
+static void build_relay(std::vector<SimUi> &ui) {
+    drag(ui, 100000, UI_MUSIC_VOLUME, 80, 40, 16000);
+    ui.push_back({400000, UI_TOGGLE_MUSIC_RELAY, 0});
+    ui.push_back({420000, UI_TOGGLE_MIC_RELAY, 0});
+    drag(ui, 1000000, UI_MUSIC_VOLUME, 0, 70, 16000);
+    drag(ui, 1000000, UI_MIC_VOLUME, 0, 60, 16000);
+    ui.push_back({2500000, UI_TOGGLE_MUSIC_RELAY, 0});
+    drag(ui, 2600000, UI_MUSIC_VOLUME, 0, 50, 16000);
+    std::stable_sort(ui.begin(), ui.end(), [](const SimUi &a, const SimUi &b) { return a.t_us < b.t_us; });
+}
+
+static void build_jump(std::vector<SimUi> &ui) {
+    // Boot state first, then taps on the slider track: one new value each, no drag
+    ui.push_back({100000, UI_SLIDER_RELEASED, 0});
+    ui.push_back({1000000, UI_MUSIC_VOLUME, 10});
+    ui.push_back({1000000, UI_MIC_VOLUME, 100});
+    ui.push_back({1000000, UI_SLIDER_RELEASED, 0});
+}
+
+static void build_power(std::vector<SimUi> &ui) {
+    // Boot state (music on Bluetooth), then POWER off: the body fades out
+    // before it stops Bluetooth and resets the relays
+    ui.push_back({100000, UI_SLIDER_RELEASED, 0});
+    ui.push_back({500000, UI_POWER_OFF, 0});
+}
+
+static void build_mixed(std::vector<SimUi> &ui) {
+    build_drag(ui);
+    build_relay(ui);
+    std::stable_sort(ui.begin(), ui.end(), [](const SimUi &a, const SimUi &b) { return a.t_us < b.t_us; });
+}
+
+static const Scenario scenarios[] = {
+    {"drag",   "slider drags at 60 Hz, DELTA frames",        true,  0.00, build_drag},
+    {"full",   "slider drags at 60 Hz, full STATE frames",   false, 0.00, build_drag},
+    {"fast",   "1 ms touch events, coalescing",              true,  0.00, build_fast},
+    {"relay",  "relay toggles during drags, anti-pop",       true,  0.00, build_relay},
+    {"jump",   "volume jumps, ramp timing",                  true,  0.00, build_jump, true},
+    {"power",  "power off with Bluetooth playing, fade first", true, 0.00, build_power},
+    {"loss",   "drags and relay toggles, 10% frames damaged", true, 0.10, build_mixed},
+    {"loss30", "drags and relay toggles, 30% frames damaged", true, 0.30, build_mixed},
+};
+
+// ----------------------------------------------------------------------
+// Run
+// ----------------------------------------------------------------------
+
+static void print_latency(const char *name, ChannelTrack &t) {
+    std::vector<int64_t> v = t.latency_us;
+    if (v.empty()) {
+        printf("  %-5s UI->body: no samples\n", name);
+        return;
+    }
+    std::sort(v.begin(), v.end());
+    int64_t sum = 0;
+    for (int64_t x : v) sum += x;
+    printf("  %-5s UI->body: n=%zu avg=%.2fms p50=%.2fms p95=%.2fms max=%.2fms coalesced=%u\n", name,
+           v.size(), sum / 1000.0 / v.size(), v[v.size() / 2] / 1000.0, v[v.size() * 95 / 100] / 1000.0,
+           v.back() / 1000.0, t.coalesced);
+}
+
+static void print_ramp(const char *name, const RampTrack &r) {
+    printf("  %-5s ramp: steps=%u longest=%u steps in %.1fms jumps=%u early=%u reversals=%u\n", name, r.steps,
+           r.longest_steps, r.longest_us / 1000.0, r.jumps, r.early, r.reversals);
+}
+
+static bool check(bool ok, const char *what, ...) {
+    char buf[160];
+    va_list args;
+    va_start(args, what);
+    vsnprintf(buf, sizeof(buf), what, args);
+    va_end(args);
+    printf("  %s %s\n", ok ? "ok  " : "FAIL", buf);
+    return ok;
+}
+
+static int run(const Scenario &sc) {
+    printf("== %s: %s ==\n", sc.name, sc.description);
+
+    std::vector<SimUi> ui;
+    sc.build(ui);
+
+    sim_now_us = 0;
+    sim_hw_reset();
+    sim_on_channel_write = on_channel_write;
+    sim_bus.loss = sc.loss;
+
+    SimControllerIo io;
+    ControllerLink session(io);
+    session.delta = sc.delta;
+    SimController ctl;
+
+    MixerLinkState initial = ctl.currentState();
+    track_music.request(attenuation(initial.music_volume));
+    track_mic.request(attenuation(initial.mic_volume));
+
+    pt2258Reset();   // Body setup(): clear / reset, initial volume
+    updateVolume();
+
+    int64_t end_us = (ui.empty() ? 0 : ui.back().t_us) + SIM_DRAIN_MS * 1000LL;
+    int64_t ctrl_wake = 0;
+    int64_t body_wake = 0;
+    uint32_t last_heartbeat_ms = 0;
+    size_t ui_next = 0;
+    int spins = 0;
+    bool busy_loop = false;
+
+    for (;;) {
+        int64_t t = std::min({ctrl_wake, body_wake, sim_bus.nextDeliveryUs(),
+                              ui_next < ui.size() ? ui[ui_next].t_us : INT64_MAX});
+        if (t > end_us) break;
+        if (t > sim_now_us) sim_now_us = t;   // The body's I2C writes may have run past t
+
+        sim_bus.deliver();
+        if (sim_bus.pending(SIM_CONTROLLER)) ctrl_wake = sim_now_us;
+        if (sim_bus.pending(SIM_BODY)) body_wake = std::min(body_wake, sim_now_us);
+
+        // ---- Controller loop() ----
+        bool ui_due = ui_next < ui.size() && ui[ui_next].t_us <= sim_now_us;
+        if (ctrl_wake <= sim_now_us || ui_due) {
+            uint32_t now_ms = (uint32_t)(sim_now_us / 1000);
+            if (now_ms - last_heartbeat_ms > SIM_HEARTBEAT_MS) {
+                last_heartbeat_ms = now_ms;
+                session.requestState();
+            }
+
+            while (ui_next < ui.size() && ui[ui_next].t_us <= sim_now_us) {
+                const SimUi &cmd = ui[ui_next++];
+                sim_record(SIM_EV_UI, cmd.type, cmd.value);
+                ctl.apply(cmd, session);
+                MixerLinkState state = ctl.currentState();
+                track_music.request(attenuation(state.music_volume));
+                track_mic.request(attenuation(state.mic_volume));
+            }
+
+            session.service(ctl.currentState());
+
+            MixerLinkMessage msg;
+            int64_t rx_time_us;
+            while (sim_bus.receive(SIM_CONTROLLER, msg, rx_time_us)) {
+                if (msg.kind != MIXER_LINK_MSG_FRAME) continue;
+                session.handleFrame(msg.frame);
+            }
+
+            uint32_t wait_ms = session.waitMs(SIM_CTRL_WAIT_MS);
+            if (wait_ms == 0) {
+                if (++spins > SIM_MAX_SPINS) {
+                    busy_loop = true;
+                    break;
+                }
+                ctrl_wake = sim_now_us;
+            } else {
+                spins = 0;
+                ctrl_wake = sim_now_us + wait_ms * 1000LL;
+            }
+        }
+
+        // ---- Body loop() ----
+        if (body_wake <= sim_now_us) {
+            int64_t t0 = sim_now_us;
+            MixerLinkMessage msg;
+            int64_t rx_time_us;
+            if (sim_bus.receive(SIM_BODY, msg, rx_time_us) && msg.kind == MIXER_LINK_MSG_FRAME) {
+                handleLinkFrame(msg.frame, rx_time_us);
+            }
+            serviceRamp();
+            sendTelemetry();
+            recordLoopTime((uint32_t)(sim_now_us - t0));
+            on_body_pass();
+            body_wake = sim_bus.pending(SIM_BODY) ? sim_now_us : sim_now_us + rampWaitUs(SIM_BODY_WAIT_MS * 1000);
+        }
+    }
+
+    // ---- Report ----
+    const SimBusStats &bs = sim_bus.stats();
+    const LinkStats &ls = session.stats;
+    double seconds = sim_now_us / 1e6;
+    printf("  bus: ctrl->body %u B in %u writes, body->ctrl %u B in %u writes, %.1f B/s, occupancy %.2f%%\n",
+           bs.bytes[SIM_CONTROLLER], bs.writes[SIM_CONTROLLER], bs.bytes[SIM_BODY], bs.writes[SIM_BODY],
+           (bs.bytes[0] + bs.bytes[1]) / seconds, 100.0 * bs.busy_us / sim_now_us);
+    printf("  bus: damaged=%u collisions=%u crc_err(body)=%u crc_err(ctrl)=%u\n", bs.corrupted, bs.collisions,
+           sim_bus.parserStats(SIM_BODY).crc_errors, sim_bus.parserStats(SIM_CONTROLLER).crc_errors);
+    printf("  ctrl: delta=%u state=%u ack=%u nak=%u retx=%u superseded=%u lost=%u window_full=%u tlm=%u mismatch=%u poll=%u\n",
+           ls.deltas, ls.states, ls.acks, ls.naks, ls.retransmits, ls.superseded, ls.lost, ls.window_full,
+           ls.telemetry, ls.mismatches, ls.polls);
+    printf("  body: acks=%u naks=%u stale=%u replies_missed=%u telemetry=%u\n",
+           acksSent, naksSent, staleFields, repliesMissed, telemetrySent);
+    printf("  pt2258: i2c_writes=%u bytes=%u skipped=%u i2c_err=%u\n",
+           sim_hw.pt2258_writes, sim_hw.pt2258_bytes, i2cSkipped, i2cErrors);
+    print_latency("music", track_music);
+    print_latency("mic", track_mic);
+    print_ramp("music", ramp_music);
+    print_ramp("mic", ramp_mic);
+
+    // ---- Checks ----
+    bool ok = true;
+    ok &= check(!busy_loop, "controller loop sleeps (waitMs)");
+
+    MixerLinkState want = ctl.currentState();
+    ok &= check(sim_hw.att[0] == attenuation(want.music_volume) && sim_hw.att[1] == sim_hw.att[0],
+                "music channels at -%udB (want -%udB)", sim_hw.att[0], attenuation(want.music_volume));
+    ok &= check(sim_hw.att[2] == attenuation(want.mic_volume) && sim_hw.att[3] == sim_hw.att[2],
+                "mic channels at -%udB (want -%udB)", sim_hw.att[2], attenuation(want.mic_volume));
+    // Music relay: controller 1 = Bluetooth = LOW; mic relay: 1 = Wireless = HIGH
+    ok &= check(sim_hw.relay[BODY_RELAY_MUSIC] == !want.music_relay && sim_hw.relay[BODY_RELAY_MIC] == want.mic_relay,
+                "relays music=%d mic=%d", sim_hw.relay[BODY_RELAY_MUSIC], sim_hw.relay[BODY_RELAY_MIC]);
+    ok &= check(sim_hw.bt_running == want.music_relay, "bluetooth %s", sim_hw.bt_running ? "running" : "stopped");
+    ok &= check(track_music.out_of_order == 0 && track_mic.out_of_order == 0,
+                "volume order (out of order: music=%u mic=%u)", track_music.out_of_order, track_mic.out_of_order);
+    ok &= check(ramp_music.jumps + ramp_mic.jumps + ramp_music.early + ramp_mic.early == 0,
+                "volume ramps in 1 dB steps, >= %uus apart", rampStepUs);
+    if (sc.single_ramp) {
+        // Back-to-back steps: one step period each, a loop pass late at most
+        bool timed = true;
+        for (const RampTrack *r : {&ramp_music, &ramp_mic}) {
+            int64_t want = (int64_t)(r->longest_steps - 1) * rampStepUs;
+            if (r->reversals != 0 || r->longest_us < want || r->longest_us > want + want / 10) timed = false;
+        }
+        ok &= check(timed, "ramps monotonic, %uus per dB (music %u dB in %.1fms, mic %u dB in %.1fms)", rampStepUs,
+                    ramp_music.longest_steps, ramp_music.longest_us / 1000.0,
+                    ramp_mic.longest_steps, ramp_mic.longest_us / 1000.0);
+    }
+    ok &= check(sim_hw.antipop_violations == 0, "relay anti-pop (violations=%u)", sim_hw.antipop_violations);
+    int64_t power_off_us = -1, bt_end_us = -1;
+    for (const SimEvent &ev : sim_events()) {
+        if (ev.kind == SIM_EV_UI && ev.a == UI_POWER_OFF && power_off_us < 0) power_off_us = ev.t_us;
+        if (ev.kind == SIM_EV_BT_END && power_off_us >= 0 && bt_end_us < 0) bt_end_us = ev.t_us;
+    }
+    if (power_off_us >= 0) {
+        ok &= check(bt_end_us >= 0, "shutdown stops bluetooth, faded out first (%.1fms after POWER off)",
+                    (bt_end_us - power_off_us) / 1000.0);
+    }
+    ok &= check(bs.collisions == 0, "half duplex, no collisions");
+    // With loss injection the newest TELEMETRY frame itself may be damaged
+    bool tlm_ok = session.body_valid && !mixer_link_state_diff(session.body.state, want);
+    int64_t tlm_last_us = -1, tlm_gap_us = 0;
+    for (const SimEvent &ev : sim_events()) {
+        if (ev.kind != SIM_EV_RX || ev.a != SIM_CONTROLLER || ev.b != MIXER_LINK_TYPE_TELEMETRY) continue;
+        if (tlm_last_us >= 0) tlm_gap_us = std::max(tlm_gap_us, ev.t_us - tlm_last_us);
+        tlm_last_us = ev.t_us;
+    }
+    if (sc.loss == 0.0) {
+        ok &= check(tlm_ok, "controller telemetry matches the body");
+        ok &= check(tlm_gap_us <= SIM_TLM_GAP_MS * 1000LL, "telemetry at least once a second (longest gap %.1fms)",
+                    tlm_gap_us / 1000.0);
+    } else {
+        printf("  info controller telemetry %s the body\n", tlm_ok ? "matches" : "lags");
+    }
+    printf("\n");
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char **argv) {
+    std::vector<const Scenario *> selected;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-v")) {
+            sim_verbose = true;
+            continue;
+        }
+        if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+            sim_bus.seed = (uint32_t)strtoul(argv[++i], nullptr, 0);   // Loss injection
+            continue;
+        }
+        const Scenario *found = nullptr;
+        for (const Scenario &sc : scenarios) {
+            if (!strcmp(sc.name, argv[i])) found = &sc;
+        }
+        if (!found) {
+            fprintf(stderr, "unknown scenario '%s', have:", argv[i]);
+            for (const Scenario &sc : scenarios) fprintf(stderr, " %s", sc.name);
+            fprintf(stderr, "\n");
+            return 2;
+        }
+        selected.push_back(found);
+    }
+    if (selected.empty()) {
+        for (const Scenario &sc : scenarios) selected.push_back(&sc);
+    }
+
+    // body_logic.cpp keeps its state in globals: one process per scenario
+    int failed = 0;
+    for (const Scenario *sc : selected) {
+        fflush(stdout);
+        pid_t pid = fork();
+        if (pid == 0) {
+            int rc = run(*sc);
+            fflush(stdout);
+            _exit(rc);
+        }
+        int status = 0;
+        waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            failed++;
+            if (!WIFEXITED(status)) printf("  FAIL %s crashed\n\n", sc->name);
+        }
+    }
+    printf("%d of %zu scenarios failed\n", failed, selected.size());
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+/*
+ * MixerSim - host simulation of the controller <-> body RS485 link
+ *
+ * One virtual clock (microseconds), advanced by the scheduler in main.cpp
+ * and by the fake hardware (I2C writes take bus time). Both firmwares run
+ * their real link code: ControllerLink on one side, body_logic.cpp on the
+ * other, connected by SimBus.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include <deque>
+#include <mixer_link.h>
+#include <mixer_link_rx.h>
+
+#define SIM_BAUD            (115200)
+#define SIM_RX_TIMEOUT_SYMS (2)      // Same as MIXER_LINK_UART_RX_TIMEOUT
+#define SIM_I2C_START_US    (110)    // 100 kHz: start, address byte, stop
+#define SIM_I2C_BYTE_US     (90)     // 100 kHz: data byte + ACK
+#define SIM_SETTLE_MIN_MS   (45)     // LINK_RELAY_SETTLE_MS less frame timing jitter
+
+extern int64_t sim_now_us;
+extern bool sim_verbose;
+
+// ----------------------------------------------------------------------
+// Side effects, recorded with their time
+// ----------------------------------------------------------------------
+
+enum SimNode : uint8_t { SIM_CONTROLLER = 0, SIM_BODY = 1 };
+
+enum SimEventKind : uint8_t {
+    SIM_EV_PT2258 = 0,   // a = register byte
+    SIM_EV_RELAY,        // a = BodyRelay, b = level
+    SIM_EV_BT_START,
+    SIM_EV_BT_END,
+    SIM_EV_TX,           // a = node, b = bytes
+    SIM_EV_RX,           // a = node, b = frame type
+    SIM_EV_UI,           // a = AppCommandType, b = value
+};
+
+struct SimEvent {
+    int64_t t_us;
+    SimEventKind kind;
+    uint16_t a;
+    uint16_t b;
+};
+
+void sim_record(SimEventKind kind, uint16_t a = 0, uint16_t b = 0);
+const std::vector<SimEvent> &sim_events();
+void sim_trace(const char *who, const char *fmt, ...);   // Verbose only
+
+// ----------------------------------------------------------------------
+// Fake body hardware (sim_hal.cpp): PT2258 registers, relay pins, A2DP
+// ----------------------------------------------------------------------
+
+#define SIM_PT2258_CHANNELS (6)
+
+struct SimBodyHw {
+    uint8_t att[SIM_PT2258_CHANNELS];   // dB attenuation per channel, 79 = mute
+    int64_t muted_since_us[SIM_PT2258_CHANNELS];   // -1 = not muted
+    bool relay[2];                      // Pin level per BodyRelay
+    bool bt_running;
+    uint32_t pt2258_writes;             // I2C transactions
+    uint32_t pt2258_bytes;
+    uint32_t antipop_violations;        // Relay switched with its channels not muted for SIM_SETTLE_MIN_MS,
+                                        // or Bluetooth stopped with the music channels not muted
+};
+
+extern SimBodyHw sim_hw;
+void sim_hw_reset();
+
+// Called for each channel a transaction wrote, after it completed, channel 0-5.
+// `start_us` = start condition of the transaction.
+extern void (*sim_on_channel_write)(int ch, uint8_t att, int64_t start_us);
+
+// ----------------------------------------------------------------------
+// Virtual RS485 bus: byte timing, collisions, loss injection
+// ----------------------------------------------------------------------
+
+struct SimBusStats {
+    uint32_t bytes[2];        // Sent by node
+    uint32_t writes[2];
+    uint32_t collisions;      // Transmissions that overlapped the other node
+    uint32_t corrupted;       // Transmissions damaged by loss injection
+    int64_t busy_us;          // Time with at least one driver on the bus
+};
+
+class SimBus {
+public:
+    // Loss injection: probability that a transmission gets one byte damaged
+    double loss = 0.0;
+    uint32_t seed = 1;
+
+    // Queued behind the node's own earlier writes (UART TX FIFO)
+    void write(SimNode from, const uint8_t *data, size_t len);
+
+    // Hands every transmission finished by sim_now_us to the other node
+    void deliver();
+    int64_t nextDeliveryUs() const;   // INT64_MAX if idle
+
+    // Receive side of each node, with the RX event time of each message
+    bool receive(SimNode node, MixerLinkMessage &msg, int64_t &rx_time_us);
+    bool pending(SimNode node) const { return !rx_times[node].empty(); }
+
+    const SimBusStats &stats() const { return _stats; }
+    const MixerLinkRxStats &parserStats(SimNode node) const { return rx[node].stats(); }
+
+    static int64_t byteUs() { return 10 * 1000000LL / SIM_BAUD; }
+
+private:
+    struct Transmission {
+        SimNode from;
+        int64_t start_us;
+        int64_t end_us;
+        std::vector<uint8_t> data;
+        bool collided;
+    };
+    std::deque<Transmission> in_flight;
+    int64_t tx_free_us[2] = {};
+    int64_t busy_until_us = 0;
+    MixerLinkRx rx[2];
+    std::deque<int64_t> rx_times[2];
+    SimBusStats _stats = {};
+
+    uint32_t random();
+};
+
+extern SimBus sim_bus;
@@ -0,0 +1,105 @@
+#include "sim.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <inttypes.h>
+
+int64_t sim_now_us = 0;
+bool sim_verbose = false;
+SimBus sim_bus;
+
+static std::vector<SimEvent> events;
+
+void sim_record(SimEventKind kind, uint16_t a, uint16_t b) {
+    events.push_back({sim_now_us, kind, a, b});
+}
+
+const std::vector<SimEvent> &sim_events() {
+    return events;
+}
+
+void sim_trace(const char *who, const char *fmt, ...) {
+    if (!sim_verbose) return;
+    printf("%10.3fms %-4s ", sim_now_us / 1000.0, who);
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+}
+
+// ----------------------------------------------------------------------
+// SimBus
+// ----------------------------------------------------------------------
+
+uint32_t SimBus::random() {
+    seed = seed * 1664525u + 1013904223u;
+    return seed >> 8;
+}
+
+void SimBus::write(SimNode from, const uint8_t *data, size_t len) {
+    if (!len) return;
+
+    Transmission tx;
+    tx.from = from;
+    tx.start_us = sim_now_us > tx_free_us[from] ? sim_now_us : tx_free_us[from];
+    tx.end_us = tx.start_us + (int64_t)len * byteUs();
+    tx.data.assign(data, data + len);
+    tx.collided = false;
+    tx_free_us[from] = tx.end_us;
+
+    // Half duplex: both drivers on at once garbles both transmissions
+    for (Transmission &other : in_flight) {
+        if (other.from != from && other.start_us < tx.end_us && tx.start_us < other.end_us) {
+            if (!other.collided) _stats.collisions++;
+            if (!tx.collided) _stats.collisions++;
+            other.collided = tx.collided = true;
+        }
+    }
+
+    if (loss > 0.0 && (random() & 0xFFFF) < (uint32_t)(loss * 0x10000)) {
+        tx.data[random() % len] ^= 0x5A;
+        _stats.corrupted++;
+    }
+
+    // Bus occupancy, counted once where transmissions overlap
+    int64_t from_us = tx.start_us > busy_until_us ? tx.start_us : busy_until_us;
+    if (tx.end_us > from_us) _stats.busy_us += tx.end_us - from_us;
+    if (tx.end_us > busy_until_us) busy_until_us = tx.end_us;
+
+    _stats.bytes[from] += len;
+    _stats.writes[from]++;
+    sim_record(SIM_EV_TX, from, len);
+
+    // Keep in_flight ordered by end time
+    auto it = in_flight.end();
+    while (it != in_flight.begin() && (it - 1)->end_us > tx.end_us) --it;
+    in_flight.insert(it, std::move(tx));
+}
+
+int64_t SimBus::nextDeliveryUs() const {
+    if (in_flight.empty()) return INT64_MAX;
+    return in_flight.front().end_us + SIM_RX_TIMEOUT_SYMS * byteUs();
+}
+
+void SimBus::deliver() {
+    while (!in_flight.empty() && nextDeliveryUs() <= sim_now_us) {
+        Transmission tx = std::move(in_flight.front());
+        in_flight.pop_front();
+
+        SimNode to = tx.from == SIM_CONTROLLER ? SIM_BODY : SIM_CONTROLLER;
+        if (tx.collided) {
+            for (uint8_t &b : tx.data) b ^= 0xFF;
+        }
+        // RX event after the idle timeout that ends the burst
+        int64_t rx_time_us = tx.end_us + SIM_RX_TIMEOUT_SYMS * byteUs();
+        size_t n = rx[to].feed(tx.data.data(), tx.data.size());
+        for (size_t i = 0; i < n; i++) rx_times[to].push_back(rx_time_us);
+    }
+}
+
+bool SimBus::receive(SimNode node, MixerLinkMessage &msg, int64_t &rx_time_us) {
+    if (rx_times[node].empty() || !rx[node].pop(msg)) return false;
+    rx_time_us = rx_times[node].front();
+    rx_times[node].pop_front();
+    if (msg.kind == MIXER_LINK_MSG_FRAME) sim_record(SIM_EV_RX, node, msg.frame.type);
+    return true;
+}
@@ -0,0 +1,124 @@
+// Fake body hardware behind body_hal.h: records every call on the virtual clock
+
+#include "sim.h"
+#include <body_hal.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+SimBodyHw sim_hw;
+void (*sim_on_channel_write)(int ch, uint8_t att, int64_t start_us) = nullptr;
+
+// PT2258 register pairs (10 dB, 1 dB) per channel, see body_logic.cpp
+static const uint8_t pt2258_regs[SIM_PT2258_CHANNELS][2] = {
+    {0x80, 0x90}, {0x40, 0x50}, {0x00, 0x10}, {0x20, 0x30}, {0x60, 0x70}, {0xA0, 0xB0},
+};
+
+// Channels each relay switches: music = Ch1/Ch2, mic = Ch3/Ch4
+static const int relay_channels[2][2] = { {0, 1}, {2, 3} };
+
+void sim_hw_reset() {
+    memset(&sim_hw, 0, sizeof(sim_hw));
+    for (int ch = 0; ch < SIM_PT2258_CHANNELS; ch++) {
+        sim_hw.att[ch] = 79;   // Muted after the 0xC0 clear in setup()
+        sim_hw.muted_since_us[ch] = 0;
+    }
+}
+
+bool hal_pt2258_write(const uint8_t *data, size_t len) {
+    int64_t start_us = sim_now_us;
+    sim_now_us += SIM_I2C_START_US + (int64_t)len * SIM_I2C_BYTE_US;
+    sim_hw.pt2258_writes++;
+    sim_hw.pt2258_bytes += len;
+
+    bool touched[SIM_PT2258_CHANNELS] = {};
+    for (size_t i = 0; i < len; i++) {
+        sim_record(SIM_EV_PT2258, data[i]);
+        uint8_t reg = data[i] & 0xF0;
+        uint8_t val = data[i] & 0x0F;
+        for (int ch = 0; ch < SIM_PT2258_CHANNELS; ch++) {
+            if (reg == pt2258_regs[ch][0]) {
+                sim_hw.att[ch] = (uint8_t)(val * 10 + sim_hw.att[ch] % 10);
+                touched[ch] = true;
+            } else if (reg == pt2258_regs[ch][1]) {
+                sim_hw.att[ch] = (uint8_t)(sim_hw.att[ch] / 10 * 10 + val);
+                touched[ch] = true;
+            }
+        }
+    }
+
+    // Channel values as of the stop condition: the bytes of one transaction
+    // latch a few hundred microseconds apart, far below anything audible
+    for (int ch = 0; ch < SIM_PT2258_CHANNELS; ch++) {
+        if (!touched[ch]) continue;
+        if (sim_hw.att[ch] != 79) {
+            sim_hw.muted_since_us[ch] = -1;
+        } else if (sim_hw.muted_since_us[ch] < 0) {
+            sim_hw.muted_since_us[ch] = sim_now_us;
+        }
+        if (sim_on_channel_write) sim_on_channel_write(ch, sim_hw.att[ch], start_us);
+    }
+    return true;
+}
+
+void hal_relay_write(BodyRelay relay, bool high) {
+    sim_record(SIM_EV_RELAY, relay, high);
+    if (sim_hw.relay[relay] == high) return;
+
+    // Anti-pop: a relay may only switch after its channels settled muted
+    for (int ch : relay_channels[relay]) {
+        int64_t since = sim_hw.muted_since_us[ch];
+        if (since < 0 || sim_now_us - since < SIM_SETTLE_MIN_MS * 1000LL) {
+            sim_hw.antipop_violations++;
+            sim_trace("sim", "relay %d -> %d with ch%d at -%udB, muted %lldms\n", relay, high, ch + 1,
+                      sim_hw.att[ch], since < 0 ? -1LL : (long long)((sim_now_us - since) / 1000));
+            break;
+        }
+    }
+    sim_hw.relay[relay] = high;
+}
+
+void hal_bt_start() {
+    sim_record(SIM_EV_BT_START);
+    sim_hw.bt_running = true;
+}
+
+void hal_bt_end() {
+    sim_record(SIM_EV_BT_END);
+
+    // Anti-pop: the A2DP sink stops with the music channels muted
+    for (int ch : relay_channels[BODY_RELAY_MUSIC]) {
+        if (sim_hw.muted_since_us[ch] < 0) {
+            sim_hw.antipop_violations++;
+            sim_trace("sim", "bluetooth stopped with ch%d at -%udB\n", ch + 1, sim_hw.att[ch]);
+            break;
+        }
+    }
+    sim_hw.bt_running = false;
+}
+
+bool hal_bt_connected() {
+    return false;   // No phone in the simulation
+}
+
+void hal_link_write(const uint8_t *data, size_t len) {
+    sim_bus.write(SIM_BODY, data, len);
+}
+
+int64_t hal_now_us() {
+    return sim_now_us;
+}
+
+uint32_t hal_millis() {
+    return (uint32_t)(sim_now_us / 1000);
+}
+
+void hal_log(const char *fmt, ...) {
+    if (!sim_verbose) return;
+    char buf[160];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    sim_trace("body", "%s", buf);
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+/*
+ * UiBench - shared between the benchmark driver and the host AppData
+ */
+
+#include <stdint.h>
+#include <lvgl.h>
+#include <ui_screens.h>
+
+extern uint32_t bench_now_ms;       // Virtual clock, millis() for LVGL
+extern uint32_t bench_commands[];   // AppData.post() calls per AppCommandType
+
+int blend_check();                  // -k: ui_blend kernels against LVGL, pixels and speed (blend_check.cpp)
+int rect_check();                   // -r: ui_corner_cache against LVGL, pixels and Screen1 speed (rect_check.cpp)
+int style_check();                  // -s: ui_style_cache against LVGL, values and Screen1 lookup time (style_check.cpp)
+int mem_check();                    // -a: ui_mem, calls checked, speed against malloc(), the UI's use (mem_check.cpp)
+void bench_screen_built(UiScreenId id, lv_obj_t *screen);  // main.cpp's ui_screens_init() callback
+lv_disp_t *check_display(lv_coord_t w, lv_coord_t h);  // LVGL and a display being refreshed, for -k / -r / -a
@@ -0,0 +1,61 @@
+/*
+ * AppData for the UI on the host: event callbacks (ui_events_impl.cpp) post
+ * their commands here, UiBench counts them instead of driving RS485, and
+ * syncUI() sets the widgets from the saved values
+ */
+
+#include "bench.h"
+#include <app_data.h>
+#include <ui/ui.h>
+#include <stdio.h>
+
+AppDataManager AppData;
+
+uint32_t bench_commands[APP_CMD_POWER_SENSING + 1];
+
+extern lv_obj_t *ui_power_switch;     // ui_events_impl.cpp
+
+bool AppDataManager::post(AppCommandType type, int value) {
+    (void)value;
+    if (type <= APP_CMD_POWER_SENSING) bench_commands[type]++;
+    return true;
+}
+
+// As app_data.cpp, which does not build on the host (Preferences, RS485)
+void AppDataManager::syncUI() {
+    if (ui_Slider1) lv_slider_set_value(ui_Slider1, mic_volume, LV_ANIM_OFF);
+    if (ui_Slider2) lv_slider_set_value(ui_Slider2, music_volume, LV_ANIM_OFF);
+    if (ui_Slider3) lv_slider_set_value(ui_Slider3, main_fader, LV_ANIM_OFF);
+
+    if (mic_relay_state) {
+        if (ui_Button3) lv_obj_clear_state(ui_Button3, LV_STATE_CHECKED);
+        if (ui_Button4) lv_obj_add_state(ui_Button4, LV_STATE_CHECKED);
+    } else {
+        if (ui_Button3) lv_obj_add_state(ui_Button3, LV_STATE_CHECKED);
+        if (ui_Button4) lv_obj_clear_state(ui_Button4, LV_STATE_CHECKED);
+    }
+    if (music_relay_state) {
+        if (ui_Button1) lv_obj_clear_state(ui_Button1, LV_STATE_CHECKED);
+        if (ui_Button2) lv_obj_add_state(ui_Button2, LV_STATE_CHECKED);
+    } else {
+        if (ui_Button1) lv_obj_add_state(ui_Button1, LV_STATE_CHECKED);
+        if (ui_Button2) lv_obj_clear_state(ui_Button2, LV_STATE_CHECKED);
+    }
+    if (ui_power_switch) {
+        if (power_sensing_enabled) lv_obj_add_state(ui_power_switch, LV_STATE_CHECKED);
+        else lv_obj_clear_state(ui_power_switch, LV_STATE_CHECKED);
+    }
+}
+
+void UartLinkIo::log(const char *fmt, ...) {
+    (void)fmt;
+}
+
+// ----------------------------------------------------------------------
+// Virtual clock (Arduino.h): LVGL ticks and animations follow the script
+// ----------------------------------------------------------------------
+
+uint32_t bench_now_ms = 0;
+
+extern "C" uint32_t millis(void) { return bench_now_ms; }
+extern "C" uint32_t micros(void) { return bench_now_ms * 1000; }
@@ -0,0 +1,264 @@
+/*
+ * UiBench -k: the fill kernels of ui_blend.cpp against LVGL's own
+ * lv_draw_sw_blend_basic()
+ *
+ * Check: random fills (area, clip, alignment, color, opa, mask contents and
+ * mask result) on random and on flat backgrounds, every kernel table must
+ * give the same pixels as LVGL, through ui_blend_fill() (every kernel) and
+ * ui_blend() (what the UI runs). Speed: each fill case on the whole 800x480
+ * screen, LVGL and every table's kernel.
+ */
+
+#include "bench.h"
+#include <ui_blend.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#define CHECK_W         (160)       // Buffer of the check, blends inside it
+#define CHECK_H         (48)
+#define CHECK_CASES     (20000)
+#define SPEED_W         (800)
+#define SPEED_H         (480)
+#define SPEED_MS        (200)       // Per case and kernel table
+
+static const UiBlendKernels *const tables[] = { &ui_blend_word32, &ui_blend_word64 };
+
+static void no_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    (void)area;
+    (void)color_map;
+    lv_disp_flush_ready(drv);
+}
+
+// Both blend paths read the display being refreshed
+lv_disp_t *check_display(lv_coord_t w, lv_coord_t h)
+{
+    static lv_disp_draw_buf_t disp_buf;
+    static lv_disp_drv_t disp_drv;
+    static lv_color_t buf[CHECK_W * 8];
+
+    lv_init();
+    lv_disp_draw_buf_init(&disp_buf, buf, nullptr, CHECK_W * 8);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = w;
+    disp_drv.ver_res = h;
+    disp_drv.draw_buf = &disp_buf;
+    disp_drv.flush_cb = no_flush;
+    lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+    _lv_refr_set_disp_refreshing(disp);
+    return disp;
+}
+
+struct BlendCase {
+    lv_draw_ctx_t ctx;
+    lv_area_t buf_area, clip, blend, mask_area;
+    lv_draw_sw_blend_dsc_t dsc;
+    std::vector<lv_opa_t> mask;
+};
+
+// Mask bytes as the renderer makes them: transparent / covered runs, AA edges, noise
+static void random_mask(std::mt19937 &rng, std::vector<lv_opa_t> &mask)
+{
+    size_t i = 0;
+    while (i < mask.size()) {
+        size_t run = 1 + rng() % 24;
+        int kind = rng() % 4;
+        for (size_t k = 0; k < run && i < mask.size(); k++, i++) {
+            switch (kind) {
+                case 0: mask[i] = LV_OPA_TRANSP; break;
+                case 1: mask[i] = LV_OPA_COVER; break;
+                case 2: mask[i] = (lv_opa_t)(k * 255 / run); break;
+                default: mask[i] = (lv_opa_t)rng(); break;
+            }
+        }
+    }
+}
+
+static void random_case(std::mt19937 &rng, BlendCase &c, lv_color_t *buf)
+{
+    // The buffer may start anywhere in the screen, the blend anywhere around the clip
+    lv_coord_t bx = rng() % 5, by = rng() % 3;
+    c.buf_area = { bx, by, (lv_coord_t)(bx + CHECK_W - 1), (lv_coord_t)(by + CHECK_H - 1) };
+    auto rnd_area = [&](lv_area_t &a, lv_coord_t x0, lv_coord_t y0, lv_coord_t w, lv_coord_t h) {
+        a.x1 = x0 + rng() % w;
+        a.y1 = y0 + rng() % h;
+        a.x2 = a.x1 + rng() % w;
+        a.y2 = a.y1 + rng() % (h / 2 + 1);
+    };
+    rnd_area(c.clip, bx, by, CHECK_W, CHECK_H);
+    lv_area_t clip_in;
+    if (!_lv_area_intersect(&clip_in, &c.clip, &c.buf_area)) clip_in = c.buf_area;
+    c.clip = clip_in;
+    rnd_area(c.blend, bx - 4, by - 2, CHECK_W, CHECK_H);
+
+    memset(&c.ctx, 0, sizeof(c.ctx));
+    c.ctx.buf = buf;
+    c.ctx.buf_area = &c.buf_area;
+    c.ctx.clip_area = &c.clip;
+
+    memset(&c.dsc, 0, sizeof(c.dsc));
+    c.dsc.blend_area = &c.blend;
+    c.dsc.color.full = (uint16_t)rng();
+    static const lv_opa_t opas[] = { LV_OPA_COVER, LV_OPA_MAX, LV_OPA_MAX - 1, 252, 128, 3 };
+    c.dsc.opa = (rng() % 2) ? opas[rng() % 6] : (lv_opa_t)rng();
+    c.dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+
+    // Mask: none, or over the blend area, starting at any byte
+    int mask_kind = rng() % 4;
+    if (mask_kind) {
+        c.mask_area = c.blend;
+        c.mask.resize(lv_area_get_size(&c.mask_area) + 8);
+        random_mask(rng, c.mask);
+        c.dsc.mask_buf = c.mask.data() + rng() % 8;
+        c.dsc.mask_area = &c.mask_area;
+        c.dsc.mask_res = (mask_kind == 1) ? LV_DRAW_MASK_RES_FULL_COVER :
+                         (mask_kind == 2 && rng() % 8 == 0) ? LV_DRAW_MASK_RES_TRANSP : LV_DRAW_MASK_RES_CHANGED;
+    }
+}
+
+static void random_background(std::mt19937 &rng, std::vector<lv_color_t> &bg)
+{
+    // Flat with a few runs of other colors (what a UI has), or noise
+    bool flat = rng() % 2;
+    uint16_t base = (uint16_t)rng();
+    for (size_t i = 0; i < bg.size(); i++) {
+        bg[i].full = flat ? base : (uint16_t)rng();
+        if (flat && rng() % 64 == 0) base = (uint16_t)rng();
+    }
+}
+
+static int check()
+{
+    std::mt19937 rng(1234);
+    // +1: the same case with the buffer at an odd pixel
+    std::vector<lv_color_t> bg(CHECK_W * CHECK_H + 1), ref, out;
+    int failed = 0;
+
+    for (int n = 0; n < CHECK_CASES; n++) {
+        random_background(rng, bg);
+        size_t ofs = rng() % 2;
+        BlendCase c;
+
+        ref = bg;
+        random_case(rng, c, ref.data() + ofs);
+        lv_draw_sw_blend_basic(&c.ctx, &c.dsc);
+
+        for (const UiBlendKernels *table : tables) {
+            for (auto blend : { ui_blend_fill, ui_blend }) {
+                out = bg;
+                c.ctx.buf = out.data() + ofs;
+                ui_blend_install(nullptr, table);
+                blend(&c.ctx, &c.dsc);
+                if (memcmp(out.data(), ref.data(), out.size() * sizeof(lv_color_t))) {
+                    if (failed++ < 10) {
+                        printf("  FAIL %s%s case %d: blend (%d,%d)-(%d,%d) clip (%d,%d)-(%d,%d) opa %u mask %s\n",
+                               table->name, blend == ui_blend ? " ui_blend" : "", n,
+                               c.blend.x1, c.blend.y1, c.blend.x2, c.blend.y2, c.clip.x1, c.clip.y1, c.clip.x2, c.clip.y2, c.dsc.opa,
+                               !c.dsc.mask_buf ? "none" : c.dsc.mask_res == LV_DRAW_MASK_RES_FULL_COVER ? "full" :
+                               c.dsc.mask_res == LV_DRAW_MASK_RES_TRANSP ? "transp" : "changed");
+                    }
+                }
+            }
+        }
+    }
+    printf("  %d cases x %zu tables x 2 paths: %s\n", CHECK_CASES, sizeof(tables) / sizeof(tables[0]),
+           failed ? "FAIL" : "pixel exact");
+    return failed ? 1 : 0;
+}
+
+// ----------------------------------------------------------------------
+// Speed
+// ----------------------------------------------------------------------
+
+struct SpeedCase {
+    const char *name;
+    lv_opa_t opa;
+    bool mask;
+};
+
+static const SpeedCase speed_cases[] = {
+    { "fill", LV_OPA_COVER, false },
+    { "fill opa", LV_OPA_50, false },
+    { "fill mask", LV_OPA_COVER, true },
+    { "fill mask opa", LV_OPA_50, true },
+};
+
+// Megapixels per second of `blend` on the whole screen
+static double speed(void (*blend)(lv_draw_ctx_t *, const lv_draw_sw_blend_dsc_t *), lv_draw_ctx_t *ctx,
+                    const lv_draw_sw_blend_dsc_t *dsc, const std::vector<lv_color_t> &bg, std::vector<lv_color_t> &buf)
+{
+    uint64_t px = 0;
+    double s = 0;
+    do {
+        memcpy(buf.data(), bg.data(), bg.size() * sizeof(lv_color_t));     // The same background every time
+        auto t0 = std::chrono::steady_clock::now();
+        blend(ctx, dsc);
+        s += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        px += SPEED_W * SPEED_H;
+    } while (s * 1000 < SPEED_MS);
+    return px / s / 1e6;
+}
+
+static void speed_all()
+{
+    // Background: the Screen1 panels (flat, a few color bands); mask: anti-aliased
+    // disc edges and glyph-like noise around a covered middle, as the UI draws
+    std::vector<lv_color_t> bg(SPEED_W * SPEED_H), buf(SPEED_W * SPEED_H);
+    for (int y = 0; y < SPEED_H; y++) {
+        for (int x = 0; x < SPEED_W; x++) bg[y * SPEED_W + x].full = (y / 60 % 2) ? 0x2124 : 0x18E3;
+    }
+    std::vector<lv_opa_t> mask(SPEED_W * SPEED_H);
+    for (int y = 0; y < SPEED_H; y++) {
+        for (int x = 0; x < SPEED_W; x++) {
+            int dx = x - SPEED_W / 2, dy = y - SPEED_H / 2;
+            int d = 200 - (int)sqrt((double)(dx * dx + dy * dy));     // Disc of radius 200
+            mask[y * SPEED_W + x] = d >= 1 ? (lv_opa_t)LV_OPA_COVER : d <= -1 ? (lv_opa_t)LV_OPA_TRANSP : (lv_opa_t)LV_OPA_50;
+            if (x % 40 < 10 && y % 30 < 20) mask[y * SPEED_W + x] = (lv_opa_t)(x * 37 + y * 11);
+        }
+    }
+
+    lv_area_t screen = { 0, 0, SPEED_W - 1, SPEED_H - 1 };
+    lv_draw_ctx_t ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.buf = buf.data();
+    ctx.buf_area = &screen;
+    ctx.clip_area = &screen;
+
+    printf("  %-14s %12s", "MPx/s", "LVGL");
+    for (const UiBlendKernels *table : tables) printf(" %12s", table->name);
+    printf("\n");
+    for (const SpeedCase &sc : speed_cases) {
+        lv_draw_sw_blend_dsc_t dsc;
+        memset(&dsc, 0, sizeof(dsc));
+        dsc.blend_area = &screen;
+        dsc.color.full = 0xFD20;
+        dsc.opa = sc.opa;
+        if (sc.mask) {
+            dsc.mask_buf = mask.data();
+            dsc.mask_area = &screen;
+            dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+        }
+        double stock = speed(lv_draw_sw_blend_basic, &ctx, &dsc, bg, buf);
+        printf("  %-14s %12.0f", sc.name, stock);
+        for (const UiBlendKernels *table : tables) {
+            ui_blend_install(nullptr, table);
+            double mpx = speed(ui_blend_fill, &ctx, &dsc, bg, buf);
+            printf(" %7.0f %3.1fx", mpx, mpx / stock);
+        }
+        printf("\n");
+    }
+}
+
+int blend_check()
+{
+    check_display(CHECK_W, CHECK_H);
+    printf("== blend: ui_blend kernels against lv_draw_sw_blend_basic()\n");
+    int rc = check();
+    speed_all();
+    printf("\n");
+    return rc;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+/*
+ * Host stand-in for the Arduino core: just what the UI sources and
+ * app_data.h need. The clock is UiBench's virtual clock, so LVGL
+ * (LV_TICK_CUSTOM = millis()) runs on scripted time.
+ * Included from LVGL's C sources too.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t millis(void);
+uint32_t micros(void);
+
+#ifdef __cplusplus
+}
+
+class String;       // Only referenced, never used by the UI
+class Stream;
+typedef void *TaskHandle_t;
+#endif
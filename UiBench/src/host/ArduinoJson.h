@@ -0,0 +1,3 @@
+#pragma once
+
+// Host stand-in: app_data.h includes ArduinoJson, the UI does not use it
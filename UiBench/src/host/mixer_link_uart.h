@@ -0,0 +1,19 @@
+#pragma once
+
+/*
+ * Host stand-in for MixerLinkUart (ESP-IDF UART driver): the UI only posts
+ * commands to AppData, nothing reaches RS485 in UiBench
+ */
+
+#include "mixer_link_rx.h"
+#include "mixer_link_histogram.h"
+
+struct MixerLinkRxItem {
+    MixerLinkMessage msg;
+    int64_t rx_time_us;
+};
+
+class MixerLinkUart {
+public:
+    void write(const uint8_t *data, size_t len) { (void)data; (void)len; }
+};
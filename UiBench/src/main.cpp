@@ -0,0 +1,780 @@
+/*
+ * UiBench - renders the SquareLine UI of MixerController on a PC
+ *
+ * Usage: ui_bench [-m direct|full|partial] [-b blend] [-R] [-S] [-o file] [-c file] [-t pct] [scenario ...]
+ *        ui_bench [-m mode] [-b blend] [-R] [-S] -g|-G dir [shot ...]   (no scenario / shot = all of them)
+ *        ui_bench -k | -r | -s | -a
+ *
+ * Compiles the controller's UI sources, event callbacks (ui_events_impl.cpp),
+ * lv_conf.h and LVGL tree against a memory-backed 800x480 display and a
+ * scripted touch input, on a virtual clock. The UI starts as main.cpp starts
+ * it (ui_screens.cpp: splash, Screen1 built while it shows, Screen2 on first
+ * use). Each scenario reports per frame:
+ *   - render time (host CPU, for comparison between runs only)
+ *   - refreshed area (invalidated areas after LVGL joined them)
+ *   - pixels blended by the software renderer
+ *   - image bytes read (image pixels drawn x bytes per pixel of their format)
+ *     and the part of the render time spent drawing images
+ *   - direct mode: pixels copied to keep both frame buffers in sync
+ * Pixel counts do not depend on the host, "-o" saves them as a baseline and
+ * "-c" fails (exit status 1) if a scenario got more than "-t" percent
+ * (default 5) more expensive than the baseline.
+ *
+ * Golden images: "-G dir" saves the screen of each shot (Screen1/2/3 in
+ * known states) as dir/<shot>.png, "-g dir" compares pixel for pixel and
+ * reports the bounding box of the differences, writing dir/<shot>.actual.png.
+ *
+ * Blending goes through ui_blend.cpp as on the device, "-b" picks its kernel
+ * table or "lvgl" for LVGL's own. "-k" checks every table pixel for pixel
+ * against LVGL and times them (blend_check.cpp).
+ *
+ * Rounded backgrounds come from ui_corner_cache.cpp, "-R" draws them with
+ * LVGL's lv_draw_sw_rect(). "-r" checks the cache against LVGL and times the
+ * Screen1 rectangles (rect_check.cpp).
+ *
+ * Style lookups (lv_obj_get_style_prop()) of the screens are answered by
+ * ui_style_cache.cpp, "-S" leaves them to LVGL. Each scenario prints the
+ * lookups per frame, "-s" checks the cache against LVGL and times the lookups
+ * of a Screen1 frame both ways (style_check.cpp).
+ *
+ * LVGL allocates from ui_mem.cpp (LV_MEM_CUSTOM), each scenario prints its
+ * slab and heap use. "-a" checks the allocator with random calls and times it
+ * against malloc() (mem_check.cpp).
+ */
+
+#include "bench.h"
+#include "png.h"
+#include <lvgl.h>
+#include <src/draw/sw/lv_draw_sw.h>     // Blend hook
+#include <ui/ui.h>
+#include <ui_blend.h>
+#include <ui_corner_cache.h>
+#include <ui_style_cache.h>
+#include <ui_mem.h>
+#include <ui_screens.h>
+#include <app_data.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define BENCH_WIDTH         (800)
+#define BENCH_HEIGHT        (480)
+#define BENCH_PARTIAL_LINES (40)       // LVGL_PORT_PARTIAL_LINES in bsp.h
+#define BENCH_SETTLE_MS     (500)      // Before a scenario: screen loaded, animations done
+
+// main.cpp: added to each screen ui_screens.cpp builds
+extern void ui_screen2_add_power_toggle(void);
+extern void ui_sliders_add_release_flush(void);
+
+// ----------------------------------------------------------------------
+// Display: memory-backed, same buffer layouts as the BSP render modes
+// ----------------------------------------------------------------------
+
+enum BenchMode { MODE_DIRECT, MODE_FULL, MODE_PARTIAL };
+static const char *const mode_names[] = { "direct", "full", "partial" };
+static BenchMode bench_mode = MODE_DIRECT;
+static const UiBlendKernels *blend_kernels = nullptr;     // -b, nullptr: the native table
+static bool blend_lvgl = false;                           // -b lvgl: LVGL's blend
+static bool corner_lvgl = false;                          // -R: LVGL's rounded rectangles
+static bool style_lvgl = false;                           // -S: LVGL resolves every style lookup
+
+static const char *blend_name()
+{
+    return blend_lvgl ? "lvgl" : ui_blend_kernels()->name;
+}
+
+static lv_color_t *frame_buf[2];        // "PSRAM" frame buffers
+static lv_color_t *band_buf;            // Partial: the "SRAM" band
+
+struct FrameSample {
+    uint32_t render_us;
+    uint32_t refreshed_px;
+    uint32_t blended_px;
+    uint32_t sync_px;
+    uint32_t img_bytes;
+    uint32_t img_ns;
+    uint32_t style_lookups;
+};
+
+static std::vector<FrameSample> samples;
+static FrameSample frame;               // Refresh in progress
+static bool frame_flushed = false;
+static const lv_color_t *shown_frame = nullptr;    // Frame buffer "on screen"
+
+static void (*lvgl_refr_timer_cb)(lv_timer_t *timer) = nullptr;
+static void (*lvgl_blend)(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc) = nullptr;
+static void (*lvgl_buffer_copy)(lv_draw_ctx_t *draw_ctx, void *dest_buf, lv_coord_t dest_stride,
+                                const lv_area_t *dest_area, void *src_buf, lv_coord_t src_stride,
+                                const lv_area_t *src_area) = nullptr;
+static void (*lvgl_draw_img_decoded)(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *dsc,
+                                     const lv_area_t *coords, const uint8_t *map_p, lv_img_cf_t cf) = nullptr;
+
+static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    if (bench_mode == MODE_PARTIAL) {
+        // Band -> frame buffer, as drawBitmap() does on the device
+        lv_coord_t w = lv_area_get_width(area);
+        for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+            memcpy(&frame_buf[0][y * BENCH_WIDTH + area->x1], &color_map[(y - area->y1) * w], w * sizeof(lv_color_t));
+        }
+    }
+    if (lv_disp_flush_is_last(drv)) {
+        frame_flushed = true;
+        shown_frame = (bench_mode == MODE_PARTIAL) ? frame_buf[0] : color_map;
+    }
+    lv_disp_flush_ready(drv);
+}
+
+static void monitor_cb(lv_disp_drv_t *drv, uint32_t time, uint32_t px)
+{
+    (void)drv;
+    (void)time;     // Virtual clock, always 0
+    frame.refreshed_px += px;
+}
+
+static void counting_blend(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc)
+{
+    lv_area_t blended;
+    if (_lv_area_intersect(&blended, dsc->blend_area, draw_ctx->clip_area)) {
+        frame.blended_px += lv_area_get_size(&blended);
+    }
+    lvgl_blend(draw_ctx, dsc);
+}
+
+static void counting_buffer_copy(lv_draw_ctx_t *draw_ctx, void *dest_buf, lv_coord_t dest_stride,
+                                 const lv_area_t *dest_area, void *src_buf, lv_coord_t src_stride,
+                                 const lv_area_t *src_area)
+{
+    frame.sync_px += lv_area_get_size(dest_area);
+    lvgl_buffer_copy(draw_ctx, dest_buf, dest_stride, dest_area, src_buf, src_stride, src_area);
+}
+
+// Bytes per pixel the renderer reads from an image of format `cf`
+static uint32_t img_px_bytes(lv_img_cf_t cf)
+{
+    switch (cf) {
+        case LV_IMG_CF_TRUE_COLOR:
+        case LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED: return sizeof(lv_color_t);
+        case LV_IMG_CF_TRUE_COLOR_ALPHA: return LV_IMG_PX_SIZE_ALPHA_BYTE;
+        case LV_IMG_CF_RGB565A8: return sizeof(lv_color_t) + 1;
+        case LV_IMG_CF_ALPHA_8BIT: return 1;
+        default: return (lv_img_cf_get_px_size(cf) + 7) / 8;
+    }
+}
+
+static void counting_draw_img_decoded(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *dsc,
+                                      const lv_area_t *coords, const uint8_t *map_p, lv_img_cf_t cf)
+{
+    lv_area_t drawn;
+    if (_lv_area_intersect(&drawn, coords, draw_ctx->clip_area)) {
+        frame.img_bytes += lv_area_get_size(&drawn) * img_px_bytes(cf);
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    lvgl_draw_img_decoded(draw_ctx, dsc, coords, map_p, cf);
+    frame.img_ns += (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - t0).count();
+}
+
+static void timed_refr_timer(lv_timer_t *timer)
+{
+    frame = {};
+    frame_flushed = false;
+    uint32_t lookups = ui_style_cache_stats().lookups;
+    auto t0 = std::chrono::steady_clock::now();
+
+    lvgl_refr_timer_cb(timer);
+
+    if (!frame_flushed) return;     // Nothing was invalid
+    frame.render_us = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                          std::chrono::steady_clock::now() - t0).count();
+    frame.style_lookups = ui_style_cache_stats().lookups - lookups;
+    samples.push_back(frame);
+}
+
+static void display_init()
+{
+    static lv_disp_draw_buf_t disp_buf;
+    static lv_disp_drv_t disp_drv;
+    uint32_t screen_px = BENCH_WIDTH * BENCH_HEIGHT;
+
+    frame_buf[0] = (lv_color_t *)calloc(screen_px, sizeof(lv_color_t));
+    frame_buf[1] = (lv_color_t *)calloc(screen_px, sizeof(lv_color_t));
+    band_buf = (lv_color_t *)calloc(BENCH_WIDTH * BENCH_PARTIAL_LINES, sizeof(lv_color_t));
+
+    lv_disp_drv_init(&disp_drv);
+    if (bench_mode == MODE_PARTIAL) {
+        lv_disp_draw_buf_init(&disp_buf, band_buf, NULL, BENCH_WIDTH * BENCH_PARTIAL_LINES);
+    } else {
+        lv_disp_draw_buf_init(&disp_buf, frame_buf[0], frame_buf[1], screen_px);
+        disp_drv.direct_mode = (bench_mode == MODE_DIRECT);
+        disp_drv.full_refresh = (bench_mode == MODE_FULL);
+    }
+    disp_drv.hor_res = BENCH_WIDTH;
+    disp_drv.ver_res = BENCH_HEIGHT;
+    disp_drv.draw_buf = &disp_buf;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.monitor_cb = monitor_cb;
+
+    lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+
+    if (!blend_lvgl) ui_blend_install(disp, blend_kernels);   // main.cpp does this after bsp_init()
+    if (!corner_lvgl) ui_corner_cache_install(disp);
+    lv_draw_sw_ctx_t *sw = (lv_draw_sw_ctx_t *)disp_drv.draw_ctx;
+    lvgl_blend = sw->blend;
+    sw->blend = counting_blend;
+    lvgl_buffer_copy = disp_drv.draw_ctx->buffer_copy;
+    disp_drv.draw_ctx->buffer_copy = counting_buffer_copy;
+    lvgl_draw_img_decoded = disp_drv.draw_ctx->draw_img_decoded;
+    disp_drv.draw_ctx->draw_img_decoded = counting_draw_img_decoded;
+    lvgl_refr_timer_cb = disp->refr_timer->timer_cb;
+    disp->refr_timer->timer_cb = timed_refr_timer;
+}
+
+// ----------------------------------------------------------------------
+// Scripted touch
+// ----------------------------------------------------------------------
+
+static lv_point_t touch_point;
+static bool touch_pressed = false;
+
+static void touch_read(lv_indev_drv_t *drv, lv_indev_data_t *data)
+{
+    (void)drv;
+    data->point = touch_point;
+    data->state = touch_pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+static void indev_init()
+{
+    static lv_indev_drv_t indev_drv;
+    lv_indev_drv_init(&indev_drv);
+    indev_drv.type = LV_INDEV_TYPE_POINTER;
+    indev_drv.read_cb = touch_read;
+    lv_indev_drv_register(&indev_drv);
+}
+
+// The LVGL task on the virtual clock, lv_timer_handler() every millisecond
+static void run_ms(uint32_t ms)
+{
+    for (uint32_t i = 0; i < ms; i++) {
+        bench_now_ms++;
+        lv_timer_handler();
+    }
+}
+
+static lv_point_t obj_point(lv_obj_t *obj, int pct)
+{
+    lv_area_t a;
+    lv_obj_get_coords(obj, &a);
+    lv_point_t p = { (lv_coord_t)((a.x1 + a.x2) / 2), (lv_coord_t)((a.y1 + a.y2) / 2) };
+    if (lv_area_get_width(&a) >= lv_area_get_height(&a)) {
+        p.x = a.x1 + (lv_area_get_width(&a) - 1) * pct / 100;
+    } else {
+        p.y = a.y2 - (lv_area_get_height(&a) - 1) * pct / 100;   // Vertical slider: 0 at the bottom
+    }
+    return p;
+}
+
+static void tap(lv_obj_t *obj, uint32_t hold_ms = 60)
+{
+    touch_point = obj_point(obj, 50);
+    touch_pressed = true;
+    run_ms(hold_ms);
+    touch_pressed = false;
+    run_ms(40);
+}
+
+// Slider drag along its long axis, `from` / `to` in percent of its length
+static void drag(lv_obj_t *slider, int from, int to, uint32_t ms)
+{
+    touch_point = obj_point(slider, from);
+    touch_pressed = true;
+    run_ms(30);
+    for (uint32_t t = 1; t <= ms; t++) {
+        touch_point = obj_point(slider, from + (to - from) * (int)t / (int)ms);
+        run_ms(1);
+    }
+    touch_pressed = false;
+    run_ms(30);
+}
+
+// ----------------------------------------------------------------------
+// Scenarios
+// ----------------------------------------------------------------------
+
+struct Scenario {
+    const char *name;
+    const char *description;
+    bool from_screen1;          // Start settled on Screen1 (after the boot splash)
+    void (*script)();
+};
+
+static void script_boot() { run_ms(2600); }     // 2 s splash + 300 ms fade
+
+static void script_idle() { run_ms(1000); }
+
+static void script_drag_mic()
+{
+    drag(ui_Slider1, 50, 100, 500);
+    drag(ui_Slider1, 100, 0, 1000);
+}
+
+static void script_drag_music()
+{
+    drag(ui_Slider2, 80, 0, 800);
+    drag(ui_Slider2, 0, 100, 1000);
+}
+
+static void script_relay()
+{
+    tap(ui_music_switch);
+    run_ms(600);                // Slider animation to 0
+    tap(ui_mic_switch1);
+    run_ms(600);
+}
+
+static void script_screens()
+{
+    tap(ui_Button6, 600);       // Long press: Screen2
+    run_ms(200);
+    drag(ui_Slider3, 100, 30, 800);
+    tap(ui_Button5);            // Back to Screen1
+    run_ms(200);
+}
+
+// Whole Screen1 drawn again, as after a screen change or a full refresh
+static void script_redraw()
+{
+    for (int i = 0; i < 20; i++) {
+        lv_obj_invalidate(lv_scr_act());
+        run_ms(50);
+    }
+}
+
+// The 50 px label on Screen2 drawn again ("ui_font_Hebrew50")
+static void script_label50()
+{
+    tap(ui_Button6, 600);
+    run_ms(200);
+    samples.clear();
+    for (int i = 0; i < 20; i++) {
+        lv_obj_invalidate(ui_Label2);
+        run_ms(50);
+    }
+}
+
+static void script_none() {}
+
+static void script_splash() { run_ms(500); }
+
+static void script_screen2()
+{
+    tap(ui_Button6, 600);
+    run_ms(200);
+}
+
+static const Scenario scenarios[] = {
+    { "boot", "splash spinner, fade to Screen1", false, script_boot },
+    { "idle", "Screen1, no input (expects no frames)", true, script_idle },
+    { "drag-mic", "drag the mic slider 50 -> 100 -> 0", true, script_drag_mic },
+    { "drag-music", "drag the music slider 80 -> 0 -> 100", true, script_drag_music },
+    { "relay", "toggle the music and mic relays (slider animates to 0)", true, script_relay },
+    { "screens", "long press to Screen2, drag the main fader, back to Screen1", true, script_screens },
+    { "redraw", "Screen1 invalidated 20 times", true, script_redraw },
+    { "label50", "Screen2 title (50 px font) invalidated 20 times", true, script_label50 },
+};
+
+// Golden image states (the screen after the script)
+static const Scenario shots[] = {
+    { "screen3", "splash, 500 ms after boot", false, script_splash },
+    { "screen1", "Screen1 with the saved volumes", true, script_none },
+    { "screen1-relays", "Screen1, both relays toggled, sliders at 0", true, script_relay },
+    { "screen2", "Screen2 with the power toggle", true, script_screen2 },
+};
+
+// ----------------------------------------------------------------------
+// Report and baseline
+// ----------------------------------------------------------------------
+
+struct Totals {
+    uint64_t frames;
+    uint64_t refreshed_px;
+    uint64_t blended_px;
+    uint64_t sync_px;
+};
+
+static const char *baseline_out = nullptr;
+static const char *baseline_in = nullptr;
+static int regress_pct = 5;
+
+static uint32_t percentile(std::vector<uint32_t> v, int pct)
+{
+    if (v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    return v[(v.size() - 1) * pct / 100];
+}
+
+static void print_series(const char *name, const std::vector<uint32_t> &v, const char *unit)
+{
+    uint64_t sum = 0;
+    for (uint32_t x : v) sum += x;
+    printf("  %-14s avg=%llu p50=%u p95=%u max=%u %s\n", name,
+           v.empty() ? 0ULL : (unsigned long long)(sum / v.size()),
+           percentile(v, 50), percentile(v, 95), percentile(v, 100), unit);
+}
+
+static bool find_baseline(const char *key, Totals &base)
+{
+    FILE *f = fopen(baseline_in, "r");
+    if (!f) return false;
+    char name[64];
+    unsigned long long frames, refreshed, blended, sync;
+    bool found = false;
+    while (fscanf(f, "%63s %llu %llu %llu %llu", name, &frames, &refreshed, &blended, &sync) == 5) {
+        if (!strcmp(name, key)) {
+            base = { frames, refreshed, blended, sync };
+            found = true;
+        }
+    }
+    fclose(f);
+    return found;
+}
+
+static bool regressed(const char *what, uint64_t now, uint64_t base)
+{
+    if (now * 100 <= base * (100 + regress_pct)) return false;
+    printf("  FAIL %s %llu, baseline %llu (+%d%% allowed)\n", what,
+           (unsigned long long)now, (unsigned long long)base, regress_pct);
+    return true;
+}
+
+void bench_screen_built(UiScreenId id, lv_obj_t *screen)
+{
+    if (id == UI_SCREEN_2) ui_screen2_add_power_toggle();
+    ui_sliders_add_release_flush();
+    AppData.syncUI();
+    if (!style_lvgl) ui_style_cache_enable(screen);
+}
+
+// LVGL, the display and the UI as main.cpp starts them
+static void ui_start(const Scenario &sc)
+{
+    lv_init();
+    display_init();
+    indev_init();
+    ui_screens_init(bench_screen_built, 1u << UI_SCREEN_1);
+
+    if (sc.from_screen1) {
+        // Where the device is after boot: splash done, Screen1 with the saved volumes (syncUI())
+        script_boot();
+        run_ms(BENCH_SETTLE_MS);
+    }
+}
+
+static int run(const Scenario &sc)
+{
+    ui_start(sc);
+    samples.clear();
+    memset(bench_commands, 0, sizeof(uint32_t) * (APP_CMD_POWER_SENSING + 1));
+    ui_corner_cache_reset_stats();
+    ui_style_cache_reset_stats();
+    ui_mem_reset_stats();
+
+    sc.script();
+
+    printf("== %s (%s, %s): %s\n", sc.name, mode_names[bench_mode], blend_name(), sc.description);
+
+    Totals t = {};
+    std::vector<uint32_t> render_us, refreshed, blended, sync, img, img_us, lookups;
+    uint64_t img_total = 0;
+    for (const FrameSample &s : samples) {
+        t.frames++;
+        t.refreshed_px += s.refreshed_px;
+        t.blended_px += s.blended_px;
+        t.sync_px += s.sync_px;
+        render_us.push_back(s.render_us);
+        refreshed.push_back(s.refreshed_px);
+        blended.push_back(s.blended_px);
+        sync.push_back(s.sync_px);
+        img.push_back(s.img_bytes);
+        img_us.push_back(s.img_ns / 1000);
+        lookups.push_back(s.style_lookups);
+        img_total += s.img_bytes;
+    }
+    printf("  frames=%llu  UI commands: mic=%u music=%u fader=%u release=%u relay=%u/%u\n",
+           (unsigned long long)t.frames, bench_commands[APP_CMD_MIC_VOLUME], bench_commands[APP_CMD_MUSIC_VOLUME],
+           bench_commands[APP_CMD_MAIN_FADER], bench_commands[APP_CMD_SLIDER_RELEASED],
+           bench_commands[APP_CMD_TOGGLE_MUSIC_RELAY], bench_commands[APP_CMD_TOGGLE_MIC_RELAY]);
+    print_series("render", render_us, "us (host)");
+    print_series("refreshed", refreshed, "px/frame");
+    print_series("blended", blended, "px/frame");
+    if (bench_mode == MODE_DIRECT) print_series("sync copy", sync, "px/frame");
+    print_series("image read", img, "bytes/frame");
+    print_series("image draw", img_us, "us (host)");
+    print_series("style lookups", lookups, "calls/frame");
+    if (!corner_lvgl) {
+        UiCornerCacheStats st = ui_corner_cache_stats();
+        printf("  corner cache   hits=%u misses=%u, rounded backgrounds: cached=%u lvgl=%u\n", st.hits, st.misses,
+               st.rects, st.rects_lvgl);
+    }
+    if (!style_lvgl) {
+        UiStyleCacheStats st = ui_style_cache_stats();
+        printf("  style cache    hits=%u misses=%u lvgl=%u, tables emptied=%u\n", st.hits, st.misses,
+               st.lookups - st.hits - st.misses, st.drops);
+    }
+    UiMemStats mem;
+    ui_mem_get_stats(&mem);
+    uint32_t allocs = mem.internal.allocs + mem.psram.allocs, overflows = 0;
+    for (const UiMemClassStats &cs : mem.classes) {
+        allocs += cs.allocs - cs.overflows;
+        overflows += cs.overflows;
+    }
+    printf("  lv_mem         slab pages=%u peak=%u/%u free in them=%u B, heap internal=%u peak=%u psram=%u peak=%u B, "
+           "allocs=%u overflows=%u failures=%u\n", mem.pages, mem.pages_peak, UI_MEM_SLAB_BYTES / UI_MEM_PAGE_BYTES,
+           mem.slab_free, mem.internal.used, mem.internal.peak, mem.psram.used, mem.psram.peak, allocs, overflows,
+           mem.failures);
+    printf("  total: refreshed=%llu blended=%llu sync=%llu px, image read=%llu bytes\n",
+           (unsigned long long)t.refreshed_px, (unsigned long long)t.blended_px, (unsigned long long)t.sync_px,
+           (unsigned long long)img_total);
+
+    int failed = 0;
+    if (!strcmp(sc.name, "idle") && t.frames) {
+        printf("  FAIL %llu frames without input\n", (unsigned long long)t.frames);
+        failed++;
+    }
+
+    char key[64];
+    snprintf(key, sizeof(key), "%s/%s", mode_names[bench_mode], sc.name);
+    if (baseline_in) {
+        Totals base = {};
+        if (!find_baseline(key, base)) {
+            printf("  no baseline for %s\n", key);
+        } else {
+            failed += regressed("frames", t.frames, base.frames);
+            failed += regressed("refreshed px", t.refreshed_px, base.refreshed_px);
+            failed += regressed("blended px", t.blended_px, base.blended_px);
+            failed += regressed("sync px", t.sync_px, base.sync_px);
+        }
+    }
+    if (baseline_out) {
+        FILE *f = fopen(baseline_out, "a");
+        if (f) {
+            fprintf(f, "%s %llu %llu %llu %llu\n", key, (unsigned long long)t.frames,
+                    (unsigned long long)t.refreshed_px, (unsigned long long)t.blended_px,
+                    (unsigned long long)t.sync_px);
+            fclose(f);
+        }
+    }
+    printf("  %s\n\n", failed ? "FAILED" : "ok");
+    return failed ? 1 : 0;
+}
+
+// ----------------------------------------------------------------------
+// Golden images
+// ----------------------------------------------------------------------
+
+static const char *golden_dir = nullptr;
+static bool golden_save = false;
+
+static void frame_to_rgb(const lv_color_t *fb, std::vector<uint8_t> &rgb)
+{
+    rgb.resize(BENCH_WIDTH * BENCH_HEIGHT * 3);
+    for (int i = 0; i < BENCH_WIDTH * BENCH_HEIGHT; i++) {
+        // RGB565 -> RGB888, low bits repeat the high ones (as lv_color_to32)
+        uint8_t r = fb[i].ch.red, g = fb[i].ch.green, b = fb[i].ch.blue;
+        rgb[i * 3 + 0] = (r << 3) | (r >> 2);
+        rgb[i * 3 + 1] = (g << 2) | (g >> 4);
+        rgb[i * 3 + 2] = (b << 3) | (b >> 2);
+    }
+}
+
+static int run_shot(const Scenario &sc)
+{
+    ui_start(sc);
+    sc.script();
+    run_ms(100);    // Last changes on screen
+
+    printf("== %s (%s, %s): %s\n", sc.name, mode_names[bench_mode], blend_name(), sc.description);
+    if (!shown_frame) {
+        printf("  FAIL nothing was drawn\n\n");
+        return 1;
+    }
+    std::vector<uint8_t> rgb;
+    frame_to_rgb(shown_frame, rgb);
+
+    std::string path = std::string(golden_dir) + "/" + sc.name + ".png";
+    if (golden_save) {
+        bool ok = png_write(path.c_str(), rgb.data(), BENCH_WIDTH, BENCH_HEIGHT);
+        printf("  %s %s\n\n", ok ? "saved" : "FAIL cannot write", path.c_str());
+        return ok ? 0 : 1;
+    }
+
+    std::vector<uint8_t> golden;
+    int w = 0, h = 0;
+    std::string error;
+    if (!png_read(path.c_str(), golden, w, h, error)) {
+        printf("  FAIL %s: %s\n\n", path.c_str(), error.c_str());
+        return 1;
+    }
+    if (w != BENCH_WIDTH || h != BENCH_HEIGHT) {
+        printf("  FAIL %s is %dx%d, expected %dx%d\n\n", path.c_str(), w, h, BENCH_WIDTH, BENCH_HEIGHT);
+        return 1;
+    }
+
+    uint32_t diff = 0;
+    int x1 = BENCH_WIDTH, y1 = BENCH_HEIGHT, x2 = -1, y2 = -1;
+    for (int y = 0; y < BENCH_HEIGHT; y++) {
+        for (int x = 0; x < BENCH_WIDTH; x++) {
+            size_t i = (y * BENCH_WIDTH + x) * 3;
+            if (!memcmp(&rgb[i], &golden[i], 3)) continue;
+            diff++;
+            x1 = std::min(x1, x);
+            y1 = std::min(y1, y);
+            x2 = std::max(x2, x);
+            y2 = std::max(y2, y);
+        }
+    }
+    if (!diff) {
+        printf("  ok, pixel exact\n\n");
+        return 0;
+    }
+    std::string actual = std::string(golden_dir) + "/" + sc.name + ".actual.png";
+    png_write(actual.c_str(), rgb.data(), BENCH_WIDTH, BENCH_HEIGHT);
+    printf("  FAIL %u pixels differ in (%d,%d)-(%d,%d) %dx%d, see %s\n\n", diff, x1, y1, x2, y2,
+           x2 - x1 + 1, y2 - y1 + 1, actual.c_str());
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    std::vector<const Scenario *> selected;
+    std::vector<const char *> names;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-m") && i + 1 < argc) {
+            const char *mode = argv[++i];
+            if (!strcmp(mode, "direct")) bench_mode = MODE_DIRECT;
+            else if (!strcmp(mode, "full")) bench_mode = MODE_FULL;
+            else if (!strcmp(mode, "partial")) bench_mode = MODE_PARTIAL;
+            else {
+                fprintf(stderr, "unknown mode '%s', have: direct full partial\n", mode);
+                return 2;
+            }
+            continue;
+        }
+        if (!strcmp(argv[i], "-b") && i + 1 < argc) {
+            const char *blend = argv[++i];
+            if (!strcmp(blend, "lvgl")) blend_lvgl = true;
+            else if (!strcmp(blend, ui_blend_word32.name)) blend_kernels = &ui_blend_word32;
+            else if (!strcmp(blend, ui_blend_word64.name)) blend_kernels = &ui_blend_word64;
+            else {
+                fprintf(stderr, "unknown blend '%s', have: lvgl %s %s\n", blend, ui_blend_word32.name,
+                        ui_blend_word64.name);
+                return 2;
+            }
+            continue;
+        }
+        if (!strcmp(argv[i], "-k")) {
+            return blend_check();
+        }
+        if (!strcmp(argv[i], "-r")) {
+            return rect_check();
+        }
+        if (!strcmp(argv[i], "-s")) {
+            return style_check();
+        }
+        if (!strcmp(argv[i], "-a")) {
+            return mem_check();
+        }
+        if (!strcmp(argv[i], "-R")) {
+            corner_lvgl = true;
+            continue;
+        }
+        if (!strcmp(argv[i], "-S")) {
+            style_lvgl = true;
+            continue;
+        }
+        if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+            baseline_out = argv[++i];
+            continue;
+        }
+        if (!strcmp(argv[i], "-c") && i + 1 < argc) {
+            baseline_in = argv[++i];
+            continue;
+        }
+        if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+            regress_pct = atoi(argv[++i]);
+            continue;
+        }
+        if ((!strcmp(argv[i], "-g") || !strcmp(argv[i], "-G")) && i + 1 < argc) {
+            golden_save = !strcmp(argv[i], "-G");
+            golden_dir = argv[++i];
+            continue;
+        }
+        names.push_back(argv[i]);
+    }
+
+    // Scenarios, or shots with -g / -G
+    const Scenario *list = golden_dir ? shots : scenarios;
+    size_t list_len = golden_dir ? sizeof(shots) / sizeof(shots[0]) : sizeof(scenarios) / sizeof(scenarios[0]);
+    for (const char *name : names) {
+        const Scenario *found = nullptr;
+        for (size_t k = 0; k < list_len; k++) {
+            if (!strcmp(list[k].name, name)) found = &list[k];
+        }
+        if (!found) {
+            fprintf(stderr, "unknown %s '%s', have:", golden_dir ? "shot" : "scenario", name);
+            for (size_t k = 0; k < list_len; k++) fprintf(stderr, " %s", list[k].name);
+            fprintf(stderr, "\n");
+            return 2;
+        }
+        selected.push_back(found);
+    }
+    if (selected.empty()) {
+        for (size_t k = 0; k < list_len; k++) selected.push_back(&list[k]);
+    }
+    if (baseline_out) {
+        // Rewrite this mode's baseline: keep the lines of the other modes
+        FILE *f = fopen(baseline_out, "r");
+        std::vector<std::string> keep;
+        if (f) {
+            char line[256];
+            size_t prefix = strlen(mode_names[bench_mode]);
+            while (fgets(line, sizeof(line), f)) {
+                if (strncmp(line, mode_names[bench_mode], prefix) || line[prefix] != '/') keep.push_back(line);
+            }
+            fclose(f);
+        }
+        f = fopen(baseline_out, "w");
+        if (!f) {
+            fprintf(stderr, "cannot write '%s'\n", baseline_out);
+            return 2;
+        }
+        for (const std::string &line : keep) fputs(line.c_str(), f);
+        fclose(f);
+    }
+
+    // One process per scenario: LVGL and the UI start from scratch each time
+    int failed = 0;
+    for (const Scenario *sc : selected) {
+        fflush(stdout);
+        pid_t pid = fork();
+        if (pid == 0) {
+            int rc = golden_dir ? run_shot(*sc) : run(*sc);
+            fflush(stdout);
+            _exit(rc);
+        }
+        int status = 0;
+        waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            failed++;
+            if (!WIFEXITED(status)) printf("  FAIL %s crashed\n\n", sc->name);
+        }
+    }
+    printf("%d/%zu %s passed\n", (int)selected.size() - failed, selected.size(), golden_dir ? "shots" : "scenarios");
+    return failed ? 1 : 0;
+}
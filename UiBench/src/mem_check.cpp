@@ -0,0 +1,294 @@
+/*
+ * UiBench -a: ui_mem.cpp, the LVGL heap (LV_MEM_CUSTOM)
+ *
+ * Check: random alloc / realloc / free of the sizes LVGL asks for, every block
+ * filled with a pattern that must survive until it is freed, aligned, the
+ * statistics adding up after every call and back to zero at the end; then the
+ * slab filled up until blocks overflow to the heap. Speed: the same calls
+ * against malloc(). Then the UI, booted as main.cpp does (ui_screens.cpp) and
+ * as ui_init() did: host time to the first frame, LVGL heap with Screen1 shown.
+ */
+
+#include "bench.h"
+#include <ui/ui.h>
+#include <ui_mem.h>
+#include <app_data.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define CHECK_OPS       (200000)
+#define CHECK_SLOTS     (2000)      // Blocks alive at once, at most
+#define SMALL_SLOTS     (500)       // Small blocks only: what the slab holds
+#define SPEED_MS        (200)
+
+// main.cpp: added to the generated UI after ui_init()
+extern void ui_screen2_add_power_toggle(void);
+extern void ui_sliders_add_release_flush(void);
+
+enum OpType { OP_ALLOC, OP_REALLOC, OP_FREE };
+
+struct Op {
+    OpType type;
+    uint32_t slot;
+    uint32_t size;
+};
+
+struct Block {
+    uint8_t *p;
+    uint32_t size;
+    uint8_t seed;
+};
+
+// Mostly small blocks (objects, styles, timers), some row and mask buffers, a few layers
+static uint32_t random_size(std::mt19937 &rng, bool small)
+{
+    uint32_t r = small ? 0 : rng() % 100;
+    if (r < 80) return 1 + rng() % 256;
+    if (r < 95) return 257 + rng() % (8 * 1024);
+    return 8 * 1024 + rng() % (32 * 1024);
+}
+
+static std::vector<Op> make_ops(uint32_t slots, bool small)
+{
+    std::mt19937 rng(1);
+    std::vector<Op> ops;
+    std::vector<bool> live(slots);
+    for (uint32_t i = 0; i < CHECK_OPS; i++) {
+        uint32_t slot = rng() % slots;
+        if (!live[slot]) ops.push_back({ OP_ALLOC, slot, random_size(rng, small) });
+        else if (rng() % 3 == 0) ops.push_back({ OP_REALLOC, slot, random_size(rng, small) });
+        else ops.push_back({ OP_FREE, slot, 0 });
+        live[slot] = ops.back().type != OP_FREE;
+    }
+    for (uint32_t slot = 0; slot < slots; slot++) {
+        if (live[slot]) ops.push_back({ OP_FREE, slot, 0 });
+    }
+    return ops;
+}
+
+static void fill(const Block &b)
+{
+    for (uint32_t i = 0; i < b.size; i++) b.p[i] = (uint8_t)(b.seed + i);
+}
+
+static bool intact(const Block &b, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        if (b.p[i] != (uint8_t)(b.seed + i)) return false;
+    }
+    return true;
+}
+
+// The counters against the blocks the check holds
+static bool stats_add_up(const UiMemStats &st, const std::vector<Block> &blocks)
+{
+    uint32_t slab_used = 0, slab_blocks = 0, pages = 0;
+    for (const UiMemClassStats &cs : st.classes) {
+        slab_used += cs.used * cs.block;
+        slab_blocks += cs.used;
+        pages += cs.pages;
+        if (cs.used > cs.peak || cs.used * cs.block > cs.pages * UI_MEM_PAGE_BYTES) return false;
+    }
+    uint32_t live = 0;
+    for (const Block &b : blocks) live += b.p != nullptr;
+    return pages == st.pages && st.pages <= st.pages_peak && st.pages <= UI_MEM_SLAB_BYTES / UI_MEM_PAGE_BYTES &&
+           st.slab_free == st.pages * UI_MEM_PAGE_BYTES - slab_used && st.internal.used <= st.internal.peak &&
+           st.psram.used <= st.psram.peak && !st.failures &&
+           live == slab_blocks + st.internal.blocks + st.psram.blocks;
+}
+
+static bool all_free(const UiMemStats &st)
+{
+    for (const UiMemClassStats &cs : st.classes) {
+        if (cs.used || cs.pages) return false;
+    }
+    return !st.pages && !st.slab_free && !st.internal.used && !st.internal.blocks && !st.psram.used &&
+           !st.psram.blocks && !st.failures;
+}
+
+static int check(const std::vector<Op> &ops)
+{
+    std::vector<Block> blocks(CHECK_SLOTS);
+    int failed = 0;
+    uint8_t seed = 0;
+    for (size_t i = 0; i < ops.size() && failed < 10; i++) {
+        const Op &op = ops[i];
+        Block &b = blocks[op.slot];
+        if (op.type != OP_ALLOC && !intact(b, b.size)) {
+            printf("  FAIL op %zu: block of %u bytes overwritten\n", i, b.size);
+            failed++;
+        }
+        if (op.type == OP_FREE) {
+            ui_mem_free(b.p);
+            b = {};
+        } else {
+            uint8_t *p = (uint8_t *)(op.type == OP_ALLOC ? ui_mem_alloc(op.size) : ui_mem_realloc(b.p, op.size));
+            if (!p || (uintptr_t)p % 8) {
+                printf("  FAIL op %zu: %u bytes at %p\n", i, op.size, (void *)p);
+                failed++;
+                continue;
+            }
+            Block moved = { p, b.size < op.size ? b.size : op.size, b.seed };
+            if (op.type == OP_REALLOC && !intact(moved, moved.size)) {
+                printf("  FAIL op %zu: realloc %u -> %u lost the content\n", i, b.size, op.size);
+                failed++;
+            }
+            b = { p, op.size, ++seed };
+            fill(b);
+        }
+        UiMemStats st;
+        ui_mem_get_stats(&st);
+        if (!stats_add_up(st, blocks)) {
+            printf("  FAIL op %zu: statistics don't add up\n", i);
+            failed++;
+        }
+    }
+
+    UiMemStats st;
+    ui_mem_get_stats(&st);
+    uint32_t overflows = 0;
+    for (const UiMemClassStats &cs : st.classes) overflows += cs.overflows;
+    printf("  %zu calls: %s, slab pages peak %u of %u, heap peak internal %u psram %u bytes, %u overflows\n",
+           ops.size(), failed ? "FAIL" : "patterns intact", st.pages_peak, UI_MEM_SLAB_BYTES / UI_MEM_PAGE_BYTES,
+           st.internal.peak, st.psram.peak, overflows);
+    if (!all_free(st)) {
+        printf("  FAIL not everything given back\n");
+        failed++;
+    }
+
+    // The slab full: the 16-byte blocks that don't fit go to the heap
+    std::vector<void *> small;
+    ui_mem_reset_stats();
+    do {
+        small.push_back(ui_mem_alloc(16));
+        memset(small.back(), 0xA5, 16);
+        ui_mem_get_stats(&st);
+    } while (!st.classes[0].overflows);
+    bool full = st.pages == UI_MEM_SLAB_BYTES / UI_MEM_PAGE_BYTES && !st.slab_free && st.internal.blocks == 1;
+    for (void *p : small) ui_mem_free(p);
+    ui_mem_get_stats(&st);
+    printf("  slab full after %zu blocks of 16 bytes, then the heap: %s\n", small.size() - 1,
+           full && all_free(st) ? "ok" : "FAIL");
+    if (!full || !all_free(st)) failed++;
+    return failed;
+}
+
+// Nanoseconds per call of `ops`; the best run, the host being noisy
+template <typename Alloc, typename Realloc, typename Free>
+static double speed(const std::vector<Op> &ops, Alloc alloc, Realloc re, Free release)
+{
+    std::vector<void *> p(CHECK_SLOTS);
+    double best = 1e9, s = 0;
+    do {
+        auto t0 = std::chrono::steady_clock::now();
+        for (const Op &op : ops) {
+            if (op.type == OP_ALLOC) p[op.slot] = alloc(op.size);
+            else if (op.type == OP_REALLOC) p[op.slot] = re(p[op.slot], op.size);
+            else release(p[op.slot]);
+        }
+        double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        best = std::min(best, t);
+        s += t;
+    } while (s * 1000 < SPEED_MS);
+    return best * 1e9 / ops.size();
+}
+
+static void print_use(const char *what)
+{
+    UiMemStats st;
+    ui_mem_get_stats(&st);
+    printf("  %s:\n", what);
+    printf("    %5s %6s %6s %6s %8s %9s\n", "block", "used", "peak", "pages", "allocs", "overflows");
+    for (const UiMemClassStats &cs : st.classes) {
+        printf("    %5u %6u %6u %6u %8u %9u\n", cs.block, cs.used, cs.peak, cs.pages, cs.allocs, cs.overflows);
+    }
+    printf("    slab pages %u (peak %u) of %u, %u bytes free in them; heap internal %u (peak %u), psram %u (peak %u) bytes\n",
+           st.pages, st.pages_peak, UI_MEM_SLAB_BYTES / UI_MEM_PAGE_BYTES, st.slab_free, st.internal.used,
+           st.internal.peak, st.psram.used, st.psram.peak);
+}
+
+static uint32_t used_bytes()
+{
+    UiMemStats st;
+    ui_mem_get_stats(&st);
+    uint32_t used = st.internal.used + st.psram.used;
+    for (const UiMemClassStats &cs : st.classes) used += cs.used * cs.block;
+    return used;
+}
+
+static void run_ms(uint32_t ms)
+{
+    for (uint32_t i = 0; i < ms; i++) {     // On the virtual clock
+        bench_now_ms++;
+        lv_timer_handler();
+    }
+}
+
+// Boot in a child process, LVGL starting afresh: `lazy` as main.cpp (splash
+// only, Screen1 built while it shows), else ui_init() and the additions to
+// all screens as before ui_screens.cpp
+static void boot_use(bool lazy)
+{
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid > 0) {
+        waitpid(pid, nullptr, 0);
+        return;
+    }
+
+    lv_disp_t *disp = check_display(800, 480);
+    ui_mem_reset_stats();
+    uint32_t before = used_bytes();
+    auto t0 = std::chrono::steady_clock::now();
+    if (lazy) {
+        ui_screens_init(bench_screen_built, 1u << UI_SCREEN_1);
+    } else {
+        ui_init();
+        ui_screen2_add_power_toggle();
+        ui_sliders_add_release_flush();
+        AppData.syncUI();
+    }
+    lv_refr_now(disp);
+    double first = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    uint32_t boot = used_bytes() - before;
+
+    run_ms(3000);       // Splash and fade to Screen1
+    printf("  %s: first frame after %.2f ms (host), %u bytes; Screen1 shown: %u bytes\n",
+           lazy ? "ui_screens_init()" : "ui_init()", first * 1000, boot, used_bytes() - before);
+    if (lazy) {
+        ui_screens_load(UI_SCREEN_2, LV_SCR_LOAD_ANIM_NONE, 0, 0);
+        run_ms(100);
+        ui_screens_load(UI_SCREEN_1, LV_SCR_LOAD_ANIM_NONE, 0, 0);
+        run_ms(100);
+        uint32_t visited = used_bytes() - before;
+        ui_screens_trim();
+        printf("    after a visit to Screen2: %u bytes, trimmed: %u bytes\n", visited, used_bytes() - before);
+        print_use("ui_mem, Screen1 shown");
+    }
+    fflush(stdout);
+    _exit(0);
+}
+
+int mem_check()
+{
+    printf("== mem: ui_mem, LVGL's heap\n");
+    std::vector<Op> ops = make_ops(CHECK_SLOTS, false);
+    std::vector<Op> small = make_ops(SMALL_SLOTS, true);
+    int failed = check(ops);
+
+    printf("  speed, ns per call (host): all sizes %.1f, malloc() %.1f; up to 256 bytes %.1f, malloc() %.1f\n",
+           speed(ops, ui_mem_alloc, ui_mem_realloc, ui_mem_free), speed(ops, malloc, realloc, free),
+           speed(small, ui_mem_alloc, ui_mem_realloc, ui_mem_free), speed(small, malloc, realloc, free));
+    ui_mem_reset_stats();
+
+    boot_use(false);
+    boot_use(true);
+    printf("\n");
+    return failed ? 1 : 0;
+}
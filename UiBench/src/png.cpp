@@ -0,0 +1,484 @@
+/*
+ * Minimal PNG writer / reader for UiBench golden images, see png.h
+ */
+
+#include "png.h"
+#include <stdio.h>
+#include <string.h>
+
+static const uint8_t png_signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+static uint32_t crc32(const uint8_t *data, size_t len, uint32_t crc = 0)
+{
+    static uint32_t table[256];
+    if (!table[1]) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[n] = c;
+        }
+    }
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static uint32_t adler32(const uint8_t *data, size_t len)
+{
+    uint32_t a = 1, b = 0;
+    for (size_t i = 0; i < len; i++) {
+        a = (a + data[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    return (b << 16) | a;
+}
+
+static void put_be32(std::vector<uint8_t> &out, uint32_t v)
+{
+    out.push_back(v >> 24);
+    out.push_back(v >> 16);
+    out.push_back(v >> 8);
+    out.push_back(v);
+}
+
+static uint32_t get_be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// Deflate length / distance codes (RFC 1951 3.2.5)
+static const uint16_t len_base[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                       35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const uint8_t len_extra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                       3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const uint16_t dist_base[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                        257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                        8193, 12289, 16385, 24577 };
+static const uint8_t dist_extra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+// ----------------------------------------------------------------------
+// Writer: one fixed-Huffman block, matches at the distances flat UI
+// areas repeat at (previous byte, previous pixel, previous row)
+// ----------------------------------------------------------------------
+
+class BitWriter {
+public:
+    std::vector<uint8_t> &out;
+    uint32_t bits = 0;
+    int count = 0;
+
+    explicit BitWriter(std::vector<uint8_t> &out) : out(out) {}
+
+    void put(uint32_t value, int n)         // LSB first
+    {
+        bits |= value << count;
+        count += n;
+        while (count >= 8) {
+            out.push_back(bits & 0xFF);
+            bits >>= 8;
+            count -= 8;
+        }
+    }
+
+    void put_code(uint32_t code, int n)     // Huffman codes go MSB first
+    {
+        uint32_t rev = 0;
+        for (int i = 0; i < n; i++) rev |= ((code >> i) & 1) << (n - 1 - i);
+        put(rev, n);
+    }
+
+    void flush()
+    {
+        if (count) out.push_back(bits & 0xFF);
+        bits = 0;
+        count = 0;
+    }
+};
+
+static void put_literal(BitWriter &bw, int sym)
+{
+    if (sym < 144) bw.put_code(0x30 + sym, 8);
+    else if (sym < 256) bw.put_code(0x190 + sym - 144, 9);
+    else if (sym < 280) bw.put_code(sym - 256, 7);
+    else bw.put_code(0xC0 + sym - 280, 8);
+}
+
+static void put_match(BitWriter &bw, int len, int dist)
+{
+    int i = 28;
+    while (len_base[i] > len) i--;
+    put_literal(bw, 257 + i);
+    bw.put(len - len_base[i], len_extra[i]);
+
+    int d = 29;
+    while (dist_base[d] > dist) d--;
+    bw.put_code(d, 5);
+    bw.put(dist - dist_base[d], dist_extra[d]);
+}
+
+static void deflate_fixed(const std::vector<uint8_t> &in, std::vector<uint8_t> &out, int row_bytes)
+{
+    BitWriter bw(out);
+    bw.put(1, 1);       // Final block
+    bw.put(1, 2);       // Fixed Huffman
+    const int dists[3] = { 1, 3, row_bytes };
+    size_t i = 0;
+    while (i < in.size()) {
+        int best_len = 0, best_dist = 0;
+        for (int dist : dists) {
+            if ((size_t)dist > i || dist > 32768) continue;
+            int len = 0;
+            while (len < 258 && i + len < in.size() && in[i + len] == in[i + len - dist]) len++;
+            if (len > best_len) {
+                best_len = len;
+                best_dist = dist;
+            }
+        }
+        if (best_len >= 3) {
+            put_match(bw, best_len, best_dist);
+            i += best_len;
+        } else {
+            put_literal(bw, in[i++]);
+        }
+    }
+    put_literal(bw, 256);
+    bw.flush();
+}
+
+static void put_chunk(std::vector<uint8_t> &png, const char *type, const std::vector<uint8_t> &data)
+{
+    put_be32(png, data.size());
+    size_t start = png.size();
+    png.insert(png.end(), type, type + 4);
+    png.insert(png.end(), data.begin(), data.end());
+    put_be32(png, crc32(&png[start], png.size() - start));
+}
+
+bool png_write(const char *path, const uint8_t *rgb, int width, int height)
+{
+    // Filter "Sub" on every row: flat areas become runs of zeros
+    size_t stride = (size_t)width * 3;
+    std::vector<uint8_t> raw;
+    raw.reserve((stride + 1) * height);
+    for (int y = 0; y < height; y++) {
+        const uint8_t *row = rgb + y * stride;
+        raw.push_back(1);
+        for (size_t x = 0; x < stride; x++) raw.push_back(row[x] - (x >= 3 ? row[x - 3] : 0));
+    }
+
+    std::vector<uint8_t> z = { 0x78, 0x01 };
+    deflate_fixed(raw, z, (int)stride + 1);
+    put_be32(z, adler32(raw.data(), raw.size()));
+
+    std::vector<uint8_t> ihdr;
+    put_be32(ihdr, width);
+    put_be32(ihdr, height);
+    ihdr.insert(ihdr.end(), { 8, 2, 0, 0, 0 });     // 8-bit RGB, deflate, no interlace
+
+    std::vector<uint8_t> png(png_signature, png_signature + 8);
+    put_chunk(png, "IHDR", ihdr);
+    put_chunk(png, "IDAT", z);
+    put_chunk(png, "IEND", {});
+
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+    bool ok = fwrite(png.data(), 1, png.size(), f) == png.size();
+    return fclose(f) == 0 && ok;
+}
+
+// ----------------------------------------------------------------------
+// Reader: full inflate (stored, fixed and dynamic Huffman blocks)
+// ----------------------------------------------------------------------
+
+struct Huffman {
+    uint16_t count[16];     // Codes per length
+    uint16_t symbol[320];   // Symbols ordered by code
+};
+
+class Inflater {
+public:
+    const uint8_t *in;
+    size_t len;
+    size_t pos = 0;
+    uint32_t bits = 0;
+    int count = 0;
+    std::vector<uint8_t> &out;
+    const char *error = nullptr;
+
+    Inflater(const uint8_t *in, size_t len, std::vector<uint8_t> &out) : in(in), len(len), out(out) {}
+
+    int get(int n)
+    {
+        while (count < n) {
+            if (pos >= len) {
+                error = "truncated deflate stream";
+                return 0;
+            }
+            bits |= (uint32_t)in[pos++] << count;
+            count += 8;
+        }
+        int v = bits & ((1u << n) - 1);
+        bits >>= n;
+        count -= n;
+        return v;
+    }
+
+    static bool build(Huffman &h, const uint8_t *lengths, int n)
+    {
+        uint16_t offs[16];
+        memset(h.count, 0, sizeof(h.count));
+        for (int i = 0; i < n; i++) h.count[lengths[i]]++;
+        offs[1] = 0;
+        for (int l = 1; l < 15; l++) offs[l + 1] = offs[l] + h.count[l];
+        for (int i = 0; i < n; i++) {
+            if (lengths[i]) h.symbol[offs[lengths[i]]++] = i;
+        }
+        return true;
+    }
+
+    int decode(const Huffman &h)
+    {
+        int code = 0, first = 0, index = 0;
+        for (int l = 1; l < 16; l++) {
+            code |= get(1);
+            int c = h.count[l];
+            if (code - c < first) return h.symbol[index + (code - first)];
+            index += c;
+            first = (first + c) << 1;
+            code <<= 1;
+            if (error) return -1;
+        }
+        error = "bad Huffman code";
+        return -1;
+    }
+
+    bool codes(const Huffman &lit, const Huffman &dist)
+    {
+        while (!error) {
+            int sym = decode(lit);
+            if (sym < 0) return false;
+            if (sym < 256) {
+                out.push_back(sym);
+            } else if (sym == 256) {
+                return true;
+            } else {
+                sym -= 257;
+                if (sym >= 29) {
+                    error = "bad length code";
+                    return false;
+                }
+                int length = len_base[sym] + get(len_extra[sym]);
+                int d = decode(dist);
+                if (d < 0 || d >= 30) {
+                    error = "bad distance code";
+                    return false;
+                }
+                size_t distance = dist_base[d] + get(dist_extra[d]);
+                if (distance > out.size()) {
+                    error = "distance before the start";
+                    return false;
+                }
+                for (int i = 0; i < length; i++) out.push_back(out[out.size() - distance]);
+            }
+        }
+        return false;
+    }
+
+    bool stored()
+    {
+        bits = 0;
+        count = 0;
+        if (pos + 4 > len) {
+            error = "truncated stored block";
+            return false;
+        }
+        size_t n = in[pos] | (in[pos + 1] << 8);
+        pos += 4;
+        if (pos + n > len) {
+            error = "truncated stored block";
+            return false;
+        }
+        out.insert(out.end(), in + pos, in + pos + n);
+        pos += n;
+        return true;
+    }
+
+    bool fixed()
+    {
+        static Huffman lit, dist;
+        static bool built = false;
+        if (!built) {
+            uint8_t lengths[288];
+            for (int i = 0; i < 144; i++) lengths[i] = 8;
+            for (int i = 144; i < 256; i++) lengths[i] = 9;
+            for (int i = 256; i < 280; i++) lengths[i] = 7;
+            for (int i = 280; i < 288; i++) lengths[i] = 8;
+            build(lit, lengths, 288);
+            for (int i = 0; i < 30; i++) lengths[i] = 5;
+            build(dist, lengths, 30);
+            built = true;
+        }
+        return codes(lit, dist);
+    }
+
+    bool dynamic()
+    {
+        static const uint8_t order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+        uint8_t lengths[320] = {};
+        int nlen = get(5) + 257, ndist = get(5) + 1, ncode = get(4) + 4;
+        if (nlen > 286 || ndist > 30) {
+            error = "bad dynamic block header";
+            return false;
+        }
+        for (int i = 0; i < ncode; i++) lengths[order[i]] = get(3);
+        Huffman lencode, lit, dist;
+        build(lencode, lengths, 19);
+
+        int i = 0;
+        memset(lengths, 0, sizeof(lengths));
+        while (i < nlen + ndist && !error) {
+            int sym = decode(lencode);
+            if (sym < 0) return false;
+            if (sym < 16) {
+                lengths[i++] = sym;
+                continue;
+            }
+            int repeat, value = 0;
+            if (sym == 16) {
+                if (i == 0) {
+                    error = "repeat without a length";
+                    return false;
+                }
+                value = lengths[i - 1];
+                repeat = 3 + get(2);
+            } else if (sym == 17) {
+                repeat = 3 + get(3);
+            } else {
+                repeat = 11 + get(7);
+            }
+            if (i + repeat > nlen + ndist) {
+                error = "too many lengths";
+                return false;
+            }
+            while (repeat--) lengths[i++] = value;
+        }
+        if (error) return false;
+        build(lit, lengths, nlen);
+        build(dist, lengths + nlen, ndist);
+        return codes(lit, dist);
+    }
+
+    bool run()
+    {
+        int last;
+        do {
+            last = get(1);
+            int type = get(2);
+            bool ok = false;
+            if (type == 0) ok = stored();
+            else if (type == 1) ok = fixed();
+            else if (type == 2) ok = dynamic();
+            else error = "bad block type";
+            if (!ok || error) return false;
+        } while (!last);
+        return true;
+    }
+};
+
+static uint8_t paeth(int a, int b, int c)
+{
+    int p = a + b - c;
+    int pa = p > a ? p - a : a - p, pb = p > b ? p - b : b - p, pc = p > c ? p - c : c - p;
+    if (pa <= pb && pa <= pc) return a;
+    return pb <= pc ? b : c;
+}
+
+bool png_read(const char *path, std::vector<uint8_t> &rgb, int &width, int &height, std::string &error)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        error = "cannot open";
+        return false;
+    }
+    std::vector<uint8_t> file;
+    uint8_t buf[65536];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) file.insert(file.end(), buf, buf + n);
+    fclose(f);
+
+    if (file.size() < 8 || memcmp(file.data(), png_signature, 8)) {
+        error = "not a PNG";
+        return false;
+    }
+    std::vector<uint8_t> z;
+    int bpp = 0;
+    width = height = 0;
+    for (size_t pos = 8; pos + 12 <= file.size();) {
+        uint32_t len = get_be32(&file[pos]);
+        if (pos + 12 + len > file.size()) {
+            error = "truncated chunk";
+            return false;
+        }
+        const uint8_t *type = &file[pos + 4];
+        const uint8_t *data = &file[pos + 8];
+        if (crc32(type, len + 4) != get_be32(data + len)) {
+            error = "chunk CRC mismatch";
+            return false;
+        }
+        if (!memcmp(type, "IHDR", 4)) {
+            width = get_be32(data);
+            height = get_be32(data + 4);
+            if (data[8] != 8 || (data[9] != 2 && data[9] != 6) || data[12] != 0) {
+                error = "only 8-bit RGB / RGBA, not interlaced";
+                return false;
+            }
+            bpp = data[9] == 6 ? 4 : 3;
+        } else if (!memcmp(type, "IDAT", 4)) {
+            z.insert(z.end(), data, data + len);
+        } else if (!memcmp(type, "IEND", 4)) {
+            break;
+        }
+        pos += 12 + len;
+    }
+    if (!bpp || z.size() < 2) {
+        error = "missing IHDR / IDAT";
+        return false;
+    }
+
+    std::vector<uint8_t> raw;
+    Inflater inf(z.data() + 2, z.size() - 2, raw);     // Skip the zlib header
+    size_t stride = (size_t)width * bpp;
+    if (!inf.run() || raw.size() < (stride + 1) * height) {
+        error = inf.error ? inf.error : "image data too short";
+        return false;
+    }
+
+    // Undo the row filters, keep RGB
+    std::vector<uint8_t> prev(stride, 0), row(stride);
+    rgb.resize((size_t)width * height * 3);
+    for (int y = 0; y < height; y++) {
+        const uint8_t *src = &raw[y * (stride + 1)];
+        uint8_t filter = src[0];
+        for (size_t x = 0; x < stride; x++) {
+            int a = x >= (size_t)bpp ? row[x - bpp] : 0;
+            int b = prev[x];
+            int c = x >= (size_t)bpp ? prev[x - bpp] : 0;
+            uint8_t v = src[1 + x];
+            switch (filter) {
+            case 0: break;
+            case 1: v += a; break;
+            case 2: v += b; break;
+            case 3: v += (a + b) / 2; break;
+            case 4: v += paeth(a, b, c); break;
+            default:
+                error = "bad row filter";
+                return false;
+            }
+            row[x] = v;
+        }
+        for (int x = 0; x < width; x++) memcpy(&rgb[(y * width + x) * 3], &row[x * bpp], 3);
+        prev.swap(row);
+    }
+    return true;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Minimal PNG for the golden images: 8-bit RGB out (fixed-Huffman deflate,
+ * no dependencies), 8-bit RGB / RGBA in (any deflate, so goldens re-saved by
+ * an image tool still load). No interlacing, no palette.
+ */
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+bool png_write(const char *path, const uint8_t *rgb, int width, int height);
+
+// `rgb` gets width * height * 3 bytes, `error` says why on false
+bool png_read(const char *path, std::vector<uint8_t> &rgb, int &width, int &height, std::string &error);
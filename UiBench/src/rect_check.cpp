@@ -0,0 +1,240 @@
+/*
+ * UiBench -r: ui_corner_cache.cpp against LVGL's own lv_draw_sw_rect()
+ *
+ * Check: random rectangles (size, radius, opa, border, clip, radius masks of a
+ * bar underneath, some the cache leaves to LVGL) on random backgrounds, with
+ * the cache cleared now and then, must give the same pixels as LVGL. Speed:
+ * the rounded rectangles of Screen1, drawn by LVGL and from the cache.
+ */
+
+#include "bench.h"
+#include <ui_blend.h>
+#include <ui_corner_cache.h>
+#include <src/draw/sw/lv_draw_sw.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#define CHECK_W         (200)       // Buffer of the check, rectangles around it
+#define CHECK_H         (120)
+#define CHECK_CASES     (20000)
+#define CHECK_MASKS     (3)         // Radius masks under a rectangle, at most
+#define SPEED_W         (800)
+#define SPEED_H         (480)
+#define SPEED_MS        (200)       // Per rectangle and renderer
+
+typedef void (*DrawRect)(lv_draw_ctx_t *draw_ctx, const lv_draw_rect_dsc_t *dsc, const lv_area_t *coords);
+
+// A radius mask on the stack while the rectangle is drawn, as lv_bar.c adds them
+struct StackMask {
+    lv_area_t rect;
+    lv_coord_t radius;
+    bool inv;
+};
+
+struct RectCase {
+    lv_area_t coords, clip;
+    lv_draw_rect_dsc_t dsc;
+    std::vector<StackMask> masks;
+};
+
+static void draw(DrawRect draw_rect, lv_draw_ctx_t *ctx, const RectCase &c)
+{
+    lv_draw_mask_radius_param_t params[CHECK_MASKS];
+    int16_t ids[CHECK_MASKS];
+    for (size_t i = 0; i < c.masks.size(); i++) {
+        lv_draw_mask_radius_init(&params[i], &c.masks[i].rect, c.masks[i].radius, c.masks[i].inv);
+        ids[i] = lv_draw_mask_add(&params[i], nullptr);
+    }
+    ctx->clip_area = &c.clip;
+    draw_rect(ctx, &c.dsc, &c.coords);
+    for (size_t i = c.masks.size(); i-- > 0;) {
+        lv_draw_mask_remove_id(ids[i]);
+        lv_draw_mask_free_param(&params[i]);
+    }
+}
+
+static lv_coord_t random_radius(std::mt19937 &rng)
+{
+    switch (rng() % 8) {
+        case 0: return 0;
+        case 1: return LV_RADIUS_CIRCLE;
+        case 2: return 60 + rng() % 20;       // Over UI_CORNER_MAX_RADIUS when the rect is large
+        default: return 1 + rng() % 40;
+    }
+}
+
+static void random_area(std::mt19937 &rng, lv_area_t &a)
+{
+    a.x1 = (lv_coord_t)(rng() % (CHECK_W + 40)) - 20;
+    a.y1 = (lv_coord_t)(rng() % (CHECK_H + 40)) - 20;
+    a.x2 = a.x1 + rng() % CHECK_W;
+    a.y2 = a.y1 + rng() % CHECK_H;
+}
+
+static void random_case(std::mt19937 &rng, RectCase &c)
+{
+    random_area(rng, c.coords);
+    c.clip.x1 = rng() % CHECK_W;
+    c.clip.y1 = rng() % CHECK_H;
+    c.clip.x2 = c.clip.x1 + rng() % (CHECK_W - c.clip.x1);
+    c.clip.y2 = c.clip.y1 + rng() % (CHECK_H - c.clip.y1);
+    if (rng() % 2) c.clip = { 0, 0, CHECK_W - 1, CHECK_H - 1 };
+
+    lv_draw_rect_dsc_t &d = c.dsc;
+    lv_draw_rect_dsc_init(&d);
+    d.radius = random_radius(rng);
+    static const lv_opa_t opas[] = { LV_OPA_COVER, LV_OPA_COVER, LV_OPA_MAX, LV_OPA_MAX - 1, 128, 3, 2 };
+    d.bg_opa = (rng() % 4) ? opas[rng() % 7] : (lv_opa_t)rng();
+    d.bg_color.full = (uint16_t)rng();
+    if (rng() % 8 == 0) {
+        // A gradient of one color is a solid background; of two LVGL draws it
+        d.bg_grad.dir = LV_GRAD_DIR_HOR;
+        d.bg_grad.stops[0].color = d.bg_color;
+        d.bg_grad.stops[1].color.full = (rng() % 2) ? d.bg_color.full : (uint16_t)rng();
+    }
+    if (rng() % 3 == 0) {
+        d.border_width = 1 + rng() % 3;
+        d.border_opa = (rng() % 2) ? (lv_opa_t)LV_OPA_COVER : (lv_opa_t)rng();
+        d.border_side = (lv_border_side_t)(rng() % 16);
+        d.border_color.full = (uint16_t)rng();
+    }
+    if (rng() % 16 == 0) {
+        d.shadow_width = 1 + rng() % 8;
+        d.shadow_opa = (lv_opa_t)rng();
+        d.shadow_color.full = (uint16_t)rng();
+    }
+
+    c.masks.clear();
+    if (rng() % 2) {
+        size_t n = 1 + rng() % CHECK_MASKS;
+        for (size_t i = 0; i < n; i++) {
+            StackMask m;
+            random_area(rng, m.rect);
+            m.radius = random_radius(rng);
+            m.inv = rng() % 16 == 0;
+            c.masks.push_back(m);
+        }
+    }
+}
+
+static int check(lv_draw_ctx_t *ctx)
+{
+    std::mt19937 rng(4321);
+    // +1: the same case with the buffer at an odd pixel
+    std::vector<lv_color_t> bg(CHECK_W * CHECK_H + 1), ref, out;
+    lv_area_t buf_area = { 0, 0, CHECK_W - 1, CHECK_H - 1 };
+    ctx->buf_area = &buf_area;
+    int failed = 0;
+
+    for (int n = 0; n < CHECK_CASES; n++) {
+        bool flat = rng() % 2;
+        uint16_t base = (uint16_t)rng();
+        for (lv_color_t &px : bg) px.full = flat ? base : (uint16_t)rng();
+        size_t ofs = rng() % 2;
+        if (rng() % 64 == 0) ui_corner_cache_clear();
+
+        RectCase c;
+        random_case(rng, c);
+        ref = bg;
+        ctx->buf = ref.data() + ofs;
+        draw(lv_draw_sw_rect, ctx, c);
+        out = bg;
+        ctx->buf = out.data() + ofs;
+        draw(ui_corner_draw_rect, ctx, c);
+
+        if (memcmp(out.data(), ref.data(), out.size() * sizeof(lv_color_t)) && failed++ < 10) {
+            printf("  FAIL case %d: rect (%d,%d)-(%d,%d) radius %d opa %u border %d/%u clip (%d,%d)-(%d,%d) masks %zu\n",
+                   n, c.coords.x1, c.coords.y1, c.coords.x2, c.coords.y2, c.dsc.radius, c.dsc.bg_opa,
+                   c.dsc.border_width, c.dsc.border_opa, c.clip.x1, c.clip.y1, c.clip.x2, c.clip.y2, c.masks.size());
+        }
+    }
+    UiCornerCacheStats st = ui_corner_cache_stats();
+    printf("  %d rectangles: %s (%u from the cache, %u left to LVGL)\n", CHECK_CASES,
+           failed ? "FAIL" : "pixel exact", st.rects, st.rects_lvgl);
+    return failed ? 1 : 0;
+}
+
+// ----------------------------------------------------------------------
+// Speed
+// ----------------------------------------------------------------------
+
+// Screen1 (ui_Screen1.c): the slider track, its indicator under the track's
+// radius mask (lv_bar.c), a relay switch and its checked button
+static std::vector<RectCase> screen1_rects()
+{
+    std::vector<RectCase> rects;
+    auto rect = [&](lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h, lv_coord_t radius) {
+        RectCase c;
+        c.coords = { x, y, (lv_coord_t)(x + w - 1), (lv_coord_t)(y + h - 1) };
+        c.clip = { 0, 0, SPEED_W - 1, SPEED_H - 1 };
+        lv_draw_rect_dsc_init(&c.dsc);
+        c.dsc.radius = radius;
+        c.dsc.bg_opa = LV_OPA_COVER;
+        c.dsc.bg_color = lv_color_hex(0x3C3C3C);
+        rects.push_back(c);
+        return &rects.back();
+    };
+    rect(100, 60, 600, 70, 25);
+    RectCase *indic = rect(100, 60, 600, 70, 0);
+    indic->dsc.bg_color = lv_color_hex(0xFF8C00);
+    indic->masks = { { indic->coords, 25, false },
+                     { { 100, 60, 399, 129 }, 0, false } };
+    rect(110, 350, 275, 90, 60);
+    rect(110, 350, 137, 90, 58);
+    return rects;
+}
+
+static double draw_us(DrawRect draw_rect, lv_draw_ctx_t *ctx, const RectCase &c, const std::vector<lv_color_t> &bg,
+                      std::vector<lv_color_t> &buf)
+{
+    uint64_t draws = 0;
+    double s = 0;
+    do {
+        memcpy(buf.data(), bg.data(), bg.size() * sizeof(lv_color_t));
+        auto t0 = std::chrono::steady_clock::now();
+        draw(draw_rect, ctx, c);
+        s += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        draws++;
+    } while (s * 1000 < SPEED_MS);
+    return s * 1e6 / draws;
+}
+
+static void speed_all(lv_draw_ctx_t *ctx)
+{
+    static const char *const names[] = { "slider", "slider indic", "switch", "switch button" };
+    std::vector<lv_color_t> bg(SPEED_W * SPEED_H, lv_color_hex(0x202020)), buf(SPEED_W * SPEED_H);
+    lv_area_t screen = { 0, 0, SPEED_W - 1, SPEED_H - 1 };
+    ctx->buf = buf.data();
+    ctx->buf_area = &screen;
+
+    // As on the device: fills through ui_blend
+    ui_blend_install(nullptr);
+    ((lv_draw_sw_ctx_t *)ctx)->blend = ui_blend;
+    ui_corner_cache_clear();
+    ui_corner_cache_reset_stats();
+
+    printf("  %-14s %9s %9s\n", "us/draw", "LVGL", "cache");
+    std::vector<RectCase> rects = screen1_rects();
+    for (size_t i = 0; i < rects.size(); i++) {
+        double stock = draw_us(lv_draw_sw_rect, ctx, rects[i], bg, buf);
+        double cached = draw_us(ui_corner_draw_rect, ctx, rects[i], bg, buf);
+        printf("  %-14s %9.1f %9.1f %4.1fx\n", names[i], stock, cached, stock / cached);
+    }
+    UiCornerCacheStats st = ui_corner_cache_stats();
+    printf("  corner cache: %u hits, %u misses\n", st.hits, st.misses);
+}
+
+int rect_check()
+{
+    lv_disp_t *disp = check_display(SPEED_W, SPEED_H);
+    lv_draw_sw_ctx_t ctx;
+    memcpy(&ctx, disp->driver->draw_ctx, sizeof(ctx));      // LVGL's blend, set_px_cb etc.
+    printf("== rect: ui_corner_draw_rect() against lv_draw_sw_rect()\n");
+    int rc = check(&ctx.base_draw);
+    speed_all(&ctx.base_draw);
+    printf("\n");
+    return rc;
+}
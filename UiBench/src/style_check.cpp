@@ -0,0 +1,252 @@
+/*
+ * UiBench -s: ui_style_cache.cpp against LVGL's own lv_obj_get_style_prop()
+ *
+ * LVGL 8.4 resolves every style property at draw time, walking the object's
+ * style list (local style, then the theme's). Check: every property of every
+ * part of the Screen1 objects, in each of a few states, must be what LVGL
+ * resolves, cached or not, and again after local styles (inherited and not),
+ * a state with a transition and a removed property changed them. Speed: the
+ * lv_obj_get_style_prop() calls of one frame of the whole Screen1, recorded
+ * and replayed through LVGL and through the cache.
+ */
+
+#include "bench.h"
+#include <ui/ui.h>
+#include <ui_style_cache.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#define SPEED_W         (800)
+#define SPEED_H         (480)
+#define SPEED_MS        (200)
+
+// main.cpp: added to the generated UI after ui_init()
+extern void ui_screen2_add_power_toggle(void);
+extern void ui_sliders_add_release_flush(void);
+
+// The linker's names for LVGL's lookup and the cache's (-Wl,--wrap)
+extern "C" lv_style_value_t __real_lv_obj_get_style_prop(const lv_obj_t *obj, lv_part_t part, lv_style_prop_t prop);
+extern "C" lv_style_value_t __wrap_lv_obj_get_style_prop(const lv_obj_t *obj, lv_part_t part, lv_style_prop_t prop);
+typedef lv_style_value_t (*GetStyleProp)(const lv_obj_t *obj, lv_part_t part, lv_style_prop_t prop);
+
+struct Lookup {
+    const lv_obj_t *obj;
+    lv_part_t part;
+    lv_style_prop_t prop;
+};
+
+static std::vector<Lookup> *recording = nullptr;
+
+static void record(const lv_obj_t *obj, lv_part_t part, lv_style_prop_t prop)
+{
+    recording->push_back({ obj, part, prop });
+}
+
+static void collect(lv_obj_t *obj, std::vector<lv_obj_t *> &objs)
+{
+    objs.push_back(obj);
+    for (uint32_t i = 0; i < lv_obj_get_child_cnt(obj); i++) collect(lv_obj_get_child(obj, i), objs);
+}
+
+// ----------------------------------------------------------------------
+// Check
+// ----------------------------------------------------------------------
+
+static const lv_part_t parts[] = { LV_PART_MAIN, LV_PART_SCROLLBAR, LV_PART_INDICATOR, LV_PART_KNOB,
+                                   LV_PART_SELECTED, LV_PART_ITEMS, LV_PART_TICKS, LV_PART_CURSOR };
+static const lv_state_t states[] = { LV_STATE_DEFAULT, LV_STATE_CHECKED, LV_STATE_PRESSED, LV_STATE_FOCUSED,
+                                     LV_STATE_CHECKED | LV_STATE_PRESSED, LV_STATE_DISABLED };
+
+// Every property through the cache twice (a miss or a hit, then a hit) against
+// LVGL; the state is set directly, as a lookup during a state change sees it.
+// The low 32 bits: on a 64-bit host the rest of a number is whatever was there.
+static int compare(const char *what, const std::vector<lv_obj_t *> &objs)
+{
+    int failed = 0;
+    uint32_t values = 0;
+    for (lv_obj_t *obj : objs) {
+        lv_state_t state = obj->state;
+        for (lv_state_t st : states) {
+            obj->state = st;
+            for (lv_part_t part : parts) {
+                for (uint32_t p = 1; p < _LV_STYLE_LAST_BUILT_IN_PROP; p++) {
+                    lv_style_prop_t prop = (lv_style_prop_t)p;
+                    lv_style_value_t ref = __real_lv_obj_get_style_prop(obj, part, prop);
+                    for (int n = 0; n < 2; n++) {
+                        lv_style_value_t v = __wrap_lv_obj_get_style_prop(obj, part, prop);
+                        values++;
+                        if (v.num != ref.num) {
+                            if (failed++ < 10) {
+                                printf("  FAIL %s: obj %p state 0x%x part 0x%x prop %u: %d, LVGL %d\n", what,
+                                       (void *)obj, st, (unsigned)part, prop, (int)v.num, (int)ref.num);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        obj->state = state;
+    }
+    printf("  %-34s %u values: %s\n", what, values, failed ? "FAIL" : "as LVGL");
+    return failed;
+}
+
+static void run_ms(uint32_t ms)
+{
+    for (uint32_t i = 0; i < ms; i++) {
+        bench_now_ms++;
+        lv_timer_handler();
+    }
+}
+
+static void record_frame(lv_disp_t *disp, lv_obj_t *scr, std::vector<Lookup> &lookups);
+
+// The lookups of a frame, drawn before `change`, through the cache against LVGL
+// right after it: a table the change did not empty answers with the old value
+static int stale(lv_disp_t *disp, const char *what, void (*change)())
+{
+    std::vector<Lookup> frame;
+    record_frame(disp, ui_Screen1, frame);
+    change();
+    int failed = 0;
+    for (const Lookup &l : frame) {
+        lv_style_value_t v = __wrap_lv_obj_get_style_prop(l.obj, l.part, l.prop);
+        lv_style_value_t ref = __real_lv_obj_get_style_prop(l.obj, l.part, l.prop);
+        if (v.num != ref.num && failed++ < 10) {
+            printf("  FAIL %s: obj %p part 0x%x prop %u: %d, LVGL %d\n", what, (void *)l.obj, (unsigned)l.part,
+                   l.prop, (int)v.num, (int)ref.num);
+        }
+    }
+    printf("  %-34s %zu lookups: %s\n", what, frame.size(), failed ? "FAIL" : "as LVGL");
+    return failed;
+}
+
+static int check(lv_disp_t *disp, const std::vector<lv_obj_t *> &objs)
+{
+    int failed = stale(disp, "+ screen color", [] {
+        lv_obj_set_style_bg_color(ui_Screen1, lv_color_hex(0x102030), LV_PART_MAIN);
+    });
+    failed += stale(disp, "+ text decor of the screen", [] {         // Inherited by the labels
+        lv_obj_set_style_text_decor(ui_Screen1, LV_TEXT_DECOR_UNDERLINE, LV_PART_MAIN);
+    });
+    failed += stale(disp, "+ slider indicator color", [] {
+        lv_obj_set_style_bg_color(ui_Slider1, lv_color_hex(0x00FF00), LV_PART_INDICATOR);
+    });
+    failed += stale(disp, "+ pressed button, in transition", [] {   // Theme transition
+        lv_obj_add_state(ui_Button1, LV_STATE_PRESSED);
+        run_ms(40);
+    });
+    failed += stale(disp, "+ transition done", [] { run_ms(1000); });
+    failed += stale(disp, "- pressed", [] {
+        lv_obj_clear_state(ui_Button1, LV_STATE_PRESSED);
+        run_ms(1000);
+    });
+    failed += stale(disp, "- text decor of the screen", [] {
+        lv_obj_remove_local_style_prop(ui_Screen1, LV_STYLE_TEXT_DECOR, LV_PART_MAIN);
+    });
+    failed += compare("every property, part and state", objs);
+    return failed;
+}
+
+// ----------------------------------------------------------------------
+// Speed
+// ----------------------------------------------------------------------
+
+// Nanoseconds per lookup of a recorded frame; the best replay, the host being noisy
+static double replay_ns(GetStyleProp get, const std::vector<Lookup> &lookups)
+{
+    uintptr_t sink = 0;
+    double best = 1e9, s = 0;
+    do {
+        auto t0 = std::chrono::steady_clock::now();
+        for (const Lookup &l : lookups) sink += (uintptr_t)get(l.obj, l.part, l.prop).ptr;
+        double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        best = std::min(best, t);
+        s += t;
+    } while (s * 1000 < SPEED_MS);
+    if (sink == 1) printf(" ");
+    return best * 1e9 / lookups.size();
+}
+
+static void no_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    (void)area;
+    (void)color_map;
+    lv_disp_flush_ready(drv);
+}
+
+// The whole screen in one buffer, one pass of the objects per frame as on the device
+static lv_disp_t *frame_display()
+{
+    static lv_disp_draw_buf_t disp_buf;
+    static lv_disp_drv_t disp_drv;
+    static std::vector<lv_color_t> buf(SPEED_W * SPEED_H);
+
+    lv_init();
+    lv_disp_draw_buf_init(&disp_buf, buf.data(), nullptr, SPEED_W * SPEED_H);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = SPEED_W;
+    disp_drv.ver_res = SPEED_H;
+    disp_drv.draw_buf = &disp_buf;
+    disp_drv.flush_cb = no_flush;
+    return lv_disp_drv_register(&disp_drv);
+}
+
+// The lookups of one frame of the whole `scr`
+static void record_frame(lv_disp_t *disp, lv_obj_t *scr, std::vector<Lookup> &lookups)
+{
+    lv_obj_invalidate(scr);
+    lv_refr_now(disp);      // Layout and scrollbars settled
+    lv_obj_invalidate(scr);
+    lookups.clear();
+    recording = &lookups;
+    ui_style_cache_set_trace(record);
+    lv_refr_now(disp);
+    ui_style_cache_set_trace(nullptr);
+    recording = nullptr;
+}
+
+static uint32_t style_cnt(const std::vector<lv_obj_t *> &objs)
+{
+    uint32_t n = 0;
+    for (lv_obj_t *obj : objs) n += obj->style_cnt;
+    return n;
+}
+
+int style_check()
+{
+    lv_disp_t *disp = frame_display();
+    ui_init();
+    ui_screen2_add_power_toggle();
+    ui_sliders_add_release_flush();
+    ui_style_cache_enable(ui_Screen1);
+    run_ms(3000);       // Splash and fade to Screen1, on the virtual clock
+    printf("== style: ui_style_cache against lv_obj_get_style_prop() on Screen1\n");
+
+    std::vector<lv_obj_t *> objs;
+    collect(ui_Screen1, objs);
+    int rc = check(disp, objs) ? 1 : 0;
+
+    // A whole frame: every table emptied, then the lookups again from the tables
+    std::vector<Lookup> frame;
+    record_frame(disp, ui_Screen1, frame);
+    ui_style_cache_reset_stats();
+    lv_obj_invalidate(ui_Screen1);
+    lv_refr_now(disp);
+    UiStyleCacheStats st = ui_style_cache_stats();
+    double lvgl_ns = replay_ns(__real_lv_obj_get_style_prop, frame);
+    ui_style_cache_reset_stats();
+    double cache_ns = replay_ns(__wrap_lv_obj_get_style_prop, frame);
+    UiStyleCacheStats replay = ui_style_cache_stats();
+
+    printf("  %zu objects, %u styles\n", objs.size(), style_cnt(objs));
+    printf("  Screen1 frame: %zu lookups, invalidated screen: hits=%u misses=%u\n", frame.size(), st.hits,
+           st.misses);
+    printf("  replayed: hits=%u misses=%u\n", replay.hits, replay.misses);
+    printf("  per lookup: LVGL %.1f ns, cache %.1f ns (%.1fx), %.0f -> %.0f us a frame (host)\n\n", lvgl_ns,
+           cache_ns, lvgl_ns / cache_ns, lvgl_ns * frame.size() / 1000, cache_ns * frame.size() / 1000);
+    return rc;
+}